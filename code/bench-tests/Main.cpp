@@ -1,5 +1,11 @@
 #include "nanobench.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <optional>
 #include <set>
+#include <unordered_map>
 
 import Monitor.Host;
 import Opal;
@@ -9,24 +15,64 @@ using namespace Opal;
 using namespace Opal::System;
 using namespace Soup::Core;
 
+#include "OperationGraphGenerator.h"
+
 int main()
 {
 	{
+		// Cycle through more unique values than the parse cache holds so every parse misses
+		auto values = std::vector<std::string>();
+		for (auto i = 0; i < 8192; i++)
+			values.push_back(std::format("Package{}", i));
+
+		size_t index = 0;
 		ankerl::nanobench::Bench().minEpochIterations(10000).run("PackageReference Parse Name Only", [&]
 		{
-			auto actual = PackageReference::Parse("Package1");
+			auto actual = PackageReference::Parse(values[index++ % values.size()]);
 			ankerl::nanobench::doNotOptimizeAway(actual);
 		});
 	}
 
 	{
-		ankerl::nanobench::Bench().minEpochIterations(10000).run("PackageReference Parse Language, User, Name and Version", [&]
+		ankerl::nanobench::Bench().minEpochIterations(10000).run("PackageReference Parse Cached Language, User, Name and Version", [&]
 		{
 			auto actual = PackageReference::Parse("[C#]User1|Package1@1.2.3");
 			ankerl::nanobench::doNotOptimizeAway(actual);
 		});
 	}
 
+	{
+		// Cycle through more unique values than the parse cache holds so every parse misses
+		auto values = std::vector<std::string>();
+		for (auto i = 0; i < 8192; i++)
+			values.push_back(std::format("[C#]User1|Package{}@1.2.3", i));
+
+		size_t index = 0;
+		ankerl::nanobench::Bench().minEpochIterations(10000).run("PackageReference Parse Unique Language, User, Name and Version", [&]
+		{
+			auto actual = PackageReference::Parse(values[index++ % values.size()]);
+			ankerl::nanobench::doNotOptimizeAway(actual);
+		});
+	}
+
+	{
+		ankerl::nanobench::Bench().minEpochIterations(10000).run("PackageReferenceParser TryParse Language, User, Name and Version", [&]
+		{
+			auto actual = PackageReferenceParts();
+			auto result = PackageReferenceParser::TryParse("[C#]User1|Package1@1.2.3", actual);
+			ankerl::nanobench::doNotOptimizeAway(result);
+			ankerl::nanobench::doNotOptimizeAway(actual);
+		});
+	}
+
+	{
+		ankerl::nanobench::Bench().minEpochIterations(10000).run("PackageName Parse Owner and Name", [&]
+		{
+			auto actual = PackageName::Parse("User1|Package1");
+			ankerl::nanobench::doNotOptimizeAway(actual);
+		});
+	}
+
 	{
 		auto binaryFileContent = std::vector<unsigned char>(
 		{
@@ -176,6 +222,277 @@ int main()
 		});
 	}
 
+	{
+		// Build a large graph where each operation feeds the next operation and one a few steps ahead
+		const OperationId operationCount = 100000;
+		auto operations = std::vector<OperationInfo>();
+		operations.reserve(operationCount);
+		auto dependencyCounts = std::vector<uint32_t>(operationCount + 1, 0);
+		for (OperationId operationId = 1; operationId <= operationCount; operationId++)
+		{
+			auto children = std::vector<OperationId>();
+			for (auto childId : { operationId + 1, operationId + 7 })
+			{
+				if (childId <= operationCount)
+				{
+					children.push_back(childId);
+					dependencyCounts[childId]++;
+				}
+			}
+
+			operations.push_back(OperationInfo(
+				operationId,
+				std::format("Operation{}", operationId),
+				CommandInfo(
+					Path("C:/Root/"),
+					Path("./DoStuff.exe"),
+					{ std::to_string(operationId) }),
+				{ operationId, },
+				{ operationCount + operationId, },
+				{ 1, },
+				{ 2, },
+				std::move(children),
+				0));
+		}
+
+		for (auto& operation : operations)
+			operation.DependencyCount = operation.Id == 1 ? 1 : dependencyCounts[operation.Id];
+
+		auto graph = OperationGraph(std::vector<OperationId>({ 1, }), std::move(operations));
+
+		ankerl::nanobench::Bench().minEpochIterations(10).run("OperationGraph Traverse 100k", [&]
+		{
+			auto remainingCounts = std::unordered_map<OperationId, int32_t>();
+			auto readyOperations = std::vector<OperationId>(graph.GetRootOperationIds());
+			uint64_t fileCount = 0;
+			while (!readyOperations.empty())
+			{
+				auto& operationInfo = graph.GetOperationInfo(readyOperations.back());
+				readyOperations.pop_back();
+				fileCount += operationInfo.DeclaredInput.size() + operationInfo.DeclaredOutput.size();
+				for (auto childId : operationInfo.Children)
+				{
+					auto [remainingCount, wasInserted] = remainingCounts.emplace(
+						childId,
+						graph.GetOperationInfo(childId).DependencyCount);
+					if (--remainingCount->second == 0)
+						readyOperations.push_back(childId);
+				}
+			}
+
+			ankerl::nanobench::doNotOptimizeAway(fileCount);
+		});
+
+		ankerl::nanobench::Bench().minEpochIterations(10).run("CompactOperationGraph Create 100k", [&]
+		{
+			auto compactGraph = CompactOperationGraph(graph);
+			ankerl::nanobench::doNotOptimizeAway(compactGraph);
+		});
+
+		auto compactGraph = CompactOperationGraph(graph);
+		ankerl::nanobench::Bench().minEpochIterations(10).run("CompactOperationGraph Traverse 100k", [&]
+		{
+			auto remainingCounts = std::vector<int32_t>(compactGraph.GetOperationIdLimit(), -1);
+			auto readyOperations = std::vector<OperationId>(compactGraph.GetRootOperationIds());
+			uint64_t fileCount = 0;
+			while (!readyOperations.empty())
+			{
+				auto operationId = readyOperations.back();
+				readyOperations.pop_back();
+				fileCount += compactGraph.GetDeclaredInput(operationId).size() + compactGraph.GetDeclaredOutput(operationId).size();
+				for (auto childId : compactGraph.GetChildren(operationId))
+				{
+					auto& remainingCount = remainingCounts[childId];
+					if (remainingCount < 0)
+						remainingCount = compactGraph.GetDependencyCount(childId);
+					if (--remainingCount == 0)
+						readyOperations.push_back(childId);
+				}
+			}
+
+			ankerl::nanobench::doNotOptimizeAway(fileCount);
+		});
+	}
+
+	{
+		// Only report errors, the generator logs every operation it creates
+		auto filter = std::make_shared<EventTypeFilter>(
+			static_cast<TraceEventFlag>(
+				static_cast<uint32_t>(TraceEventFlag::Error) |
+				static_cast<uint32_t>(TraceEventFlag::Critical)));
+		auto scopedTraceListener = ScopedTraceListenerRegister(
+			std::make_shared<ConsoleTraceListener>("Log", filter, false, false));
+
+		// Compile each source into one of a set of object directories and periodically declare
+		// an object directory as an output to exercise both directions of the containment checks
+		auto generateGraph = [](uint32_t operationCount)
+		{
+			const uint32_t directoryCount = 100;
+			auto fileSystemState = FileSystemState();
+			auto generator = Generate::OperationGraphGenerator(
+				fileSystemState,
+				std::vector<Path>({ Path("C:/Root/"), }),
+				std::vector<Path>({ Path("C:/Root/out/"), }));
+			for (uint32_t i = 0; i < operationCount; i++)
+			{
+				auto directory = i % directoryCount;
+				if (i % 1000 == 999)
+				{
+					generator.CreateOperation(
+						std::format("Clean {}", i),
+						Path("./clean.exe"),
+						{ std::to_string(i) },
+						Path("C:/Root/"),
+						{},
+						{ Path(std::format("./out/obj/{}/{}/", directory, i)), });
+				}
+
+				generator.CreateOperation(
+					std::format("Compile {}", i),
+					Path("./compile.exe"),
+					{ std::to_string(i) },
+					Path("C:/Root/"),
+					{ Path(std::format("./Source{}.cpp", i)), },
+					{ Path(std::format("./out/obj/{}/{}/Object{}.o", directory, i / 1000 * 1000 + 999, i)), });
+			}
+
+			return generator.FinalizeGraph();
+		};
+
+		ankerl::nanobench::Bench().minEpochIterations(1).run("OperationGraphGenerator Create 10k", [&]
+		{
+			auto graph = generateGraph(10000);
+			ankerl::nanobench::doNotOptimizeAway(graph);
+		});
+
+		ankerl::nanobench::Bench().minEpochIterations(1).run("OperationGraphGenerator Create 100k", [&]
+		{
+			auto graph = generateGraph(100000);
+			ankerl::nanobench::doNotOptimizeAway(graph);
+		});
+	}
+
+	{
+		// Resolve the values for a large graph that references the target directories of many packages
+		const uint32_t packageCount = 500;
+		auto macros = std::map<std::string, std::string>();
+		for (uint32_t i = 0; i < packageCount; i++)
+		{
+			macros.emplace(std::format("/(PACKAGE_Package{})/", i), std::format("C:/Packages/Package{}/", i));
+			macros.emplace(std::format("/(TARGET_Package{})/", i), std::format("C:/Packages/Package{}/out/J_HqSstV55vlb-x6RWC_hLRFRDU/", i));
+		}
+
+		auto values = std::vector<std::string>();
+		for (uint32_t i = 0; i < 100000; i++)
+		{
+			values.push_back(std::format(
+				"-I/(PACKAGE_Package{})/include/ -reference:/(TARGET_Package{})/bin/Package.pcm -o /(TARGET_Package{})/obj/File{}.obj",
+				i % packageCount,
+				(i * 7) % packageCount,
+				i % packageCount,
+				i));
+		}
+
+		auto macroManager = MacroManager(macros);
+		ankerl::nanobench::Bench().minEpochIterations(1).run("MacroManager ResolveMacros 1000 Macros 100k Values", [&]
+		{
+			size_t size = 0;
+			for (auto& value : values)
+				size += macroManager.ResolveMacros(value).size();
+			ankerl::nanobench::doNotOptimizeAway(size);
+		});
+	}
+
+	{
+		auto workingDirectory = Path("C:/Root/");
+		auto headers = std::vector<Path>();
+		for (auto i = 0; i < 3000; i++)
+			headers.push_back(Path(std::format("C:/Include/Folder{}/Header{}.h", i % 30, i)));
+
+		auto fileSystemState = FileSystemState();
+		for (auto& header : headers)
+			fileSystemState.ToFileId(header);
+
+		ankerl::nanobench::Bench().minEpochIterations(100).run("SystemAccessTracker Observe 3000 Inputs", [&]
+		{
+			auto monitor = SystemAccessTracker(workingDirectory);
+			for (auto& header : headers)
+			{
+				monitor.TouchFileRead(header, true, false);
+				monitor.TouchFileRead(header, true, false);
+			}
+
+			auto input = monitor.GetInput(fileSystemState);
+			ankerl::nanobench::doNotOptimizeAway(input);
+		});
+	}
+
+#if defined(__linux__)
+	{
+		// Create a header heavy translation unit to measure the overhead the monitor adds to each file open
+		const auto headerCount = 500;
+		auto workingDirectory = std::filesystem::temp_directory_path() / "SoupBenchMonitor";
+		std::filesystem::create_directories(workingDirectory);
+		auto source = std::ofstream(workingDirectory / "Main.c");
+		for (auto i = 0; i < headerCount; i++)
+		{
+			auto header = std::format("Header{}.h", i);
+			std::ofstream(workingDirectory / header) << std::format("int Value{}(void);\n", i);
+			source << std::format("#include \"{}\"\n", header);
+		}
+
+		source << "int main(void) { return 0; }\n";
+		source.close();
+
+		auto executable = Path("/usr/bin/cc");
+		auto arguments = std::vector<std::string>({ "-fsyntax-only", "Main.c" });
+		auto workingDirectoryPath = Path::Parse(workingDirectory.string() + "/");
+
+		ankerl::nanobench::Bench().minEpochIterations(10).run("Process Compile HeaderHeavy", [&]
+		{
+			auto process = LinuxProcessManager().CreateProcess(
+				executable,
+				arguments,
+				workingDirectoryPath,
+				false);
+			process->Start();
+			process->WaitForExit();
+			ankerl::nanobench::doNotOptimizeAway(process->GetExitCode());
+		});
+
+		auto runMonitored = [&](Monitor::Linux::LinuxMonitorBackend backend)
+		{
+			auto monitor = std::make_shared<SystemAccessTracker>(workingDirectoryPath);
+			auto process = Monitor::Linux::LinuxMonitorProcessManager(backend).CreateMonitorProcess(
+				executable,
+				arguments,
+				workingDirectoryPath,
+				{},
+				monitor,
+				nullptr,
+				false,
+				false,
+				{},
+				{});
+			process->Start();
+			process->WaitForExit();
+			ankerl::nanobench::doNotOptimizeAway(process->GetExitCode());
+		};
+
+		ankerl::nanobench::Bench().minEpochIterations(10).run("LinuxMonitorProcess Compile HeaderHeavy", [&]
+		{
+			runMonitored(Monitor::Linux::LinuxMonitorBackend::Trace);
+		});
+
+		ankerl::nanobench::Bench().minEpochIterations(10).run("LinuxNotifyMonitorProcess Compile HeaderHeavy", [&]
+		{
+			runMonitored(Monitor::Linux::LinuxMonitorBackend::Notify);
+		});
+
+		std::filesystem::remove_all(workingDirectory);
+	}
+#endif
+
 	{
 		// Register the test listener
 		auto testListener = std::make_shared<TestTraceListener>();
@@ -13,6 +13,7 @@
 #include "TargetCommand.h"
 #include "VersionCommand.h"
 #include "ViewCommand.h"
+#include "WatchCommand.h"
 
 namespace Soup::Client
 {
@@ -103,6 +104,8 @@ namespace Soup::Client
 					command = Setup(arguments.ExtractResult<VersionOptions>());
 				else if (arguments.IsA<ViewOptions>())
 					command = Setup(arguments.ExtractResult<ViewOptions>());
+				else if (arguments.IsA<WatchOptions>())
+					command = Setup(arguments.ExtractResult<WatchOptions>());
 				else
 					throw std::runtime_error("Unknown arguments");
 
@@ -142,6 +145,7 @@ namespace Soup::Client
 			Log::HighPriority("  restore - Install all dependencies required by the target recipe.");
 			Log::HighPriority("  version - Display the current version of this tool.");
 			Log::HighPriority("  view    - Launch the view tool.");
+			Log::HighPriority("  watch   - Record file changes to speed up the next build.");
 		}
 
 		void SetupShared(SharedOptions& options)
@@ -154,6 +158,15 @@ namespace Soup::Client
 		{
 			Log::Diag("Setup BuildOptions");
 			SetupShared(options);
+
+			#if defined(__linux__)
+				if (options.Monitor == "notify")
+				{
+					Monitor::IMonitorProcessManager::Register(
+						std::make_shared<Monitor::Linux::LinuxMonitorProcessManager>(Monitor::Linux::LinuxMonitorBackend::Notify));
+				}
+			#endif
+
 			return std::make_shared<BuildCommand>(
 				std::move(options));
 		}
@@ -222,6 +235,14 @@ namespace Soup::Client
 				std::move(options));
 		}
 
+		std::shared_ptr<ICommand> Setup(WatchOptions options)
+		{
+			Log::Diag("Setup WatchCommand");
+			SetupShared(options);
+			return std::make_shared<WatchCommand>(
+				std::move(options));
+		}
+
 	private:
 		std::shared_ptr<EventTypeFilter> _filter;
 	};
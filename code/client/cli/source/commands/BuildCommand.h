@@ -5,6 +5,7 @@
 #pragma once
 #include "ICommand.h"
 #include "BuildOptions.h"
+#include "InProcessGenerateEngine.h"
 
 namespace Soup::Client
 {
@@ -56,6 +57,11 @@ namespace Soup::Client
 			arguments.SkipEvaluate = _options.SkipEvaluate;
 			arguments.DisableMonitor = _options.DisableMonitor;
 			arguments.PartialMonitor = _options.PartialMonitor;
+			arguments.ContentHash = _options.ContentHash;
+			arguments.ActionCache = _options.ActionCache;
+			arguments.MaxJobs = _options.Jobs;
+			arguments.ResourcePoolLimits = _options.ResourcePools;
+			arguments.MemoryBudget = _options.MemoryBudget;
 
 			// Platform specific defaults
 			#if defined(_WIN32)
@@ -74,6 +80,21 @@ namespace Soup::Client
 
 			// TODO: Generic parameters
 
+			// Record the build timeline when requested
+			auto trace = std::shared_ptr<Core::BuildTrace>(nullptr);
+			auto traceFile = Path();
+			if (!_options.TraceFile.empty())
+			{
+				traceFile = Path::Parse(_options.TraceFile);
+				if (!traceFile.HasRoot())
+				{
+					traceFile = System::IFileSystem::Current().GetCurrentDirectory() + traceFile;
+				}
+
+				trace = std::make_shared<Core::BuildTrace>();
+				Core::BuildTrace::Register(trace);
+			}
+
 			// Now build the current project
 			Log::Info("Begin Build:");
 
@@ -87,18 +108,36 @@ namespace Soup::Client
 			
 			auto recipeCache = Core::RecipeCache();
 
-			auto packageProvider = Core::BuildEngine::LoadBuildGraph(
-				builtInPackageDirectory,
-				arguments.WorkingDirectory,
-				arguments.GlobalParameters,
-				userDataPath,
-				recipeCache);
+			try
+			{
+				auto packageProvider = Core::BuildEngine::LoadBuildGraph(
+					builtInPackageDirectory,
+					arguments.WorkingDirectory,
+					arguments.GlobalParameters,
+					userDataPath,
+					recipeCache);
+
+				// Reuse the loaded recipes in generate when it is run in-process
+				auto inProcessGenerateEngine = InProcessGenerateEngine();
+				Core::IGenerateEngine* generateEngine = nullptr;
+				if (_options.InProcessGenerate)
+					generateEngine = &inProcessGenerateEngine;
+
+				Core::BuildEngine::Execute(
+					packageProvider,
+					std::move(arguments),
+					userDataPath,
+					recipeCache,
+					generateEngine);
+			}
+			catch (...)
+			{
+				// Keep the timeline of a failed build to see where it stopped
+				SaveTrace(trace, traceFile);
+				throw;
+			}
 
-			Core::BuildEngine::Execute(
-				packageProvider,
-				std::move(arguments),
-				userDataPath,
-				recipeCache);
+			SaveTrace(trace, traceFile);
 
 			auto endTime = std::chrono::high_resolution_clock::now();
 			auto duration = std::chrono::duration_cast<std::chrono::duration<double>>(endTime -startTime);
@@ -124,6 +163,16 @@ namespace Soup::Client
 		}
 
 	private:
+		void SaveTrace(const std::shared_ptr<Core::BuildTrace>& trace, const Path& traceFile)
+		{
+			if (trace == nullptr)
+				return;
+
+			Core::BuildTrace::Register(nullptr);
+			trace->Save(traceFile);
+			Log::HighPriority("Trace: {}", traceFile.ToString());
+		}
+
 		BuildOptions _options;
 	};
 }
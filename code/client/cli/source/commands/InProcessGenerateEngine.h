@@ -0,0 +1,35 @@
+﻿// <copyright file="InProcessGenerateEngine.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "GenerateEngine.h"
+
+namespace Soup::Client
+{
+	/// <summary>
+	/// The generate engine that runs the generate phase inside the soup process
+	/// using the recipes loaded by the build instead of launching the generate executable
+	/// </summary>
+	class InProcessGenerateEngine : public Core::IGenerateEngine
+	{
+	public:
+		/// <summary>
+		/// Run the generate phase for a single package
+		/// </summary>
+		virtual void Generate(
+			const Path& soupTargetDirectory,
+			const Core::ValueTable& inputTable,
+			Core::FileSystemState& fileSystemState,
+			Core::RecipeCache& recipeCache,
+			std::vector<Path>& observedInput,
+			std::vector<Path>& observedOutput) override final
+		{
+			auto generateEngine = Core::Generate::GenerateEngine(fileSystemState, recipeCache);
+			generateEngine.Run(soupTargetDirectory, inputTable);
+
+			observedInput = generateEngine.GetObservedInput();
+			observedOutput = generateEngine.GetObservedOutput();
+		}
+	};
+}
@@ -0,0 +1,370 @@
+﻿// <copyright file="WatchCommand.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "ICommand.h"
+#include "WatchOptions.h"
+
+namespace Soup::Client
+{
+	/// <summary>
+	/// Watch Command
+	/// Keeps the changed file journal up to date for the packages in the build graph so the next
+	/// build can trust the file write times from the previous build without checking every file.
+	/// </summary>
+	class WatchCommand : public ICommand
+	{
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="WatchCommand"/> class.
+		/// </summary>
+		WatchCommand(WatchOptions options) :
+			_options(std::move(options)),
+			_notifyHandle(-1),
+			_sessionId(0),
+			_journalPath(),
+			_journalFile(nullptr),
+			_journal(nullptr),
+			_compactedOffset(0),
+			_watches(),
+			_watchedDirectories(),
+			_rootDirectories()
+		{
+		}
+
+		/// <summary>
+		/// Main entry point for a unique command
+		/// </summary>
+		virtual void Run() override final
+		{
+			Log::Diag("WatchCommand::Run");
+
+			auto workingDirectory = Path();
+			if (_options.Path.empty())
+			{
+				// Watch the current directory
+				workingDirectory = System::IFileSystem::Current().GetCurrentDirectory();
+			}
+			else
+			{
+				// Parse the path in any system valid format
+				workingDirectory = Path::Parse(std::format("{}/", _options.Path));
+
+				// Check if this is relative to current directory
+				if (!workingDirectory.HasRoot())
+				{
+					workingDirectory = System::IFileSystem::Current().GetCurrentDirectory() + workingDirectory;
+				}
+			}
+
+			// Find the built in folder root
+			auto processFilename = System::IProcessManager::Current().GetCurrentProcessFileName();
+			auto processDirectory = processFilename.GetParent();
+			auto builtInPackageDirectory = processDirectory + Path("./BuiltIn/");
+
+			// Load user config state
+			auto userDataPath = Core::BuildEngine::GetSoupUserDataPath();
+
+			// Load the build graph to find the set of package roots to watch
+			auto recipeCache = Core::RecipeCache();
+			auto packageProvider = Core::BuildEngine::LoadBuildGraph(
+				builtInPackageDirectory,
+				workingDirectory,
+				Core::ValueTable(),
+				userDataPath,
+				recipeCache);
+
+			auto packageRoots = std::set<std::string>();
+			for (auto& package : packageProvider.GetPackageLookup())
+			{
+				packageRoots.insert(package.second.PackageRoot.ToString());
+			}
+
+			auto fileSystemJournalFile = userDataPath + Core::BuildConstants::FileSystemJournalFileName();
+			Watch(packageRoots, fileSystemJournalFile);
+		}
+
+	private:
+		#if defined(__linux__)
+		void Watch(const std::set<std::string>& packageRoots, const Path& fileSystemJournalFile)
+		{
+			_notifyHandle = inotify_init1(IN_CLOEXEC);
+			if (_notifyHandle < 0)
+				throw std::runtime_error(std::format("Failed to initialize inotify: {}", errno));
+
+			// Start a new journal session, any previous session can no longer be trusted
+			_sessionId = std::chrono::duration_cast<std::chrono::duration<int64_t, std::ratio<1, 10'000'000>>>(
+				std::chrono::system_clock::now().time_since_epoch()).count();
+			_journalPath = fileSystemJournalFile;
+			_journalFile = System::IFileSystem::Current().OpenWrite(fileSystemJournalFile, true);
+			_journal = &_journalFile->GetOutStream();
+			Core::FileSystemJournalWriter::WriteHeader(*_journal, _sessionId, static_cast<uint32_t>(getpid()));
+
+			// Watch each package root before the session is published so a build never trusts an unwatched file
+			for (auto& packageRoot : packageRoots)
+			{
+				auto packageRootPath = Path(packageRoot);
+				AddWatch(packageRootPath, false);
+				_rootDirectories.insert(packageRoot);
+				Core::FileSystemJournalWriter::WriteRecord(
+					*_journal, Core::FileSystemJournalRecordType::Watch, packageRootPath);
+			}
+
+			_journal->flush();
+			Log::HighPriority("Watching {} packages", packageRoots.size());
+
+			auto buffer = std::vector<char>(64 * 1024);
+			while (true)
+			{
+				auto length = read(_notifyHandle, buffer.data(), buffer.size());
+				if (length < 0)
+				{
+					if (errno == EINTR)
+						continue;
+					throw std::runtime_error(std::format("Failed to read inotify events: {}", errno));
+				}
+
+				for (auto offset = 0l; offset < length;)
+				{
+					auto event = reinterpret_cast<const inotify_event*>(buffer.data() + offset);
+					HandleEvent(*event);
+					offset += sizeof(inotify_event) + event->len;
+				}
+
+				_journal->flush();
+			}
+		}
+
+		void HandleEvent(const inotify_event& event)
+		{
+			if ((event.mask & IN_Q_OVERFLOW) != 0)
+			{
+				Log::Warning("File system watcher overflowed, the next build will check all files");
+				Core::FileSystemJournalWriter::WriteRecord(
+					*_journal, Core::FileSystemJournalRecordType::Overflow, Path());
+				return;
+			}
+
+			auto findDirectory = _watches.find(event.wd);
+			if (findDirectory == _watches.end())
+				return;
+
+			auto directory = findDirectory->second;
+			if ((event.mask & IN_IGNORED) != 0)
+			{
+				_watches.erase(findDirectory);
+				_watchedDirectories.erase(directory.ToString());
+				return;
+			}
+
+			if (event.len == 0)
+			{
+				// The watched directory itself was removed or moved, everything under it has changed.
+				// A moved directory is watched again from its new parent, the existing watches report the old paths
+				WriteChange(directory);
+				if ((event.mask & IN_MOVE_SELF) != 0)
+					RemoveWatches(directory);
+
+				// Nothing is watching the parent of a package root to notice it coming back
+				if (_rootDirectories.contains(directory.ToString()))
+				{
+					Log::Warning("Watched package root was removed, the next build will check all files");
+					Core::FileSystemJournalWriter::WriteRecord(
+						*_journal, Core::FileSystemJournalRecordType::Overflow, Path());
+				}
+
+				return;
+			}
+
+			auto name = std::string(event.name);
+			if (name.starts_with(Core::BuildConstants::FileSystemJournalCookiePrefix()))
+			{
+				// A build is waiting for every earlier event to be journaled, the cookie itself is not a change
+				if ((event.mask & IN_CLOSE_WRITE) != 0)
+				{
+					Core::FileSystemJournalWriter::WriteRecord(
+						*_journal, Core::FileSystemJournalRecordType::Cookie, directory + Path(name));
+
+					// Drop the records that have already been consumed by the previous build
+					int64_t sessionId = 0;
+					uint64_t consumedOffset = 0;
+					if (Core::FileSystemJournalManager::TryParseCookie(name, sessionId, consumedOffset) &&
+						sessionId == _sessionId &&
+						consumedOffset > _compactedOffset)
+					{
+						CompactJournal(consumedOffset);
+					}
+				}
+
+				return;
+			}
+
+			auto isDirectory = (event.mask & IN_ISDIR) != 0;
+			auto isEntryChange = (event.mask & (IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO)) != 0;
+			if (isDirectory)
+			{
+				// A directory that was added, removed or moved changes everything under it,
+				// otherwise only the directory entry itself changed
+				auto childDirectory = directory + Path(name + "/");
+				if (isEntryChange)
+					WriteChange(childDirectory);
+				else
+					WriteDirectoryEntryChange(childDirectory);
+
+				// The watches under a directory that was moved away report the old paths
+				if ((event.mask & IN_MOVED_FROM) != 0)
+					RemoveWatches(childDirectory);
+
+				// Watch new directories and report their contents, they may replace a directory from the previous build
+				if ((event.mask & (IN_CREATE | IN_MOVED_TO)) != 0)
+					AddWatch(childDirectory, true);
+			}
+			else
+			{
+				WriteChange(directory + Path(name));
+			}
+
+			// The parent directory contents changed
+			if (isEntryChange)
+			{
+				WriteDirectoryEntryChange(directory);
+			}
+		}
+
+		void AddWatch(const Path& directory, bool reportFiles)
+		{
+			if (_watchedDirectories.contains(directory.ToString()))
+				return;
+
+			auto mask = IN_MODIFY | IN_ATTRIB | IN_CLOSE_WRITE | IN_CREATE | IN_DELETE |
+				IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+			auto watch = inotify_add_watch(_notifyHandle, directory.ToString().c_str(), mask);
+			if (watch < 0)
+			{
+				Log::Warning("Failed to watch directory: {}", directory.ToString());
+				return;
+			}
+
+			_watches.insert_or_assign(watch, directory);
+			_watchedDirectories.insert(directory.ToString());
+
+			std::function<void(const Path& file, std::chrono::time_point<std::chrono::file_clock>)> callback =
+				[&](const Path& file, std::chrono::time_point<std::chrono::file_clock> lastWriteTime)
+				{
+					if (file.IsEmpty())
+						return;
+
+					auto absolutePath = file.HasRoot() ? file : directory + file;
+					if (reportFiles)
+						WriteChange(absolutePath);
+
+					// Recursively watch child directories
+					if (!absolutePath.HasFileName())
+						AddWatch(absolutePath, reportFiles);
+				};
+
+			System::IFileSystem::Current().TryGetDirectoryFilesLastWriteTime(directory, callback);
+		}
+
+		void RemoveWatches(const Path& directory)
+		{
+			auto directoryValue = directory.ToString();
+			for (auto watch = _watches.begin(); watch != _watches.end();)
+			{
+				auto watchedDirectory = watch->second.ToString();
+				if (watchedDirectory.starts_with(directoryValue))
+				{
+					inotify_rm_watch(_notifyHandle, watch->first);
+					_watchedDirectories.erase(watchedDirectory);
+					watch = _watches.erase(watch);
+				}
+				else
+				{
+					++watch;
+				}
+			}
+		}
+
+		/// <summary>
+		/// Rewrite the journal without the records that have been consumed by the previous build,
+		/// the new journal replaces the old one in a single rename so a build never reads a partial journal
+		/// </summary>
+		void CompactJournal(uint64_t consumedOffset)
+		{
+			_journal->flush();
+
+			auto journal = Core::FileSystemJournal();
+			{
+				auto file = System::IFileSystem::Current().OpenRead(_journalPath, true);
+				journal = Core::FileSystemJournalReader::Deserialize(file->GetInStream());
+			}
+
+			// Ignore a build that consumed a journal from before a previous compaction
+			if (consumedOffset <= journal.CompactedOffset || consumedOffset > journal.Size)
+				return;
+
+			auto compactedPath = Path(std::format("{}.compact", _journalPath.ToString()));
+			auto compactedFile = System::IFileSystem::Current().OpenWrite(compactedPath, true);
+			try
+			{
+				Core::FileSystemJournalWriter::WriteCompacted(compactedFile->GetOutStream(), journal, consumedOffset);
+				compactedFile->GetOutStream().flush();
+			}
+			catch (std::exception& ex)
+			{
+				Log::Warning("Failed to compact the file system journal: {}", ex.what());
+				return;
+			}
+
+			auto error = std::error_code();
+			std::filesystem::rename(compactedPath.ToString(), _journalPath.ToString(), error);
+			if (error)
+			{
+				Log::Warning("Failed to compact the file system journal: {}", error.message());
+				return;
+			}
+
+			// Continue appending to the compacted journal
+			_journalFile = std::move(compactedFile);
+			_journal = &_journalFile->GetOutStream();
+			_compactedOffset = consumedOffset;
+			Log::Diag("Compacted the file system journal to offset {}", consumedOffset);
+		}
+
+		void WriteChange(const Path& file)
+		{
+			Core::FileSystemJournalWriter::WriteRecord(
+				*_journal, Core::FileSystemJournalRecordType::Change, file);
+		}
+
+		void WriteDirectoryEntryChange(const Path& directory)
+		{
+			// Leave off the trailing separator, a change with the separator invalidates everything under the directory
+			auto value = directory.ToString();
+			if (value.ends_with('/'))
+				value.pop_back();
+
+			WriteChange(Path(value));
+		}
+		#else
+		void Watch(const std::set<std::string>& packageRoots, const Path& fileSystemJournalFile)
+		{
+			throw std::runtime_error("The file system watcher is only supported on Linux");
+		}
+		#endif
+
+	private:
+		WatchOptions _options;
+
+		int _notifyHandle;
+		int64_t _sessionId;
+		Path _journalPath;
+		std::shared_ptr<System::IOutputFile> _journalFile;
+		std::ostream* _journal;
+		uint64_t _compactedOffset;
+		std::map<int, Path> _watches;
+		std::set<std::string> _watchedDirectories;
+		std::set<std::string> _rootDirectories;
+	};
+}
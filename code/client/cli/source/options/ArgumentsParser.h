@@ -12,6 +12,7 @@
 #include "TargetOptions.h"
 #include "VersionOptions.h"
 #include "ViewOptions.h"
+#include "WatchOptions.h"
 
 namespace Soup::Client
 {
@@ -59,6 +60,9 @@ namespace Soup::Client
 				options->DisableMonitor = IsFlagSet("disableMonitor", unusedArgs);
 				options->PartialMonitor = IsFlagSet("partialMonitor", unusedArgs);
 				options->Force = IsFlagSet("force", unusedArgs);
+				options->InProcessGenerate = IsFlagSet("inProcessGenerate", unusedArgs);
+				options->ContentHash = IsFlagSet("contentHash", unusedArgs);
+				options->ActionCache = IsFlagSet("actionCache", unusedArgs);
 
 				auto flavorValue = std::string();
 				if (TryGetValueArgument("flavor", unusedArgs, flavorValue))
@@ -72,6 +76,42 @@ namespace Soup::Client
 					options->Architecture = std::move(architectureValue);
 				}
 
+				options->Jobs = 1;
+				auto jobsValue = std::string();
+				if (TryGetValueArgument("jobs", unusedArgs, jobsValue))
+				{
+					options->Jobs = ParseJobs(jobsValue);
+				}
+
+				auto poolValue = std::string();
+				while (TryGetValueArgument("pool", unusedArgs, poolValue))
+				{
+					auto [name, limit] = ParseResourcePool(poolValue);
+					options->ResourcePools.insert_or_assign(std::move(name), limit);
+				}
+
+				options->MemoryBudget = 0;
+				auto memoryBudgetValue = std::string();
+				if (TryGetValueArgument("memoryBudget", unusedArgs, memoryBudgetValue))
+				{
+					options->MemoryBudget = ParseMemorySize(memoryBudgetValue);
+				}
+
+				auto monitorValue = std::string();
+				if (TryGetValueArgument("monitor", unusedArgs, monitorValue))
+				{
+					if (monitorValue != "trace" && monitorValue != "notify")
+						throw std::runtime_error(std::format("Invalid monitor value: {}", monitorValue));
+
+					options->Monitor = std::move(monitorValue);
+				}
+
+				auto traceValue = std::string();
+				if (TryGetValueArgument("trace", unusedArgs, traceValue))
+				{
+					options->TraceFile = std::move(traceValue);
+				}
+
 				result = std::move(options);
 			}
 			else if (commandType == "init")
@@ -247,6 +287,23 @@ namespace Soup::Client
 
 				result = std::move(options);
 			}
+			else if (commandType == "watch")
+			{
+				Log::Diag("Parse watch");
+
+				auto options = std::make_unique<WatchOptions>();
+
+				// Check if the optional index arguments exist
+				auto argument = std::string();
+				if (TryGetIndexArgument(unusedArgs, argument))
+				{
+					options->Path = std::move(argument);
+				}
+
+				options->Verbosity = CheckVerbosity(unusedArgs);
+
+				result = std::move(options);
+			}
 			else
 			{
 				throw std::runtime_error(std::format("Unknown command argument: {}", commandType));
@@ -367,6 +424,78 @@ namespace Soup::Client
 			}
 		}
 
+		static uint32_t ParseJobs(const std::string& value)
+		{
+			// Zero requests one job per hardware thread
+			auto jobs = 0ul;
+			try
+			{
+				jobs = std::stoul(value);
+			}
+			catch (const std::exception&)
+			{
+				throw std::runtime_error(std::format("Invalid jobs value: {}", value));
+			}
+
+			if (jobs == 0)
+				jobs = std::max(1u, std::thread::hardware_concurrency());
+
+			return static_cast<uint32_t>(jobs);
+		}
+
+		static std::pair<std::string, uint32_t> ParseResourcePool(const std::string& value)
+		{
+			auto separator = value.find('=');
+			if (separator == std::string::npos || separator == 0)
+				throw std::runtime_error(std::format("Invalid pool value: {}", value));
+
+			auto limit = 0ul;
+			try
+			{
+				limit = std::stoul(value.substr(separator + 1));
+			}
+			catch (const std::exception&)
+			{
+				throw std::runtime_error(std::format("Invalid pool value: {}", value));
+			}
+
+			if (limit == 0)
+				throw std::runtime_error(std::format("Invalid pool value: {}", value));
+
+			return { value.substr(0, separator), static_cast<uint32_t>(limit) };
+		}
+
+		static uint64_t ParseMemorySize(const std::string& value)
+		{
+			// Allow a K, M or G suffix for the size in bytes
+			auto number = std::string_view(value);
+			uint64_t multiplier = 1;
+			if (number.ends_with('K') || number.ends_with('k'))
+				multiplier = 1024ull;
+			else if (number.ends_with('M') || number.ends_with('m'))
+				multiplier = 1024ull * 1024;
+			else if (number.ends_with('G') || number.ends_with('g'))
+				multiplier = 1024ull * 1024 * 1024;
+
+			if (multiplier != 1)
+				number.remove_suffix(1);
+
+			auto size = 0ull;
+			try
+			{
+				size_t end = 0;
+				size = std::stoull(std::string(number), &end);
+				if (end != number.size())
+					throw std::runtime_error("Invalid size");
+			}
+			catch (const std::exception&)
+			{
+				throw std::runtime_error(std::format("Invalid memory budget value: {}", value));
+			}
+
+			return size * multiplier;
+		}
+
 		static TraceEventFlag CheckVerbosity(std::vector<std::string>& unusedArgs)
 		{
 			auto level = 
@@ -61,5 +61,53 @@ namespace Soup::Client
 		/// </summary>
 		// [[Args::Option('a', "architecture", Default = false, HelpText = "Architecture.")]]
 		std::string Architecture;
+
+		/// <summary>
+		/// Gets or sets the maximum number of operations to run in parallel
+		/// </summary>
+		// [[Args::Option('j', "jobs", Default = 1, HelpText = "Maximum number of parallel operations.")]]
+		uint32_t Jobs;
+
+		/// <summary>
+		/// Gets or sets the maximum total weight of operations to run in parallel for each resource pool
+		/// </summary>
+		// [[Args::Option("pool", HelpText = "Limit a resource pool, <name>=<limit>. May be repeated.")]]
+		std::map<std::string, uint32_t> ResourcePools;
+
+		/// <summary>
+		/// Gets or sets the maximum total peak memory in bytes of the operations to run in parallel
+		/// </summary>
+		// [[Args::Option("memoryBudget", Default = 0, HelpText = "Maximum combined peak memory of parallel operations.")]]
+		uint64_t MemoryBudget;
+
+		/// <summary>
+		/// Gets or sets the mechanism used to monitor operations
+		/// </summary>
+		// [[Args::Option("monitor", Default = "trace", HelpText = "The monitor backend, trace or notify.")]]
+		std::string Monitor;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to run the generate phase within the soup process
+		/// </summary>
+		// [[Args::Option("inProcessGenerate", Default = false, HelpText = "Run the build generate phase in-process. Only the generate input, recipes, extension scripts, local user config and dependency shared state are tracked as reads, other files read by generate do not trigger a new generate.")]]
+		bool InProcessGenerate;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to use the content of inputs for incremental builds
+		/// </summary>
+		// [[Args::Option("contentHash", Default = false, HelpText = "Skip operations whose altered inputs have unchanged content.")]]
+		bool ContentHash;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to use the shared action cache
+		/// </summary>
+		// [[Args::Option("actionCache", Default = false, HelpText = "Restore operation outputs from the shared action cache.")]]
+		bool ActionCache;
+
+		/// <summary>
+		/// Gets or sets the file to write the build timeline to as Chrome trace event JSON
+		/// </summary>
+		// [[Args::Option("trace", Default = "", HelpText = "Write a Chrome trace of the build timeline to the file.")]]
+		std::string TraceFile;
 	};
 }
@@ -0,0 +1,23 @@
+﻿// <copyright file="WatchOptions.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "SharedOptions.h"
+
+namespace Soup::Client
+{
+	/// <summary>
+	/// Watch Command
+	/// </summary>
+	// TODO: [Verb("watch")]
+	class WatchOptions : public SharedOptions
+	{
+	public:
+		/// <summary>
+		/// Gets or sets the path to watch
+		/// </summary>
+		// [[Args::Option("path", Index = 0, HelpText = "Path to the package to watch.")]]
+		std::string Path;
+	};
+}
@@ -1,6 +1,11 @@
 #include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 
+// TODO import
+#include "wren/wren.h"
+
 import Opal;
 import Soup.Core;
 import Soup.Test.Assert;
@@ -13,6 +18,8 @@ using namespace Soup::Test;
 #include "Commands/InstallCommandTests.gen.h"
 #include "Commands/PublishCommandTests.gen.h"
 #include "Commands/VersionCommandTests.gen.h"
+#include "generate/ExtensionManagerTests.gen.h"
+#include "generate/GenerateHostTests.gen.h"
 
 int main()
 {
@@ -24,6 +31,8 @@ int main()
 	state += RunInitializeCommandTests();
 	state += RunPublishCommandTests();
 	state += RunVersionCommandTests();
+	state += RunExtensionManagerTests();
+	state += RunGenerateHostTests();
 
 	// Touch stamp file to ensure incremental builds work
 	// auto testFile = std::fstream("TestHarness.stamp", std::fstream::out);
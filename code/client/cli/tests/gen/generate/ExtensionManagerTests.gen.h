@@ -0,0 +1,12 @@
+#pragma once
+#include "generate/ExtensionManagerTests.h"
+
+TestState RunExtensionManagerTests() 
+ {
+	auto className = "ExtensionManagerTests";
+	auto testClass = std::make_shared<Soup::Core::Generate::UnitTests::ExtensionManagerTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Execute_SameScriptTasksDoNotShareWrenState", [&testClass]() { testClass->Execute_SameScriptTasksDoNotShareWrenState(); });
+
+	return state;
+}
\ No newline at end of file
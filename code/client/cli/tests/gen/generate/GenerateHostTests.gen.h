@@ -0,0 +1,13 @@
+#pragma once
+#include "generate/GenerateHostTests.h"
+
+TestState RunGenerateHostTests() 
+ {
+	auto className = "GenerateHostTests";
+	auto testClass = std::make_shared<Soup::Core::Generate::UnitTests::GenerateHostTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "EvaluateTask_MapExtensionsUpdateActiveState", [&testClass]() { testClass->EvaluateTask_MapExtensionsUpdateActiveState(); });
+	state += Soup::Test::RunTest(className, "EvaluateTask_UnloadedStateReturnsSource", [&testClass]() { testClass->EvaluateTask_UnloadedStateReturnsSource(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+// <copyright file="ExtensionManagerTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "ExtensionManager.h"
+
+namespace Soup::Core::Generate::UnitTests
+{
+	/// <summary>
+	/// Extension Manager Tests
+	/// </summary>
+	class ExtensionManagerTests
+	{
+	public:
+		// [[Fact]]
+		void Execute_SameScriptTasksDoNotShareWrenState()
+		{
+			auto scriptFile = WriteScript(
+				"ExtensionManagerTests_SameScript.wren",
+				"import \"soup\" for Soup, SoupTask\n"
+				"\n"
+				"var ModuleValue = null\n"
+				"\n"
+				"class TaskState {\n"
+				"	static value { __value }\n"
+				"	static value=(value) { __value = value }\n"
+				"}\n"
+				"\n"
+				"class FirstTask is SoupTask {\n"
+				"	static evaluate() {\n"
+				"		TaskState.value = \"First\"\n"
+				"		ModuleValue = \"First\"\n"
+				"		Soup.activeState[\"FirstTask\"] = \"Ran\"\n"
+				"	}\n"
+				"}\n"
+				"\n"
+				"class SecondTask is SoupTask {\n"
+				"	static runAfter { [ \"FirstTask\" ] }\n"
+				"	static evaluate() {\n"
+				"		Soup.activeState[\"StaticValue\"] = TaskState.value is Null ? \"Unset\" : TaskState.value\n"
+				"		Soup.activeState[\"ModuleValue\"] = ModuleValue is Null ? \"Unset\" : ModuleValue\n"
+				"	}\n"
+				"}\n");
+
+			auto host = std::make_unique<GenerateHost>(scriptFile, std::nullopt);
+			host->InterpretMain();
+
+			auto uut = ExtensionManager();
+			for (auto& extension : host->DiscoverExtensions())
+				uut.RegisterExtensionTask(std::move(extension));
+			uut.RegisterExtensionHost(scriptFile, std::move(host));
+
+			auto fileSystemState = FileSystemState();
+			auto state = GenerateState(ValueTable(), fileSystemState, {}, {});
+			uut.Execute(state);
+
+			Assert::AreEqual(
+				ValueTable(
+				{
+					{ "FirstTask", Value("Ran") },
+					{ "ModuleValue", Value("Unset") },
+					{ "StaticValue", Value("Unset") },
+				}),
+				state.GetActiveState(),
+				"Verify active state matches expected.");
+		}
+
+	private:
+		/// <summary>
+		/// The host reads the script straight from disk, write it to a temp file
+		/// </summary>
+		static Path WriteScript(const char* fileName, const char* source)
+		{
+			auto scriptFile = std::filesystem::temp_directory_path() / fileName;
+			auto stream = std::ofstream(scriptFile, std::ios::trunc);
+			stream << source;
+			stream.close();
+
+			return Path::Parse(scriptFile.generic_string());
+		}
+	};
+}
@@ -0,0 +1,181 @@
+// <copyright file="GenerateHostTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "GenerateHost.h"
+
+namespace Soup::Core::Generate::UnitTests
+{
+	/// <summary>
+	/// Generate Host Tests
+	/// </summary>
+	class GenerateHostTests
+	{
+	private:
+		// The state helpers from Soup.Build.Utils that the build extensions use to update the state tables
+		static inline const char* MapExtensionsSource =
+			"class MapExtensions {\n"
+			"	static EnsureList(map, key) {\n"
+			"		if (!(map is Map)) Fiber.abort(\"Map must be a Map\")\n"
+			"		if (map.containsKey(key)) {\n"
+			"			var value = map[key]\n"
+			"			if (!(value is List)) Fiber.abort(\"Value must be a List\")\n"
+			"			return value\n"
+			"		} else {\n"
+			"			var value = []\n"
+			"			map[key] = value\n"
+			"			return value\n"
+			"		}\n"
+			"	}\n"
+			"\n"
+			"	static EnsureTable(map, key) {\n"
+			"		if (!(map is Map)) Fiber.abort(\"Map must be a Map\")\n"
+			"		if (map.containsKey(key)) {\n"
+			"			var value = map[key]\n"
+			"			if (!(value is Map)) Fiber.abort(\"Value must be a Map\")\n"
+			"			return value\n"
+			"		} else {\n"
+			"			var value = {}\n"
+			"			map[key] = value\n"
+			"			return value\n"
+			"		}\n"
+			"	}\n"
+			"}\n";
+
+	public:
+		// [[Fact]]
+		void EvaluateTask_MapExtensionsUpdateActiveState()
+		{
+			auto scriptFile = WriteScript(
+				"GenerateHostTests_MapExtensions.wren",
+				"import \"soup\" for Soup, SoupTask\n"
+				"\n"
+				"class TestTask is SoupTask {\n"
+				"	static evaluate() {\n"
+				"		var context = MapExtensions.EnsureTable(Soup.globalState, \"Context\")\n"
+				"		var build = MapExtensions.EnsureTable(Soup.activeState, \"Build\")\n"
+				"		build[\"TargetDirectory\"] = context[\"TargetDirectory\"]\n"
+				"		MapExtensions.EnsureList(build, \"Source\").add(\"Main.cpp\")\n"
+				"		Soup.activeState.remove(\"Removed\")\n"
+				"	}\n"
+				"}\n");
+
+			auto fileSystemState = FileSystemState();
+			auto state = GenerateState(
+				ValueTable(
+				{
+					{
+						"Context",
+						Value(ValueTable(
+						{
+							{ "TargetDirectory", Value("/out/") },
+						}))
+					},
+				}),
+				fileSystemState,
+				{},
+				{});
+			state.Update(
+				ValueTable(
+				{
+					{
+						"Build",
+						Value(ValueTable(
+						{
+							{ "Source", Value(ValueList({ Value("Other.cpp") })) },
+						}))
+					},
+					{ "Removed", Value("Value") },
+				}),
+				ValueTable());
+
+			auto uut = GenerateHost(scriptFile, std::nullopt);
+			uut.InterpretMain();
+			uut.SetState(state);
+			uut.EvaluateTask("TestTask");
+
+			Assert::AreEqual(
+				ValueTable(
+				{
+					{
+						"Build",
+						Value(ValueTable(
+						{
+							{ "Source", Value(ValueList({ Value("Other.cpp"), Value("Main.cpp") })) },
+							{ "TargetDirectory", Value("/out/") },
+						}))
+					},
+				}),
+				uut.GetUpdatedActiveState(),
+				"Verify active state matches expected.");
+			Assert::AreEqual(
+				ValueTable(),
+				uut.GetUpdatedSharedState(),
+				"Verify shared state matches expected.");
+		}
+
+		// [[Fact]]
+		void EvaluateTask_UnloadedStateReturnsSource()
+		{
+			auto scriptFile = WriteScript(
+				"GenerateHostTests_UnloadedState.wren",
+				"import \"soup\" for Soup, SoupTask\n"
+				"\n"
+				"class TestTask is SoupTask {\n"
+				"	static evaluate() {\n"
+				"		MapExtensions.EnsureTable(Soup.sharedState, \"Reference\")[\"Name\"] = \"Test\"\n"
+				"	}\n"
+				"}\n");
+
+			auto fileSystemState = FileSystemState();
+			auto state = GenerateState(ValueTable(), fileSystemState, {}, {});
+			state.Update(
+				ValueTable(
+				{
+					{ "Value", Value("Original") },
+				}),
+				ValueTable());
+
+			auto uut = GenerateHost(scriptFile, std::nullopt);
+			uut.InterpretMain();
+			uut.SetState(state);
+			uut.EvaluateTask("TestTask");
+
+			Assert::AreEqual(
+				ValueTable(
+				{
+					{ "Value", Value("Original") },
+				}),
+				uut.GetUpdatedActiveState(),
+				"Verify active state matches expected.");
+			Assert::AreEqual(
+				ValueTable(
+				{
+					{
+						"Reference",
+						Value(ValueTable(
+						{
+							{ "Name", Value("Test") },
+						}))
+					},
+				}),
+				uut.GetUpdatedSharedState(),
+				"Verify shared state matches expected.");
+		}
+
+	private:
+		/// <summary>
+		/// The host reads the script straight from disk, write the task along with the helpers to a temp file
+		/// </summary>
+		static Path WriteScript(const char* fileName, const char* taskSource)
+		{
+			auto scriptFile = std::filesystem::temp_directory_path() / fileName;
+			auto stream = std::ofstream(scriptFile, std::ios::trunc);
+			stream << taskSource << "\n" << MapExtensionsSource;
+			stream.close();
+
+			return Path::Parse(scriptFile.generic_string());
+		}
+	};
+}
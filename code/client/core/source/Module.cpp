@@ -3,23 +3,29 @@
 // TODO: Add a converter level to Opal?
 #define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
 
+#include <algorithm>
 #include <any>
 #include <array>
 #include <chrono>
 #include <codecvt>
+#include <condition_variable>
 #include <cstring>
 #include <ctime>
+#include <deque>
 #include <iomanip>
 #include <iostream>
 #include <locale>
 #include <map>
-#include <regex>
+#include <mutex>
 #include <optional>
 #include <set>
+#include <span>
 #include <sstream>
 #include <stack>
 #include <string>
+#include <string_view>
 #include <fstream>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <variant>
@@ -56,14 +62,28 @@ import Monitor.Host;
 import Opal;
 
 // Build
+export import :ActionCache;
 export import :BuildConstants;
+export import :BuildEvaluateOptions;
 export import :BuildFailedException;
 export import :BuildHistoryChecker;
+export import :BuildTrace;
 export import :DependencyTargetSet;
+export import :FileSystemJournal;
+export import :FileSystemJournalManager;
+export import :FileSystemJournalReader;
+export import :FileSystemJournalWriter;
 export import :FileSystemState;
+export import :FileSystemStateManager;
+export import :FileSystemStateReader;
+export import :FileSystemStateWriter;
+export import :IActionCacheStore;
 export import :IEvaluateEngine;
+export import :IGenerateEngine;
 export import :KnownLanguage;
+export import :LocalActionCacheStore;
 export import :MacroManager;
+export import :OperationOutputSink;
 export import :PackageProvider;
 export import :RecipeBuildArguments;
 export import :RecipeBuildCacheState;
@@ -77,13 +97,18 @@ export import :SDKConfig;
 
 // Operation Graph
 export import :CommandInfo;
+export import :CompactOperationGraph;
 export import :OperationGraph;
 export import :OperationGraphManager;
 export import :OperationGraphReader;
+export import :OperationGraphView;
 export import :OperationGraphWriter;
 export import :OperationInfo;
 export import :OperationResult;
 export import :OperationResults;
+export import :OperationResultsJournal;
+export import :OperationResultsJournalReader;
+export import :OperationResultsJournalWriter;
 export import :OperationResultsManager;
 export import :OperationResultsReader;
 export import :OperationResultsWriter;
@@ -100,6 +125,7 @@ export import :LanguageReference;
 export import :PackageIdentifier;
 export import :PackageName;
 export import :PackageReference;
+export import :PackageReferenceParser;
 export import :Recipe;
 export import :RecipeBuildStateConverter;
 export import :RecipeCache;
@@ -113,6 +139,7 @@ export import :RootRecipeExtensions;
 export import :SML;
 
 // Utilities
+export import :ContentHash;
 export import :HandledException;
 export import :SequenceMap;
 
@@ -0,0 +1,474 @@
+﻿// <copyright file="ActionCache.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+export module Soup.Core:ActionCache;
+
+import Opal;
+import :CommandInfo;
+import :ContentHash;
+import :FileSystemState;
+import :IActionCacheStore;
+import :OperationResult;
+
+using namespace Opal;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// A content addressed cache of operation results that allows the outputs from a previous
+	/// run of the same command with identical input content to be restored without running the command.
+	/// The inputs are only known after a command has run so the lookup is split in two levels,
+	/// the command maps to the set of files it last read and the command plus the content of those files
+	/// maps to the output files, which are stored as content addressed blobs.
+	/// Files under the command working directory are stored relative to it so entries can be shared
+	/// between copies of the same package in different locations.
+	/// </summary>
+	export class ActionCache
+	{
+	private:
+		// Binary Action Cache file format
+		static constexpr uint32_t FileVersion = 2;
+
+		IActionCacheStore& _store;
+		FileSystemState& _fileSystemState;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="ActionCache"/> class.
+		/// </summary>
+		ActionCache(IActionCacheStore& store, FileSystemState& fileSystemState) :
+			_store(store),
+			_fileSystemState(fileSystemState)
+		{
+		}
+
+		/// <summary>
+		/// Attempt to restore the outputs for a command from a previous run with the same input content
+		/// </summary>
+		bool TryRestore(const CommandInfo& command, OperationResult& operationResult)
+		{
+			auto commandKey = GetCommandKey(command);
+
+			// Find the set of inputs that were observed the last time this command was cached
+			auto manifestContent = std::string();
+			if (!_store.TryLoad(GetManifestKey(commandKey), manifestContent))
+				return false;
+
+			auto inputs = std::vector<Path>();
+			if (!TryRead([&]() { inputs = ReadInputList(manifestContent); }))
+				return false;
+
+			auto inputFiles = std::vector<FileId>();
+			for (auto& input : inputs)
+				inputFiles.push_back(_fileSystemState.ToFileId(MakeAbsolute(input, command.WorkingDirectory)));
+
+			auto inputHashes = std::vector<uint64_t>();
+			for (auto inputFile : inputFiles)
+			{
+				auto contentHash = _fileSystemState.GetContentHash(inputFile);
+				if (!contentHash.has_value())
+				{
+					Log::Diag("Action cache input missing [{}]", _fileSystemState.GetFilePath(inputFile).ToString());
+					return false;
+				}
+
+				inputHashes.push_back(contentHash.value());
+			}
+
+			auto actionContent = std::string();
+			if (!_store.TryLoad(GetActionKey(commandKey, inputHashes), actionContent))
+				return false;
+
+			auto outputs = std::vector<std::pair<Path, uint64_t>>();
+			if (!TryRead([&]() { outputs = ReadOutputList(actionContent); }))
+				return false;
+
+			// Load all of the blobs before touching the outputs to avoid leaving a partial result
+			auto outputContents = std::vector<std::string>();
+			for (auto& [outputFile, outputHash] : outputs)
+			{
+				auto& outputContent = outputContents.emplace_back();
+				if (!_store.TryLoad(GetBlobKey(outputHash), outputContent) ||
+					ContentHash::Hash(outputContent) != outputHash)
+				{
+					Log::Diag("Action cache output blob missing [{}]", outputFile.ToString());
+					return false;
+				}
+			}
+
+			auto outputFiles = std::vector<FileId>();
+			for (auto i = 0u; i < outputs.size(); i++)
+			{
+				auto outputFile = MakeAbsolute(outputs[i].first, command.WorkingDirectory);
+				auto outputDirectory = outputFile.GetParent();
+				if (!System::IFileSystem::Current().Exists(outputDirectory))
+					System::IFileSystem::Current().CreateDirectory(outputDirectory);
+
+				auto file = System::IFileSystem::Current().OpenWrite(outputFile, true);
+				file->GetOutStream().write(outputContents[i].data(), outputContents[i].size());
+
+				outputFiles.push_back(_fileSystemState.ToFileId(outputFile));
+			}
+
+			// The manifest is in the order of the original run, restore the sorted unique sets
+			// that the system access tracker produces for a command that was run
+			SortUnique(inputFiles);
+			SortUnique(outputFiles);
+
+			operationResult.ObservedInput = std::move(inputFiles);
+			operationResult.ObservedOutput = std::move(outputFiles);
+
+			// Mark this operation as successful to enable future incremental builds
+			operationResult.WasSuccessfulRun = true;
+			operationResult.EvaluateTime = System::ISystem::Current().GetCurrentTime();
+
+			// Ensure the File System State is notified of any output files that have changed
+			_fileSystemState.InvalidateFileWriteTimes(operationResult.ObservedOutput);
+
+			return true;
+		}
+
+		/// <summary>
+		/// Save the outputs from a successful run of a command
+		/// </summary>
+		void Store(const CommandInfo& command, const OperationResult& operationResult)
+		{
+			auto commandKey = GetCommandKey(command);
+
+			auto inputs = std::vector<Path>();
+			auto inputHashes = std::vector<uint64_t>();
+			for (auto inputFile : operationResult.ObservedInput)
+			{
+				auto contentHash = _fileSystemState.GetContentHash(inputFile);
+				if (!contentHash.has_value())
+				{
+					// Inputs that do not exist cannot be verified by a future restore
+					Log::Diag("Skip action cache for missing input [{}]", _fileSystemState.GetFilePath(inputFile).ToString());
+					return;
+				}
+
+				inputs.push_back(MakeRelative(_fileSystemState.GetFilePath(inputFile), command.WorkingDirectory));
+				inputHashes.push_back(contentHash.value());
+			}
+
+			auto outputs = std::vector<std::pair<Path, uint64_t>>();
+			auto outputContents = std::vector<std::string>();
+			for (auto outputFile : operationResult.ObservedOutput)
+			{
+				auto outputPath = _fileSystemState.GetFilePath(outputFile);
+				std::shared_ptr<System::IInputFile> file;
+				if (!System::IFileSystem::Current().TryOpenRead(outputPath, true, file))
+				{
+					// Temporary files that were cleaned up by the command cannot be restored
+					Log::Diag("Skip action cache for missing output [{}]", outputPath.ToString());
+					return;
+				}
+
+				auto& stream = file->GetInStream();
+				auto& outputContent = outputContents.emplace_back(
+					std::istreambuf_iterator<char>(stream),
+					std::istreambuf_iterator<char>());
+				outputs.emplace_back(
+					MakeRelative(outputPath, command.WorkingDirectory),
+					ContentHash::Hash(outputContent));
+			}
+
+			// Store the blobs first so an entry never references content that does not exist
+			for (auto i = 0u; i < outputs.size(); i++)
+			{
+				_store.Store(GetBlobKey(outputs[i].second), outputContents[i]);
+			}
+
+			_store.Store(GetActionKey(commandKey, inputHashes), WriteOutputList(outputs));
+			_store.Store(GetManifestKey(commandKey), WriteInputList(inputs));
+		}
+
+		/// <summary>
+		/// Persist any pending changes in the backing store
+		/// </summary>
+		void Flush()
+		{
+			_store.Flush();
+		}
+
+	private:
+		static uint64_t GetCommandKey(const CommandInfo& command)
+		{
+			auto hash = ContentHash();
+			auto append = [&hash](const std::string& value)
+			{
+				// Include the terminator to ensure distinct splits of the same characters do not collide
+				hash.Update(value.c_str(), value.size() + 1);
+			};
+
+			// The working directory is left out so the same command in another location shares the entry,
+			// the inputs for each location are still verified by content
+			append(MakeRelative(command.Executable, command.WorkingDirectory).ToString());
+			for (auto& argument : command.Arguments)
+				append(argument);
+
+			return hash.Finalize();
+		}
+
+		static uint64_t GetActionKey(uint64_t commandKey, const std::vector<uint64_t>& inputHashes)
+		{
+			auto hash = ContentHash();
+			hash.Update(reinterpret_cast<const char*>(&commandKey), sizeof(uint64_t));
+			hash.Update(reinterpret_cast<const char*>(inputHashes.data()), inputHashes.size() * sizeof(uint64_t));
+			return hash.Finalize();
+		}
+
+		static std::string GetManifestKey(uint64_t commandKey)
+		{
+			return std::format("{:016x}.bam", commandKey);
+		}
+
+		static std::string GetActionKey(uint64_t commandKey, const std::vector<uint64_t>& inputHashes)
+		{
+			return std::format("{:016x}.bac", GetActionKey(commandKey, inputHashes));
+		}
+
+		static std::string GetBlobKey(uint64_t contentHash)
+		{
+			return std::format("{:016x}.blob", contentHash);
+		}
+
+		/// <summary>
+		/// Make a file under the working directory relative to it, files outside of it keep their absolute path
+		/// </summary>
+		static Path MakeRelative(const Path& file, const Path& workingDirectory)
+		{
+			auto directoryValue = workingDirectory.ToString();
+			if (!directoryValue.ends_with('/'))
+				directoryValue.push_back('/');
+
+			auto fileValue = file.ToString();
+			if (fileValue.size() > directoryValue.size() && fileValue.starts_with(directoryValue))
+				return Path(fileValue.substr(directoryValue.size()));
+			else
+				return file;
+		}
+
+		static Path MakeAbsolute(const Path& file, const Path& workingDirectory)
+		{
+			return file.HasRoot() ? file : workingDirectory + file;
+		}
+
+		static void SortUnique(std::vector<FileId>& values)
+		{
+			std::sort(values.begin(), values.end());
+			values.erase(std::unique(values.begin(), values.end()), values.end());
+		}
+
+		static bool TryRead(const std::function<void()>& read)
+		{
+			try
+			{
+				read();
+				return true;
+			}
+			catch (std::runtime_error& ex)
+			{
+				// Treat a corrupted entry as a cache miss, it will be replaced on the next store
+				Log::Warning("Failed to read action cache entry: {}", ex.what());
+				return false;
+			}
+		}
+
+		static std::string WriteInputList(const std::vector<Path>& values)
+		{
+			auto stream = std::stringstream();
+
+			// Write the File Header with version
+			stream.write("BAM\0", 4);
+			WriteValue(stream, FileVersion);
+
+			WriteValue(stream, static_cast<uint32_t>(values.size()));
+			for (auto& value : values)
+			{
+				WriteValue(stream, value.ToString());
+			}
+
+			return stream.str();
+		}
+
+		static std::string WriteOutputList(const std::vector<std::pair<Path, uint64_t>>& values)
+		{
+			auto stream = std::stringstream();
+
+			// Write the File Header with version
+			stream.write("BAC\0", 4);
+			WriteValue(stream, FileVersion);
+
+			WriteValue(stream, static_cast<uint32_t>(values.size()));
+			for (auto& [file, contentHash] : values)
+			{
+				WriteValue(stream, file.ToString());
+				WriteValue(stream, contentHash);
+			}
+
+			return stream.str();
+		}
+
+		static std::vector<Path> ReadInputList(const std::string& content)
+		{
+			size_t offset = 0;
+			ReadHeader(content, offset, 'B', 'A', 'M');
+
+			auto count = ReadUInt32(content, offset);
+			auto result = std::vector<Path>();
+			for (auto i = 0u; i < count; i++)
+			{
+				result.push_back(Path(ReadString(content, offset)));
+			}
+
+			VerifyEnd(content, offset);
+			return result;
+		}
+
+		static std::vector<std::pair<Path, uint64_t>> ReadOutputList(const std::string& content)
+		{
+			size_t offset = 0;
+			ReadHeader(content, offset, 'B', 'A', 'C');
+
+			auto count = ReadUInt32(content, offset);
+			auto result = std::vector<std::pair<Path, uint64_t>>();
+			for (auto i = 0u; i < count; i++)
+			{
+				auto file = Path(ReadString(content, offset));
+				auto contentHash = ReadUInt64(content, offset);
+				result.emplace_back(std::move(file), contentHash);
+			}
+
+			VerifyEnd(content, offset);
+			return result;
+		}
+
+		static void ReadHeader(const std::string& content, size_t& offset, char header0, char header1, char header2)
+		{
+			auto headerBuffer = std::array<char, 4>();
+			Read(content, offset, headerBuffer.data(), 4);
+			if (headerBuffer[0] != header0 ||
+				headerBuffer[1] != header1 ||
+				headerBuffer[2] != header2 ||
+				headerBuffer[3] != '\0')
+			{
+				throw std::runtime_error("Invalid action cache file header");
+			}
+
+			auto fileVersion = ReadUInt32(content, offset);
+			if (fileVersion != FileVersion)
+			{
+				throw std::runtime_error("Action cache file version does not match expected");
+			}
+		}
+
+		static void VerifyEnd(const std::string& content, size_t offset)
+		{
+			if (offset != content.size())
+			{
+				throw std::runtime_error("Action cache file corrupted - Did not read the entire file");
+			}
+		}
+
+		static uint32_t ReadUInt32(const std::string& content, size_t& offset)
+		{
+			uint32_t result = 0;
+			Read(content, offset, reinterpret_cast<char*>(&result), sizeof(uint32_t));
+
+			return result;
+		}
+
+		static uint64_t ReadUInt64(const std::string& content, size_t& offset)
+		{
+			uint64_t result = 0;
+			Read(content, offset, reinterpret_cast<char*>(&result), sizeof(uint64_t));
+
+			return result;
+		}
+
+		static std::string ReadString(const std::string& content, size_t& offset)
+		{
+			auto stringLength = ReadUInt32(content, offset);
+			auto result = std::string(stringLength, '\0');
+			Read(content, offset, result.data(), stringLength);
+
+			return result;
+		}
+
+		static void Read(const std::string& content, size_t& offset, char* buffer, size_t count)
+		{
+			if (offset + count > content.size())
+				throw std::runtime_error("Tried to read past end of data");
+			memcpy(buffer, content.data() + offset, count);
+			offset += count;
+		}
+
+		static void WriteValue(std::ostream& stream, uint32_t value)
+		{
+			stream.write(reinterpret_cast<char*>(&value), sizeof(uint32_t));
+		}
+
+		static void WriteValue(std::ostream& stream, uint64_t value)
+		{
+			stream.write(reinterpret_cast<char*>(&value), sizeof(uint64_t));
+		}
+
+		static void WriteValue(std::ostream& stream, std::string_view value)
+		{
+			WriteValue(stream, static_cast<uint32_t>(value.size()));
+			stream.write(value.data(), value.size());
+		}
+	};
+
+	/// <summary>
+	/// Flush the action cache when the scope ends so the entries stored by a build that
+	/// fails part way are still tracked for eviction
+	/// </summary>
+	export class ScopedActionCacheFlush
+	{
+	private:
+		ActionCache* _actionCache;
+
+	public:
+		ScopedActionCacheFlush(ActionCache* actionCache) :
+			_actionCache(actionCache)
+		{
+		}
+
+		ScopedActionCacheFlush(const ScopedActionCacheFlush&) = delete;
+		ScopedActionCacheFlush& operator=(const ScopedActionCacheFlush&) = delete;
+
+		~ScopedActionCacheFlush()
+		{
+			if (_actionCache == nullptr)
+				return;
+
+			try
+			{
+				_actionCache->Flush();
+			}
+			catch (std::exception& ex)
+			{
+				// Do not replace an active exception, the next build will merge the entries it can find
+				Log::Warning("Failed to save action cache index: {}", ex.what());
+			}
+		}
+	};
+}
@@ -4,6 +4,8 @@
 
 module;
 
+#include <string>
+
 export module Soup.Core:BuildConstants;
 
 import Opal;
@@ -18,6 +20,12 @@ namespace Soup::Core
 	export class BuildConstants
 	{
 	public:
+		static const Path& ActionCacheDirectoryName()
+		{
+			static const auto value = Path("./ActionCache/");
+			return value;
+		}
+
 		static const Path& EvaluateGraphFileName()
 		{
 			static const auto value = Path("./Evaluate.bog");
@@ -30,6 +38,30 @@ namespace Soup::Core
 			return value;
 		}
 
+		static const Path& EvaluateResultsJournalFileName()
+		{
+			static const auto value = Path("./Evaluate.brj");
+			return value;
+		}
+
+		static const Path& FileSystemJournalFileName()
+		{
+			static const auto value = Path("./FileSystemJournal.bfj");
+			return value;
+		}
+
+		static const std::string& FileSystemJournalCookiePrefix()
+		{
+			static const auto value = std::string(".soup-cookie-");
+			return value;
+		}
+
+		static const Path& FileSystemStateFileName()
+		{
+			static const auto value = Path("./FileSystemState.bfs");
+			return value;
+		}
+
 		static const Path& GenerateInputFileName()
 		{
 			static const auto value = Path("./GenerateInput.bvt");
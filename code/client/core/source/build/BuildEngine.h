@@ -81,18 +81,11 @@ namespace Soup::Core
 			const Path& userDataPath,
 			RecipeCache& recipeCache)
 		{
-			auto startTime = std::chrono::high_resolution_clock::now();
+			auto span = BuildTraceSpan("LoadBuildGraph", "Load");
 
 			// Load the system specific state
 			auto hostGlobalParameters = LoadHostSystemState();
 
-			auto endTime = std::chrono::high_resolution_clock::now();
-			auto duration = std::chrono::duration_cast<std::chrono::duration<double>>(endTime - startTime);
-
-			// Log::Info("LoadSystemState: {} seconds", duration.count());
-
-			startTime = std::chrono::high_resolution_clock::now();
-
 			// Generate the package build graph
 			auto knownLanguages = GetKnownLanguages();
 			auto builtInPackages = GetBuiltInPackages();
@@ -106,11 +99,6 @@ namespace Soup::Core
 				recipeCache);
 			auto packageProvider = loadEngine.Load(workingDirectory);
 
-			endTime = std::chrono::high_resolution_clock::now();
-			duration = std::chrono::duration_cast<std::chrono::duration<double>>(endTime - startTime);
-
-			// Log::Info("BuildLoadEngine: {} seconds", duration.count());
-
 			return packageProvider;
 		}
 
@@ -118,12 +106,30 @@ namespace Soup::Core
 		/// Preload the file system
 		/// </summary>
 		static FileSystemState PreloadFileSystemState(
-			PackageProvider& packageProvider)
+			PackageProvider& packageProvider,
+			const Path& userDataPath)
 		{
-			auto startTime = std::chrono::high_resolution_clock::now();
+			auto span = BuildTraceSpan("PreloadFileSystemState", "Preload");
 
 			// Initialize a shared File System State to cache file system access
+			// Restore the state from the previous build so unchanged directories do not need to be loaded again
 			auto fileSystemState = FileSystemState();
+			auto fileSystemStateFile = userDataPath + BuildConstants::FileSystemStateFileName();
+			if (FileSystemStateManager::TryLoadState(fileSystemStateFile, fileSystemState))
+			{
+				// Use the changes reported by an active file system watcher to trust the previous write times,
+				// once the watcher has caught up with every change made before the build started
+				auto fileSystemJournal = FileSystemJournal();
+				auto fileSystemJournalFile = userDataPath + BuildConstants::FileSystemJournalFileName();
+				if (FileSystemJournalManager::TryLoadState(fileSystemJournalFile, fileSystemJournal) &&
+					FileSystemJournalManager::TrySync(
+						fileSystemJournalFile,
+						fileSystemJournal,
+						fileSystemState.GetRestoredJournalOffset(fileSystemJournal.SessionId)))
+				{
+					fileSystemState.ApplyJournal(fileSystemJournal);
+				}
+			}
 
 			for (auto package : packageProvider.GetPackageLookup())
 			{
@@ -131,13 +137,6 @@ namespace Soup::Core
 				// TODO: fileSystemState.PreloadDirectory(package.second.TargetDirectory, false);
 			}
 
-			auto endTime = std::chrono::high_resolution_clock::now();
-			auto duration = std::chrono::duration_cast<std::chrono::duration<double>>(endTime - startTime);
-
-			// Log::Info("PreloadFileSystemState: {} seconds", duration.count());
-
-			startTime = std::chrono::high_resolution_clock::now();
-
 			return fileSystemState;
 		}
 
@@ -147,7 +146,20 @@ namespace Soup::Core
 			const Path& userDataPath,
 			RecipeCache& recipeCache)
 		{
-			auto startTime = std::chrono::high_resolution_clock::now();
+			Execute(packageProvider, arguments, userDataPath, recipeCache, nullptr);
+		}
+
+		/// <summary>
+		/// Execute the build, if a generate engine is provided the generate phase will be run in-process
+		/// </summary>
+		static void Execute(
+			PackageProvider& packageProvider,
+			const RecipeBuildArguments& arguments,
+			const Path& userDataPath,
+			RecipeCache& recipeCache,
+			IGenerateEngine* generateEngine)
+		{
+			auto span = BuildTraceSpan("Execute", "Build");
 
 			// Initialize shared location manager
 			auto knownLanguages = GetKnownLanguages();
@@ -157,14 +169,35 @@ namespace Soup::Core
 			auto systemReadAccess = LoadHostSystemAccess();
 
 			// Load the file system state
-			auto fileSystemState = PreloadFileSystemState(packageProvider);
+			auto fileSystemState = PreloadFileSystemState(packageProvider, userDataPath);
+
+			// Initialize the lock that guards the shared state between parallel package builds
+			auto stateLock = BuildStateLock();
+
+			// Initialize the action cache that is shared between all builds for the current user
+			auto actionCacheStore = LocalActionCacheStore(
+				userDataPath + BuildConstants::ActionCacheDirectoryName(),
+				LocalActionCacheStore::DefaultMaxSize);
+			auto actionCache = ActionCache(actionCacheStore, fileSystemState);
+
+			// Save the action cache usage for eviction even when the build fails
+			auto scopedActionCacheFlush = ScopedActionCacheFlush(arguments.ActionCache ? &actionCache : nullptr);
 
 			// Initialize a shared Evaluate Engine
+			auto evaluateOptions = BuildEvaluateOptions();
+			evaluateOptions.ForceRebuild = arguments.ForceRebuild;
+			evaluateOptions.DisableMonitor = arguments.DisableMonitor;
+			evaluateOptions.PartialMonitor = arguments.PartialMonitor;
+			evaluateOptions.ContentHash = arguments.ContentHash;
+			evaluateOptions.MaxJobs = arguments.MaxJobs;
+			evaluateOptions.MaxOutputBufferSize = arguments.MaxOutputBufferSize;
+			evaluateOptions.ResourcePoolLimits = arguments.ResourcePoolLimits;
+			evaluateOptions.MemoryBudget = arguments.MemoryBudget;
 			auto evaluateEngine = BuildEvaluateEngine(
-				arguments.ForceRebuild,
-				arguments.DisableMonitor,
-				arguments.PartialMonitor,
-				fileSystemState);
+				evaluateOptions,
+				fileSystemState,
+				&stateLock,
+				arguments.ActionCache ? &actionCache : nullptr);
 
 			// Initialize the build runner that will perform the generate and evaluate phase
 			// for each individual package
@@ -175,14 +208,17 @@ namespace Soup::Core
 				recipeCache,
 				packageProvider,
 				evaluateEngine,
+				generateEngine,
 				fileSystemState,
-				locationManager);
+				locationManager,
+				stateLock);
 			buildRunner.Execute();
 
-			auto endTime = std::chrono::high_resolution_clock::now();
-			auto duration = std::chrono::duration_cast<std::chrono::duration<double>>(endTime - startTime);
+			auto saveSpan = BuildTraceSpan("SaveState", "Build");
 
-			// Log::Info("BuildRunner: {} seconds", duration.count());
+			// Save the file system state for the next build
+			auto fileSystemStateFile = userDataPath + BuildConstants::FileSystemStateFileName();
+			FileSystemStateManager::SaveState(fileSystemStateFile, fileSystemState);
 		}
 
 		static Path GetSoupUserDataPath()
@@ -3,6 +3,10 @@
 // </copyright>
 
 #pragma once
+#include "BuildStateLock.h"
+#include "OperationReadyQueue.h"
+#include "OperationResourceTracker.h"
+#include "OperationWorkerPool.h"
 
 namespace Soup::Core
 {
@@ -10,25 +14,29 @@ namespace Soup::Core
 	{
 	public:
 		BuildEvaluateState(
-			const OperationGraph& operationGraph,
+			const CompactOperationGraph& operationGraph,
 			OperationResults& operationResults,
+			OperationResultsJournal* operationResultsJournal,
 			const Path& temporaryDirectory,
 			const std::vector<Path>& globalAllowedReadAccess,
 			const std::vector<Path>& globalAllowedWriteAccess) :
-			OperationGraph(operationGraph),
+			CompactOperationGraph(operationGraph),
 			OperationResults(operationResults),
+			OperationResultsJournal(operationResultsJournal),
 			TemporaryDirectory(temporaryDirectory),
 			GlobalAllowedReadAccess(globalAllowedReadAccess),
 			GlobalAllowedWriteAccess(globalAllowedWriteAccess),
-			RemainingDependencyCounts(),
+			RemainingDependencyCounts(CompactOperationGraph.GetOperationIdLimit(), -1),
+			CriticalPathTimes(),
 			LookupLoaded(false),
 			InputFileLookup(),
 			OutputFileLookup()
 		{
 		}
 
-		const ::Soup::Core::OperationGraph& OperationGraph;
+		const ::Soup::Core::CompactOperationGraph& CompactOperationGraph;
 		::Soup::Core::OperationResults& OperationResults;
+		::Soup::Core::OperationResultsJournal* OperationResultsJournal;
 
 		const Path& TemporaryDirectory;
 
@@ -36,40 +44,108 @@ namespace Soup::Core
 		const std::vector<Path>& GlobalAllowedWriteAccess;
 
 		// Running State
-		std::unordered_map<OperationId, int32_t> RemainingDependencyCounts;
+		// The remaining dependency count for each operation id, negative until the operation is first reached
+		std::vector<int32_t> RemainingDependencyCounts;
+
+		// The estimated time in microseconds to run each operation and the longest chain of operations that depend on it
+		std::vector<int64_t> CriticalPathTimes;
 
 		bool LookupLoaded;
 		std::unordered_map<FileId, std::set<OperationId>> InputFileLookup;
 		std::unordered_map<FileId, OperationId> OutputFileLookup;
 
+		/// <summary>
+		/// Calculate the critical path time for each operation from the wall time of its last run,
+		/// operations that have not been run before are estimated with the average of those that have
+		/// </summary>
+		void LoadCriticalPathTimes()
+		{
+			auto operationIdLimit = CompactOperationGraph.GetOperationIdLimit();
+			auto durations = std::vector<int64_t>(operationIdLimit, -1);
+			int64_t totalDuration = 0;
+			int64_t knownCount = 0;
+			for (const auto& [operationId, result] : OperationResults.GetResults())
+			{
+				auto duration = result.EvaluateDuration.count();
+				if (operationId < operationIdLimit && CompactOperationGraph.HasOperation(operationId) && duration > 0)
+				{
+					durations[operationId] = duration;
+					totalDuration += duration;
+					knownCount++;
+				}
+			}
+
+			auto defaultDuration = knownCount > 0 ? totalDuration / knownCount : 0;
+
+			// Walk the graph depth first so each operation is finished after all of its children
+			const int64_t NotVisited = -1;
+			const int64_t InProgress = -2;
+			CriticalPathTimes = std::vector<int64_t>(operationIdLimit, NotVisited);
+			auto pending = std::vector<std::pair<OperationId, size_t>>();
+			for (OperationId rootId = 0; rootId < operationIdLimit; rootId++)
+			{
+				if (!CompactOperationGraph.HasOperation(rootId) || CriticalPathTimes[rootId] != NotVisited)
+					continue;
+
+				CriticalPathTimes[rootId] = InProgress;
+				pending.emplace_back(rootId, 0);
+				while (!pending.empty())
+				{
+					auto operationId = pending.back().first;
+					auto children = CompactOperationGraph.GetChildren(operationId);
+					auto childIndex = pending.back().second++;
+					if (childIndex < children.size())
+					{
+						auto childId = children[childIndex];
+						if (CriticalPathTimes[childId] == NotVisited)
+						{
+							CriticalPathTimes[childId] = InProgress;
+							pending.emplace_back(childId, 0);
+						}
+					}
+					else
+					{
+						int64_t longestChildTime = 0;
+						for (auto childId : children)
+							longestChildTime = std::max(longestChildTime, CriticalPathTimes[childId]);
+
+						auto duration = durations[operationId] >= 0 ? durations[operationId] : defaultDuration;
+						CriticalPathTimes[operationId] = duration + longestChildTime;
+						pending.pop_back();
+					}
+				}
+			}
+		}
+
 		void EnsureOperationLookupLoaded()
 		{
 			if (LookupLoaded)
 				return;
 
-			for (auto& operation : OperationGraph.GetOperations())
+			for (OperationId operationId = 0; operationId < CompactOperationGraph.GetOperationIdLimit(); operationId++)
 			{
-				auto& operationInfo = operation.second;
+				if (!CompactOperationGraph.HasOperation(operationId))
+					continue;
 
-				for (auto fileId : operationInfo.DeclaredInput)
+				for (auto fileId : CompactOperationGraph.GetDeclaredInput(operationId))
 				{
 					auto findResult = InputFileLookup.find(fileId);
 					if (findResult != InputFileLookup.end())
 					{
-						findResult->second.insert(operationInfo.Id);
+						findResult->second.insert(operationId);
 					}
 					else
 					{
 						auto [insertIterator, wasInserted] = InputFileLookup.emplace(
 							fileId,
 							std::set<OperationId>());
-						insertIterator->second.insert(operationInfo.Id);
+						insertIterator->second.insert(operationId);
 					}
 				}
 
-				for (auto fileId : operationInfo.DeclaredOutput)
+				for (auto fileId : CompactOperationGraph.GetDeclaredOutput(operationId))
 				{
-					OutputFileLookup.emplace(fileId, operationInfo.Id);
+					OutputFileLookup.emplace(fileId, operationId);
 				}
 			}
 
@@ -115,37 +191,69 @@ namespace Soup::Core
 	export class BuildEvaluateEngine : public IEvaluateEngine
 	{
 	private:
+		// The start time for a result that did not run a process, none of its inputs were written while it ran
+		static constexpr auto NoProcessStartTime = std::chrono::time_point<std::chrono::file_clock>::max();
+
 		bool _forceRebuild;
 		bool _disableMonitor;
 		bool _partialMonitor;
+		bool _useContentHash;
+		uint32_t _maxJobs;
+		size_t _maxOutputBufferSize;
 
 		// Shared Runtime State
 		FileSystemState& _fileSystemState;
 		BuildHistoryChecker _stateChecker;
+		BuildStateLock* _stateLock;
+		ActionCache* _actionCache;
+
+		// The resource pools and memory budget are shared between all evaluations so the limits apply to the entire build
+		OperationResourceTracker _resourceTracker;
+
+		// The workers are shared between all evaluations so parallel package builds stay within the max jobs
+		// Note: Declared after the resource tracker that the workers use so they are joined first
+		std::unique_ptr<OperationWorkerPool> _workerPool;
 
 	public:
 		/// <summary>
 		/// Initializes a new instance of the <see cref="BuildEvaluateEngine"/> class.
+		/// When a state lock is provided the caller must hold it during evaluate and it will be released
+		/// while waiting on operation processes.
+		/// When an action cache is provided the outputs of operations that must run are restored from it when possible.
 		/// </summary>
 		BuildEvaluateEngine(
-			bool forceRebuild,
-			bool disableMonitor,
-			bool partialMonitor,
-			FileSystemState& fileSystemState) :
-			_forceRebuild(forceRebuild),
-			_disableMonitor(disableMonitor),
-			_partialMonitor(partialMonitor),
+			const BuildEvaluateOptions& options,
+			FileSystemState& fileSystemState,
+			BuildStateLock* stateLock,
+			ActionCache* actionCache) :
+			_forceRebuild(options.ForceRebuild),
+			_disableMonitor(options.DisableMonitor),
+			_partialMonitor(options.PartialMonitor),
+			_useContentHash(options.ContentHash),
+			_maxJobs(options.MaxJobs),
+			_maxOutputBufferSize(options.MaxOutputBufferSize),
 			_fileSystemState(fileSystemState),
-			_stateChecker(fileSystemState)
+			_stateChecker(fileSystemState),
+			_stateLock(stateLock),
+			_actionCache(actionCache),
+			_resourceTracker(options.ResourcePoolLimits, options.MaxJobs, options.MemoryBudget),
+			_workerPool()
 		{
+			if (_maxJobs == 0)
+				throw std::runtime_error("The maximum number of jobs must be at least one");
+
+			// Only spin up worker threads when we are allowed to run more than one operation at a time
+			if (_maxJobs > 1)
+				_workerPool = std::make_unique<OperationWorkerPool>(_maxJobs, _resourceTracker);
 		}
 
 		/// <summary>
 		/// Execute the entire operation graph that is referenced by this build evaluate engine
 		/// </summary>
 		bool Evaluate(
-			const OperationGraph& operationGraph,
+			const CompactOperationGraph& operationGraph,
 			OperationResults& operationResults,
+			OperationResultsJournal* operationResultsJournal,
 			const Path& temporaryDirectory,
 			const std::vector<Path>& globalAllowedReadAccess,
 			const std::vector<Path>& globalAllowedWriteAccess) override
@@ -155,13 +263,12 @@ namespace Soup::Core
 			auto evaluateState = BuildEvaluateState(
 				operationGraph,
 				operationResults,
+				operationResultsJournal,
 				temporaryDirectory,
 				globalAllowedReadAccess,
 				globalAllowedWriteAccess);
 
-			auto result = CheckExecuteOperations(
-				evaluateState,
-				operationGraph.GetRootOperationIds());
+			auto result = CheckExecuteOperations(evaluateState);
 			Log::Diag("Build evaluation end");
 
 			return result;
@@ -169,44 +276,182 @@ namespace Soup::Core
 
 	private:
 		/// <summary>
-		/// Execute the collection of build operations
+		/// Execute the collection of build operations, keeping up to the max jobs processes in flight
 		/// </summary>
-		bool CheckExecuteOperations(
-			BuildEvaluateState& evaluateState,
-			const std::vector<OperationId>& operations)
+		bool CheckExecuteOperations(BuildEvaluateState& evaluateState)
 		{
+			// The ready operations with the longest remaining chain are run first
+			evaluateState.LoadCriticalPathTimes();
+			auto readyOperations = OperationReadyQueue(evaluateState.CriticalPathTimes);
+			QueueReadyOperations(
+				evaluateState,
+				evaluateState.CompactOperationGraph.GetRootOperationIds(),
+				readyOperations);
+
+			// The operations that must run but are waiting for their resource pool or the memory budget
+			auto blockedOperations = OperationReadyQueue(evaluateState.CriticalPathTimes);
+			uint64_t checkedReleaseCount = _resourceTracker.GetReleaseCount();
+
+			auto completion = OperationCompletionQueue();
+
 			bool didAnyEvaluate = false;
-			for (auto operationId : operations)
+			auto activeExecutions = std::vector<std::shared_ptr<OperationExecution>>();
+			std::exception_ptr failure = nullptr;
+			auto canStart = [&](OperationId operationId)
+			{
+				return CanStartOperation(evaluateState, operationId);
+			};
+
+			while (!activeExecutions.empty() || (failure == nullptr && (!readyOperations.IsEmpty() || !blockedOperations.IsEmpty())))
 			{
+				try
+				{
+					// Resources are only released when an execution completes in any of the parallel builds
+					// so the blocked operations are only checked again after a release
+					auto releaseCount = _resourceTracker.GetReleaseCount();
+					OperationId blockedOperationId = 0;
+					bool startBlocked = false;
+					if (failure == nullptr && releaseCount != checkedReleaseCount && activeExecutions.size() < _maxJobs &&
+						!blockedOperations.IsEmpty())
+					{
+						startBlocked = blockedOperations.TryPop(canStart, blockedOperationId);
+						if (!startBlocked)
+							checkedReleaseCount = releaseCount;
+					}
+
+					if (startBlocked)
+					{
+						auto& operationInfo = evaluateState.CompactOperationGraph.GetOperationInfo(blockedOperationId);
+						StartExecution(evaluateState, operationInfo, completion, readyOperations, activeExecutions);
+					}
+					else if (failure == nullptr && !readyOperations.IsEmpty() && activeExecutions.size() < _maxJobs)
+					{
+						auto operationId = readyOperations.Pop();
+						auto& operationInfo = evaluateState.CompactOperationGraph.GetOperationInfo(operationId);
+
+						if (!CheckOperationRequiresBuild(evaluateState, operationInfo))
+						{
+							Log::Info(operationInfo.Title);
+							QueueReadyOperations(evaluateState, evaluateState.CompactOperationGraph.GetChildren(operationInfo.Id), readyOperations);
+							continue;
+						}
+
+						didAnyEvaluate = true;
+						LogExecuteOperation(operationInfo);
+
+						// Check for special in-process write operations
+						if (operationInfo.Command.Executable == Path("./writefile.exe"))
+						{
+							auto operationResult = OperationResult();
+							ExecuteWriteFileOperation(
+								operationInfo,
+								operationResult);
+							KeepPreviousRunStatistics(evaluateState, operationInfo.Id, operationResult);
+							CompleteOperation(evaluateState, operationInfo, std::move(operationResult), NoProcessStartTime, readyOperations);
+							continue;
+						}
+
+						// Check if the outputs from a previous run with the same input content can be reused
+						if (_actionCache != nullptr && !_forceRebuild)
+						{
+							auto operationResult = OperationResult();
+							if (_actionCache->TryRestore(operationInfo.Command, operationResult))
+							{
+								Log::Info("Restored from action cache");
+								KeepPreviousRunStatistics(evaluateState, operationInfo.Id, operationResult);
+								CompleteOperation(evaluateState, operationInfo, std::move(operationResult), NoProcessStartTime, readyOperations);
+								continue;
+							}
+						}
+
+						// Wait for the resources to be released by the active operations
+						if (!canStart(operationInfo.Id))
+						{
+							Log::Diag("Waiting for resources");
+							blockedOperations.Push(operationInfo.Id);
+							checkedReleaseCount = releaseCount;
+							continue;
+						}
+
+						StartExecution(evaluateState, operationInfo, completion, readyOperations, activeExecutions);
+					}
+					else if (activeExecutions.empty())
+					{
+						// The blocked operations are waiting on resources held by a parallel package build,
+						// wait for it to release them without holding the shared state
+						auto release = BuildStateLock::ScopedRelease(_stateLock);
+						_resourceTracker.WaitForRelease(checkedReleaseCount);
+					}
+					else
+					{
+						// Wait for the next in flight operation to finish or report output before scheduling more work
+						auto execution = std::shared_ptr<OperationExecution>();
+						{
+							auto release = BuildStateLock::ScopedRelease(_stateLock);
+							execution = completion.WaitForCompletedOrOutput();
+						}
+
+						// The output arrives on the monitor threads and is only logged while holding the shared state
+						for (auto& activeExecution : activeExecutions)
+						{
+							if (activeExecution->Output != nullptr)
+								activeExecution->Output->LogQueuedLines();
+						}
+
+						if (execution != nullptr)
+						{
+							std::erase(activeExecutions, execution);
+							CompleteExecution(evaluateState, *execution, readyOperations);
+						}
+					}
+				}
+				catch (...)
+				{
+					// Stop scheduling new work and let the in flight operations finish
+					// so their results are saved, then report the first failure
+					if (failure == nullptr)
+						failure = std::current_exception();
+				}
+			}
+
+			if (failure != nullptr)
+				std::rethrow_exception(failure);
+
+			return didAnyEvaluate;
+		}
+
+		/// <summary>
+		/// Decrement the remaining dependency count for each operation and queue those that are ready to run
+		/// </summary>
+		void QueueReadyOperations(
+			BuildEvaluateState& evaluateState,
+			std::span<const OperationId> operations,
+			OperationReadyQueue& readyOperations)
+		{
+			// Walk in reverse so the first operation is run first when there is no difference in critical path
+			for (auto i = operations.size(); i > 0; i--)
+			{
+				auto operationId = operations[i - 1];
+
 				// Check if the operation was already a child from a different path
 				// Only run the operation when all of its dependencies have completed
-				auto& operationInfo = evaluateState.OperationGraph.GetOperationInfo(operationId);
-				auto currentOperationSearch = evaluateState.RemainingDependencyCounts.find(operationId);
+				auto dependencyCount = evaluateState.CompactOperationGraph.GetDependencyCount(operationId);
+				auto& currentRemainingCount = evaluateState.RemainingDependencyCounts[operationId];
 				int32_t remainingCount = -1;
-				if (currentOperationSearch != evaluateState.RemainingDependencyCounts.end())
+				if (currentRemainingCount >= 0)
 				{
-					remainingCount = --currentOperationSearch->second;
+					remainingCount = --currentRemainingCount;
 				}
 				else
 				{
 					// Get the cached total count and store the active count in the lookup
-					remainingCount = operationInfo.DependencyCount - 1;
-					auto insertResult = evaluateState.RemainingDependencyCounts.emplace(operationId, remainingCount);
-					if (!insertResult.second)
-						throw std::runtime_error("The operation id already existed in the remaining count lookup");
+					remainingCount = dependencyCount - 1;
+					currentRemainingCount = remainingCount;
 				}
 
 				if (remainingCount == 0)
 				{
-					// Run the single operation
-					didAnyEvaluate |= CheckExecuteOperation(
-						evaluateState,
-						operationInfo);
-					
-					// Recursively build all of the operation children
-					didAnyEvaluate |= CheckExecuteOperations(
-						evaluateState,
-						operationInfo.Children);
+					readyOperations.Push(operationId);
 				}
 				else if (remainingCount < 0)
 				{
@@ -217,17 +462,17 @@ namespace Soup::Core
 					// This operation will be executed from a different path
 				}
 			}
-
-			return didAnyEvaluate;
 		}
 
 		/// <summary>
-		/// Check if an individual operation has been run and execute if required
+		/// Check if an individual operation has been run and must be executed again
 		/// </summary>
-		bool CheckExecuteOperation(
+		bool CheckOperationRequiresBuild(
 			BuildEvaluateState& evaluateState,
 			const OperationInfo& operationInfo)
 		{
+			auto span = BuildTraceSpan("CheckOperation", "Evaluate", operationInfo.Title);
+
 			// Check if each source file is out of date and requires a rebuild
 			Log::Diag("Check for previous operation invocation");
 
@@ -254,7 +499,10 @@ namespace Soup::Core
 
 				// Perform the incremental build checks
 				if (executableOutOfDate ||
-					_stateChecker.IsOutdated(previousResult->ObservedOutput, previousResult->ObservedInput))
+					_stateChecker.IsOutdated(
+						previousResult->ObservedOutput,
+						previousResult->ObservedInput,
+						previousResult->ObservedInputHashes))
 				{
 					buildRequired = true;
 				}
@@ -278,49 +526,201 @@ namespace Soup::Core
 				buildRequired = true;
 			}
 
-			if (buildRequired)
-			{
-				Log::HighPriority(operationInfo.Title);
-				auto messageBuilder = std::stringstream();
-				messageBuilder << "Execute: [" << operationInfo.Command.WorkingDirectory.ToString() << "] ";
-				messageBuilder << operationInfo.Command.Executable.ToString();
-				for (auto& argument : operationInfo.Command.Arguments)
-					messageBuilder << " " << argument;
+			return buildRequired;
+		}
 
-				Log::Diag(messageBuilder.str());
+		/// <summary>
+		/// Check if the operation fits within the resources that are not held by the active operations
+		/// of all parallel package builds
+		/// </summary>
+		bool CanStartOperation(
+			BuildEvaluateState& evaluateState,
+			OperationId operationId)
+		{
+			auto& operationInfo = evaluateState.CompactOperationGraph.GetOperationInfo(operationId);
+			return _resourceTracker.CanStart(operationInfo, GetExpectedMemoryUsage(evaluateState, operationId));
+		}
 
-				auto operationResult = OperationResult();
+		/// <summary>
+		/// Get the peak memory the operation used on its last run, or a default share of the memory budget
+		/// if it has not been measured
+		/// </summary>
+		uint64_t GetExpectedMemoryUsage(
+			BuildEvaluateState& evaluateState,
+			OperationId operationId)
+		{
+			OperationResult* previousResult;
+			if (evaluateState.OperationResults.TryFindResult(operationId, previousResult) &&
+				previousResult->PeakMemoryUsage > 0)
+			{
+				return previousResult->PeakMemoryUsage;
+			}
+			else
+			{
+				auto& operationInfo = evaluateState.CompactOperationGraph.GetOperationInfo(operationId);
+				return _resourceTracker.GetDefaultMemoryUsage(operationInfo);
+			}
+		}
 
-				// Check for special in-process write operations
-				if (operationInfo.Command.Executable == Path("./writefile.exe"))
-				{
-					ExecuteWriteFileOperation(
-						operationInfo,
-						operationResult);
-				}
-				else
+		/// <summary>
+		/// Start the monitored process for an operation, its resources are only reserved while the process runs
+		/// </summary>
+		void StartExecution(
+			BuildEvaluateState& evaluateState,
+			const OperationInfo& operationInfo,
+			OperationCompletionQueue& completion,
+			OperationReadyQueue& readyOperations,
+			std::vector<std::shared_ptr<OperationExecution>>& activeExecutions)
+		{
+			auto execution = StartOperation(
+				evaluateState.TemporaryDirectory,
+				evaluateState.GlobalAllowedReadAccess,
+				evaluateState.GlobalAllowedWriteAccess,
+				operationInfo);
+			execution->ReservedMemoryUsage = GetExpectedMemoryUsage(evaluateState, operationInfo.Id);
+
+			// The start time is only needed to verify the input content hashes
+			if (_useContentHash)
+				execution->StartTime = System::ISystem::Current().GetCurrentTime();
+
+			if (_workerPool != nullptr)
+			{
+				// Wake up the owner to log the output as it arrives
+				if (execution->Output != nullptr)
+					execution->Output->SetLinesQueuedCallback([&completion]() { completion.NotifyOutput(); });
+
+				// The worker reserves the resources when it takes the execution and releases them when it exits
+				activeExecutions.push_back(execution);
+				_workerPool->Queue(std::move(execution), completion);
+			}
+			else
+			{
+				_resourceTracker.Start(operationInfo, execution->ReservedMemoryUsage);
 				{
-					ExecuteOperation(
-						evaluateState.TemporaryDirectory,
-						evaluateState.GlobalAllowedReadAccess,
-						evaluateState.GlobalAllowedWriteAccess,
-						operationInfo,
-						operationResult);
+					auto release = BuildStateLock::ScopedRelease(_stateLock);
+					execution->Run();
 				}
 
-				// Ensure there are no new dependencies
-				VerifyObservedState(evaluateState, operationInfo, operationResult);
+				_resourceTracker.Complete(operationInfo, execution->ReservedMemoryUsage);
 
-				evaluateState.OperationResults.AddOrUpdateOperationResult(
-					operationInfo.Id,
-					std::move(operationResult));
+				CompleteExecution(evaluateState, *execution, readyOperations);
 			}
-			else
+		}
+
+		void LogExecuteOperation(const OperationInfo& operationInfo)
+		{
+			Log::HighPriority(operationInfo.Title);
+			auto messageBuilder = std::stringstream();
+			messageBuilder << "Execute: [" << operationInfo.Command.WorkingDirectory.ToString() << "] ";
+			messageBuilder << operationInfo.Command.Executable.ToString();
+			for (auto& argument : operationInfo.Command.Arguments)
+				messageBuilder << " " << argument;
+
+			Log::Diag(messageBuilder.str());
+		}
+
+		/// <summary>
+		/// Finish a process execution and record the result
+		/// </summary>
+		void CompleteExecution(
+			BuildEvaluateState& evaluateState,
+			OperationExecution& execution,
+			OperationReadyQueue& readyOperations)
+		{
+			// Surface any failure from the worker on the owning thread
+			if (execution.Exception != nullptr)
+				std::rethrow_exception(execution.Exception);
+
+			auto operationResult = OperationResult();
+			ProcessOperationResult(
+				execution,
+				operationResult);
+
+			// The plain process does not report its memory usage, keep the last measurement
+			if (execution.Output == nullptr)
 			{
-				Log::Info(operationInfo.Title);
+				OperationResult* previousResult;
+				if (evaluateState.OperationResults.TryFindResult(execution.Operation.Id, previousResult))
+					operationResult.PeakMemoryUsage = previousResult->PeakMemoryUsage;
 			}
 
-			return buildRequired;
+			CompleteOperation(evaluateState, execution.Operation, std::move(operationResult), execution.StartTime, readyOperations);
+
+			// Share the outputs with future runs of the same command
+			OperationResult* completedResult;
+			if (_actionCache != nullptr &&
+				evaluateState.OperationResults.TryFindResult(execution.Operation.Id, completedResult))
+			{
+				_actionCache->Store(execution.Operation.Command, *completedResult);
+			}
+		}
+
+		/// <summary>
+		/// Keep the run time and peak memory from the last run of the process for a result that did not run it,
+		/// otherwise restoring from the action cache would reset the estimates used to schedule future builds
+		/// </summary>
+		void KeepPreviousRunStatistics(
+			BuildEvaluateState& evaluateState,
+			OperationId operationId,
+			OperationResult& operationResult)
+		{
+			OperationResult* previousResult;
+			if (evaluateState.OperationResults.TryFindResult(operationId, previousResult))
+			{
+				operationResult.EvaluateDuration = previousResult->EvaluateDuration;
+				operationResult.PeakMemoryUsage = previousResult->PeakMemoryUsage;
+			}
+		}
+
+		/// <summary>
+		/// Verify and save the result of a completed operation and queue up any children that are now ready
+		/// </summary>
+		void CompleteOperation(
+			BuildEvaluateState& evaluateState,
+			const OperationInfo& operationInfo,
+			OperationResult operationResult,
+			std::chrono::time_point<std::chrono::file_clock> startTime,
+			OperationReadyQueue& readyOperations)
+		{
+			// Ensure there are no new dependencies
+			VerifyObservedState(evaluateState, operationInfo, operationResult);
+
+			// Snapshot the input contents to allow future builds to ignore inputs that are written without change
+			if (_useContentHash)
+				operationResult.ObservedInputHashes = GetObservedInputHashes(operationResult.ObservedInput, startTime);
+
+			auto& savedResult = evaluateState.OperationResults.AddOrUpdateOperationResult(
+				operationInfo.Id,
+				std::move(operationResult));
+
+			// Keep the progress if the build is interrupted before the results are saved
+			if (evaluateState.OperationResultsJournal != nullptr)
+				evaluateState.OperationResultsJournal->Append(operationInfo.Id, savedResult);
+
+			QueueReadyOperations(evaluateState, evaluateState.CompactOperationGraph.GetChildren(operationInfo.Id), readyOperations);
+		}
+
+		/// <summary>
+		/// Hash the inputs once the operation has completed. An input that was written after the operation started
+		/// may not match the content the process read, its hash is left as zero so the next build falls back to the
+		/// write time check for it
+		/// </summary>
+		std::vector<uint64_t> GetObservedInputHashes(
+			const std::vector<FileId>& inputFiles,
+			std::chrono::time_point<std::chrono::file_clock> startTime)
+		{
+			auto result = std::vector<uint64_t>();
+			result.reserve(inputFiles.size());
+			for (auto inputFile : inputFiles)
+			{
+				auto lastWriteTime = _fileSystemState.GetLastWriteTime(inputFile);
+				if (lastWriteTime.has_value() && lastWriteTime.value() > startTime)
+					result.push_back(0);
+				else
+					result.push_back(_fileSystemState.GetContentHash(inputFile).value_or(0));
+			}
+
+			return result;
 		}
 
 		/// <summary>
@@ -363,16 +763,17 @@ namespace Soup::Core
 		}
 
 		/// <summary>
-		/// Execute a single build operation
+		/// Setup the monitored process for a single build operation
 		/// </summary>
-		void ExecuteOperation(
+		std::shared_ptr<OperationExecution> StartOperation(
 			const Path& temporaryDirectory,
 			const std::vector<Path>& globalAllowedReadAccess,
 			const std::vector<Path>& globalAllowedWriteAccess,
-			const OperationInfo& operationInfo,
-			OperationResult& operationResult)
+			const OperationInfo& operationInfo)
 		{
-			auto monitor = std::make_shared<SystemAccessTracker>();
+			auto span = BuildTraceSpan("StartMonitor", "Monitor", operationInfo.Title);
+
+			auto monitor = std::make_shared<SystemAccessTracker>(operationInfo.Command.WorkingDirectory);
 
 			// Add the temp folder to the environment
 			auto environment = std::map<std::string, std::string>();
@@ -400,6 +801,7 @@ namespace Soup::Core
 			for (auto& file : allowedWriteAccess)
 				Log::Diag(file.ToString());
 
+			std::shared_ptr<OperationOutputSink> output = nullptr;
 			std::shared_ptr<System::IProcess> process = nullptr;
 			if (_disableMonitor)
 			{
@@ -411,78 +813,108 @@ namespace Soup::Core
 			}
 			else
 			{
+				// Stream the output as it arrives, anything past the buffer size is spilled to the temp folder
+				output = std::make_shared<OperationOutputSink>(
+					operationInfo.Title,
+					_maxOutputBufferSize,
+					temporaryDirectory,
+					std::format("Operation{}.output.txt", operationInfo.Id));
+
 				process = Monitor::IMonitorProcessManager::Current().CreateMonitorProcess(
 					operationInfo.Command.Executable,
 					operationInfo.Command.Arguments,
 					operationInfo.Command.WorkingDirectory,
 					environment,
 					monitor,
+					output,
 					enableAccessChecks,
 					_partialMonitor,
 					std::move(allowedReadAccess),
 					std::move(allowedWriteAccess));
 			}
 
-			process->Start();
-			process->WaitForExit();
+			return std::make_shared<OperationExecution>(
+				operationInfo,
+				std::move(monitor),
+				std::move(output),
+				std::move(process));
+		}
+
+		/// <summary>
+		/// Process the output of a single build operation that has exited
+		/// </summary>
+		void ProcessOperationResult(
+			OperationExecution& execution,
+			OperationResult& operationResult)
+		{
+			auto& operationInfo = execution.Operation;
+			auto& process = execution.Process;
+			auto& monitor = execution.Monitor;
+
+			auto span = BuildTraceSpan("VerifyResult", "Monitor", operationInfo.Title);
 
-			auto stdOut = process->GetStandardOutput();
-			auto stdErr = process->GetStandardError();
 			auto exitCode = process->GetExitCode();
 
 			// Check the result of the monitor
 			monitor->VerifyResult();
 
-			if (!stdOut.empty())
+			if (execution.Output != nullptr)
 			{
-				// Upgrade output to a warning if the command fails
+				// The output was logged as it arrived, repeat the standard output as a warning if the command fails
+				auto& output = *execution.Output;
+				output.Flush();
 				if (exitCode != 0)
-					Log::Warning(stdOut);
-				else
-					Log::Info(stdOut);
+				{
+					if (!output.GetStandardOutput().empty())
+						Log::Warning(output.GetStandardOutput());
+					if (output.GetSpilledSize() > 0)
+						Log::Warning("Output truncated, remaining {} bytes written to {}", output.GetSpilledSize(), output.GetSpillFile().ToString());
+				}
 			}
-
-			// If there was any error output then the build failed
-			// TODO: Find warnings + errors
-			if (!stdErr.empty())
+			else
 			{
-				Log::Error(stdErr);
-			}
+				auto stdOut = process->GetStandardOutput();
+				auto stdErr = process->GetStandardError();
 
-			if (exitCode == 0)
-			{
-				// Save off the build graph for future builds
-				auto input = std::vector<Path>();
-				for (auto& value : monitor->GetInput())
+				if (!stdOut.empty())
 				{
-					auto path = Path::Parse(value);
-					#ifdef TRACE_FILE_SYSTEM_STATE
-						Log::Diag("ObservedInput: {}", path.ToString());
-					#endif
-					input.push_back(std::move(path));
+					// Upgrade output to a warning if the command fails
+					if (exitCode != 0)
+						Log::Warning(stdOut);
+					else
+						Log::Info(stdOut);
 				}
 
-				auto output = std::vector<Path>();
-				for (auto& value : monitor->GetOutput())
+				// If there was any error output then the build failed
+				// TODO: Find warnings + errors
+				if (!stdErr.empty())
 				{
-					auto path = Path::Parse(value);
-					#ifdef TRACE_FILE_SYSTEM_STATE
-						Log::Diag("ObservedOutput: {}", path.ToString());
-					#endif
-					output.push_back(std::move(path));
+					Log::Error(stdErr);
 				}
+			}
 
-				operationResult.ObservedInput = _fileSystemState.ToFileIds(
-					input,
-					operationInfo.Command.WorkingDirectory);
-				operationResult.ObservedOutput = _fileSystemState.ToFileIds(
-					output,
-					operationInfo.Command.WorkingDirectory);
+			if (exitCode == 0)
+			{
+				// Save off the build graph for future builds
+				operationResult.ObservedInput = monitor->GetInput(_fileSystemState);
+				operationResult.ObservedOutput = monitor->GetOutput(_fileSystemState);
+
+				#ifdef TRACE_FILE_SYSTEM_STATE
+				for (auto fileId : operationResult.ObservedInput)
+					Log::Diag("ObservedInput: {}", _fileSystemState.GetFilePath(fileId).ToString());
+				for (auto fileId : operationResult.ObservedOutput)
+					Log::Diag("ObservedOutput: {}", _fileSystemState.GetFilePath(fileId).ToString());
+				#endif
 
 				// Mark this operation as successful to enable future incremental builds
 				operationResult.WasSuccessfulRun = true;
 				operationResult.EvaluateTime = System::ISystem::Current().GetCurrentTime();
 
+				// Keep the cost of the run to prioritize the longest chains in future builds
+				operationResult.EvaluateDuration = execution.Duration;
+				if (execution.Output != nullptr)
+					operationResult.PeakMemoryUsage = execution.Output->GetPeakMemoryUsage();
+
 				// Ensure the File System State is notified of any output files that have changed
 				_fileSystemState.InvalidateFileWriteTimes(operationResult.ObservedOutput);
 			}
@@ -517,7 +949,7 @@ namespace Soup::Core
 						!matchedInputOperationIds->contains(operationInfo.Id))
 					{
 						auto filePath = _fileSystemState.GetFilePath(fileId);
-						auto& existingOperation = evaluateState.OperationGraph.GetOperationInfo(matchedOutputOperationId);
+						auto& existingOperation = evaluateState.CompactOperationGraph.GetOperationInfo(matchedOutputOperationId);
 						auto message = std::format(
 							"File \"{}\" observed as input for operation \"{}\" was written to by operation \"{}\" and must be declared as input",
 							filePath.ToString(),
@@ -532,8 +964,8 @@ namespace Soup::Core
 			for (auto fileId : operationResult.ObservedOutput)
 			{
 				// Ensure the file is not also an output
-				auto findObservedInput = std::find(operationResult.ObservedInput.begin(), operationResult.ObservedInput.end(), fileId);
-				if (findObservedInput != operationResult.ObservedInput.end())
+				auto findObservedInput = std::lower_bound(operationResult.ObservedInput.begin(), operationResult.ObservedInput.end(), fileId);
+				if (findObservedInput != operationResult.ObservedInput.end() && *findObservedInput == fileId)
 				{
 					auto filePath = _fileSystemState.GetFilePath(fileId);
 					Log::Warning("File \"{}\" observed as both input and output for operation \"{}\"", filePath.ToString(), operationInfo.Title);
@@ -548,7 +980,7 @@ namespace Soup::Core
 					if (matchedOutputOperationId != operationInfo.Id)
 					{
 						auto filePath = _fileSystemState.GetFilePath(fileId);
-						auto& existingOperation = evaluateState.OperationGraph.GetOperationInfo(matchedOutputOperationId);
+						auto& existingOperation = evaluateState.CompactOperationGraph.GetOperationInfo(matchedOutputOperationId);
 						auto message = std::format(
 							"File \"{}\" observed as output for operation \"{}\" was already written by operation \"{}\"",
 							filePath.ToString(),
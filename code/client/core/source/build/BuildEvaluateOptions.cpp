@@ -0,0 +1,61 @@
+﻿// <copyright file="BuildEvaluateOptions.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <map>
+#include <string>
+
+export module Soup.Core:BuildEvaluateOptions;
+
+import :OperationOutputSink;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The set of options that control how the build evaluate engine runs the operations
+	/// </summary>
+	export struct BuildEvaluateOptions
+	{
+		/// <summary>
+		/// Gets or sets a value indicating whether to force a rebuild
+		/// </summary>
+		bool ForceRebuild = false;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to disable monitoring
+		/// </summary>
+		bool DisableMonitor = false;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to enable partial monitoring
+		/// </summary>
+		bool PartialMonitor = false;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to compare input content hashes when the write times are out of date
+		/// </summary>
+		bool ContentHash = false;
+
+		/// <summary>
+		/// Gets or sets the maximum number of operations to run in parallel
+		/// </summary>
+		uint32_t MaxJobs = 1;
+
+		/// <summary>
+		/// Gets or sets the maximum size of operation output to keep in memory to report on failure
+		/// </summary>
+		size_t MaxOutputBufferSize = OperationOutputSink::DefaultMaxBufferSize;
+
+		/// <summary>
+		/// Gets or sets the maximum total weight of operations that can run at once in each named resource pool
+		/// </summary>
+		std::map<std::string, uint32_t> ResourcePoolLimits;
+
+		/// <summary>
+		/// Gets or sets the maximum total peak memory in bytes of the operations that can run at once, zero is unlimited
+		/// </summary>
+		uint64_t MemoryBudget = 0;
+	};
+}
@@ -4,6 +4,7 @@
 
 module;
 
+#include <algorithm>
 #include <chrono>
 #include <vector>
 
@@ -83,6 +84,70 @@ namespace Soup::Core
 			return false;
 		}
 
+		/// <summary>
+		/// Perform a check if the requested target is outdated with
+		/// respect to the input files, an input that was written after the target
+		/// is still considered up to date if its content matches the hash from the last run.
+		/// This allows a rebuild that produces identical output to cut off the downstream operations.
+		/// </summary>
+		bool IsOutdated(
+			const std::vector<FileId>& targetFiles,
+			const std::vector<FileId>& inputFiles,
+			const std::vector<uint64_t>& inputFileHashes)
+		{
+			// Without a matching set of hashes fall back to the write time checks
+			if (inputFileHashes.size() != inputFiles.size())
+				return IsOutdated(targetFiles, inputFiles);
+
+			// If there are no input files then the output can never be outdated
+			if (inputFiles.empty())
+				return false;
+
+			// Find the oldest target
+			auto oldestTargetWriteTime = std::chrono::time_point<std::chrono::file_clock>::max();
+			for (auto& targetFile : targetFiles)
+			{
+				auto targetFileLastWriteTime = _fileSystemState.GetLastWriteTime(targetFile);
+				if (!targetFileLastWriteTime.has_value())
+				{
+					auto targetFilePath = _fileSystemState.GetFilePath(targetFile);
+					Log::Info("Output target does not exist: {}", targetFilePath.ToString());
+					return true;
+				}
+
+				oldestTargetWriteTime = std::min(oldestTargetWriteTime, targetFileLastWriteTime.value());
+			}
+
+			for (auto i = 0u; i < inputFiles.size(); i++)
+			{
+				auto inputFile = inputFiles[i];
+				auto lastWriteTime = _fileSystemState.GetLastWriteTime(inputFile);
+				if (!lastWriteTime.has_value())
+				{
+					// The input was missing
+					auto inputFilePath = _fileSystemState.GetFilePath(inputFile);
+					Log::Info("Input Missing [{}]", inputFilePath.ToString());
+					return true;
+				}
+
+				if (lastWriteTime.value() > oldestTargetWriteTime)
+				{
+					// Only read the file contents when the cheap write time check fails
+					auto contentHash = _fileSystemState.GetContentHash(inputFile);
+					auto inputFilePath = _fileSystemState.GetFilePath(inputFile);
+					if (contentHash != inputFileHashes[i])
+					{
+						Log::Info("Input content altered after target [{}]", inputFilePath.ToString());
+						return true;
+					}
+
+					Log::Diag("Input altered after target with unchanged content [{}]", inputFilePath.ToString());
+				}
+			}
+
+			return false;
+		}
+
 	private:
 		/// <summary>
 		/// Perform a check if the requested target is outdated with
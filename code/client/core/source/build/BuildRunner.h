@@ -6,6 +6,36 @@
 
 namespace Soup::Core
 {
+	/// <summary>
+	/// The scheduling state for a single package that must be built
+	/// </summary>
+	struct PackageBuildNode
+	{
+		PackageBuildNode(
+			const PackageGraph& packageGraph,
+			const PackageInfo& packageInfo) :
+			PackageGraph(packageGraph),
+			PackageInfo(packageInfo),
+			IsLoaded(false),
+			Order(0),
+			Dependencies(),
+			Dependents(),
+			RemainingDependencyCount(0)
+		{
+		}
+
+		const ::Soup::Core::PackageGraph& PackageGraph;
+		const ::Soup::Core::PackageInfo& PackageInfo;
+
+		// The position of the package in a depth first traversal of the dependencies
+		bool IsLoaded;
+		size_t Order;
+
+		std::set<PackageId> Dependencies;
+		std::vector<PackageId> Dependents;
+		size_t RemainingDependencyCount;
+	};
+
 	/// <summary>
 	/// The build runner that knows how to perform the correct build for a recipe
 	/// and all of its development and runtime dependencies
@@ -24,8 +54,10 @@ namespace Soup::Core
 		RecipeCache& _recipeCache;
 		PackageProvider& _packageProvider;
 		IEvaluateEngine& _evaluateEngine;
+		IGenerateEngine* _generateEngine;
 		FileSystemState& _fileSystemState;
 		RecipeBuildLocationManager& _locationManager;
+		BuildStateLock& _stateLock;
 
 		// Mapping from package id to the required information to be used with dependencies parameters
 		std::map<PackageId, RecipeBuildCacheState> _buildCache;
@@ -45,15 +77,48 @@ namespace Soup::Core
 			PackageProvider& packageProvider,
 			IEvaluateEngine& evaluateEngine,
 			FileSystemState& fileSystemState,
-			RecipeBuildLocationManager& locationManager) :
+			RecipeBuildLocationManager& locationManager,
+			BuildStateLock& stateLock) :
+			BuildRunner(
+				arguments,
+				std::move(userDataPath),
+				systemReadAccess,
+				recipeCache,
+				packageProvider,
+				evaluateEngine,
+				nullptr,
+				fileSystemState,
+				locationManager,
+				stateLock)
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildRunner"/> class.
+		/// When a generate engine is provided the generate phase is run within the current process
+		/// instead of launching the generate executable.
+		/// </summary>
+		BuildRunner(
+			const RecipeBuildArguments& arguments,
+			Path userDataPath,
+			const std::vector<Path>& systemReadAccess,
+			RecipeCache& recipeCache,
+			PackageProvider& packageProvider,
+			IEvaluateEngine& evaluateEngine,
+			IGenerateEngine* generateEngine,
+			FileSystemState& fileSystemState,
+			RecipeBuildLocationManager& locationManager,
+			BuildStateLock& stateLock) :
 			_arguments(arguments),
 			_userDataPath(std::move(userDataPath)),
 			_systemReadAccess(systemReadAccess),
 			_recipeCache(recipeCache),
 			_packageProvider(packageProvider),
 			_evaluateEngine(evaluateEngine),
+			_generateEngine(generateEngine),
 			_fileSystemState(fileSystemState),
 			_locationManager(locationManager),
+			_stateLock(stateLock),
 			_buildCache()
 		{
 		}
@@ -63,6 +128,10 @@ namespace Soup::Core
 		/// </summary>
 		void Execute()
 		{
+			// All shared state is owned by the holder of the state lock,
+			// package builds only release it while waiting on operations
+			auto lock = std::unique_lock<BuildStateLock>(_stateLock);
+
 			// TODO: A scoped listener cleanup would be nice
 			try
 			{
@@ -71,7 +140,11 @@ namespace Soup::Core
 				// Enable log event ids to track individual builds
 				auto& packageGraph = _packageProvider.GetRootPackageGraph();
 				auto& packageInfo = _packageProvider.GetPackageInfo(packageGraph.RootPackageId);
-				BuildPackageAndDependencies(packageGraph, packageInfo);
+
+				auto buildNodes = std::map<PackageId, PackageBuildNode>();
+				auto buildOrder = std::vector<PackageId>();
+				LoadPackageBuildGraph(packageGraph, packageInfo, buildNodes, buildOrder);
+				BuildPackages(buildNodes, buildOrder);
 
 				Log::EnsureListener().SetShowEventId(false);
 			}
@@ -84,9 +157,14 @@ namespace Soup::Core
 
 	private:
 		/// <summary>
-		/// Build the dependencies for the provided recipe recursively
+		/// Load the dependencies for the provided recipe recursively into the set of packages to build
+		/// Returns true if the package must be built
 		/// </summary>
-		void BuildPackageAndDependencies(const PackageGraph& packageGraph, const PackageInfo& packageInfo)
+		bool LoadPackageBuildGraph(
+			const PackageGraph& packageGraph,
+			const PackageInfo& packageInfo,
+			std::map<PackageId, PackageBuildNode>& buildNodes,
+			std::vector<PackageId>& buildOrder)
 		{
 			if (packageInfo.IsPrebuilt)
 			{
@@ -108,35 +186,172 @@ namespace Soup::Core
 							{},
 							{}));
 				}
+
+				return false;
 			}
-			else
+
+			// Check if we already reached this package down a different dependency path
+			auto findBuildNode = buildNodes.find(packageInfo.Id);
+			if (findBuildNode != buildNodes.end())
 			{
-				for (auto& [dependencyType, dependencyTypeSet] : packageInfo.Dependencies)
+				if (!findBuildNode->second.IsLoaded)
 				{
-					for (auto& dependency : dependencyTypeSet)
+					throw std::runtime_error(
+						std::format("Circular package dependency: {}", packageInfo.Name.ToString()));
+				}
+
+				return true;
+			}
+
+			auto& buildNode = buildNodes.emplace(
+				packageInfo.Id,
+				PackageBuildNode(packageGraph, packageInfo)).first->second;
+			for (auto& [dependencyType, dependencyTypeSet] : packageInfo.Dependencies)
+			{
+				for (auto& dependency : dependencyTypeSet)
+				{
+					if (dependency.IsSubGraph)
 					{
-						if (dependency.IsSubGraph)
-						{
-							// Load this package recipe
-							auto& dependencyPackageGraph = _packageProvider.GetPackageGraph(dependency.PackageGraphId);
-							auto& dependencyPackageInfo = _packageProvider.GetPackageInfo(dependencyPackageGraph.RootPackageId);
+						// Load this package recipe
+						auto& dependencyPackageGraph = _packageProvider.GetPackageGraph(dependency.PackageGraphId);
+						auto& dependencyPackageInfo = _packageProvider.GetPackageInfo(dependencyPackageGraph.RootPackageId);
+
+						// Load all recursive dependencies
+						if (LoadPackageBuildGraph(dependencyPackageGraph, dependencyPackageInfo, buildNodes, buildOrder))
+							buildNode.Dependencies.insert(dependencyPackageInfo.Id);
+					}
+					else
+					{
+						// Load this package recipe
+						auto& dependencyPackageInfo = _packageProvider.GetPackageInfo(dependency.PackageId);
+
+						// Load all recursive dependencies
+						if (LoadPackageBuildGraph(packageGraph, dependencyPackageInfo, buildNodes, buildOrder))
+							buildNode.Dependencies.insert(dependencyPackageInfo.Id);
+					}
+				}
+			}
+
+			for (auto dependencyId : buildNode.Dependencies)
+			{
+				buildNodes.at(dependencyId).Dependents.push_back(packageInfo.Id);
+			}
+
+			buildNode.RemainingDependencyCount = buildNode.Dependencies.size();
+			buildNode.Order = buildOrder.size();
+			buildNode.IsLoaded = true;
+			buildOrder.push_back(packageInfo.Id);
+
+			return true;
+		}
 
-							// Build all recursive dependencies
-							BuildPackageAndDependencies(dependencyPackageGraph, dependencyPackageInfo);
+		/// <summary>
+		/// Build each package as soon as all of its dependencies have completed, keeping up to the
+		/// max jobs packages in flight. Ready packages are started in depth first order so a single job
+		/// builds in the same order as a recursive traversal.
+		/// </summary>
+		void BuildPackages(
+			std::map<PackageId, PackageBuildNode>& buildNodes,
+			const std::vector<PackageId>& buildOrder)
+		{
+			auto readyPackages = std::set<size_t>();
+			for (auto& [packageId, buildNode] : buildNodes)
+			{
+				if (buildNode.RemainingDependencyCount == 0)
+					readyPackages.insert(buildNode.Order);
+			}
+
+			if (_arguments.MaxJobs <= 1)
+			{
+				while (!readyPackages.empty())
+				{
+					auto& buildNode = buildNodes.at(buildOrder[*readyPackages.begin()]);
+					readyPackages.erase(readyPackages.begin());
+
+					CheckBuildPackage(buildNode.PackageGraph, buildNode.PackageInfo);
+					QueueReadyDependents(buildNodes, buildNode, readyPackages);
+				}
+
+				return;
+			}
+
+			// Each active package build runs on its own thread and hands back its result while holding the state lock
+			auto completedCondition = std::condition_variable_any();
+			auto completedPackages = std::deque<std::pair<PackageId, std::exception_ptr>>();
+			auto workers = std::vector<std::thread>();
+
+			uint32_t activeCount = 0;
+			std::exception_ptr failure = nullptr;
+			while (activeCount > 0 || (failure == nullptr && !readyPackages.empty()))
+			{
+				if (failure == nullptr && !readyPackages.empty() && activeCount < _arguments.MaxJobs)
+				{
+					auto& buildNode = buildNodes.at(buildOrder[*readyPackages.begin()]);
+					readyPackages.erase(readyPackages.begin());
+
+					activeCount++;
+					workers.emplace_back([this, &buildNode, &completedCondition, &completedPackages]()
+					{
+						auto workerLock = std::unique_lock<BuildStateLock>(_stateLock);
+						auto exception = std::exception_ptr();
+						try
+						{
+							CheckBuildPackage(buildNode.PackageGraph, buildNode.PackageInfo);
 						}
-						else
+						catch (...)
 						{
-							// Load this package recipe
-							auto& dependencyPackageInfo = _packageProvider.GetPackageInfo(dependency.PackageId);
-
-							// Build all recursive dependencies
-							BuildPackageAndDependencies(packageGraph, dependencyPackageInfo);
+							exception = std::current_exception();
 						}
+
+						completedPackages.emplace_back(buildNode.PackageInfo.Id, exception);
+						completedCondition.notify_one();
+					});
+				}
+				else
+				{
+					// Release the shared state to the package builds until one of them completes
+					completedCondition.wait(_stateLock, [&completedPackages]() { return !completedPackages.empty(); });
+					auto [packageId, exception] = std::move(completedPackages.front());
+					completedPackages.pop_front();
+					activeCount--;
+
+					if (exception != nullptr)
+					{
+						// Stop scheduling new packages and let the in flight builds finish, then report the first failure
+						if (failure == nullptr)
+							failure = exception;
+					}
+					else
+					{
+						QueueReadyDependents(buildNodes, buildNodes.at(packageId), readyPackages);
 					}
 				}
+			}
+
+			// Every worker has reported back, they no longer need the state lock to finish
+			for (auto& worker : workers)
+			{
+				worker.join();
+			}
 
-				// Build the target recipe
-				CheckBuildPackage(packageGraph, packageInfo);
+			if (failure != nullptr)
+				std::rethrow_exception(failure);
+		}
+
+		/// <summary>
+		/// Decrement the remaining dependency count for each dependent package and queue those that are ready to build
+		/// </summary>
+		void QueueReadyDependents(
+			std::map<PackageId, PackageBuildNode>& buildNodes,
+			const PackageBuildNode& buildNode,
+			std::set<size_t>& readyPackages)
+		{
+			for (auto dependentId : buildNode.Dependents)
+			{
+				auto& dependentNode = buildNodes.at(dependentId);
+				dependentNode.RemainingDependencyCount--;
+				if (dependentNode.RemainingDependencyCount == 0)
+					readyPackages.insert(dependentNode.Order);
 			}
 		}
 
@@ -149,25 +364,17 @@ namespace Soup::Core
 			// TODO: RAII for active id
 			try
 			{
-				Log::SetActiveId(packageInfo.Id);
+				_stateLock.SetActiveId(packageInfo.Id);
 				Log::Diag("Running Build: [{}]{}", packageInfo.Recipe->GetLanguage().GetName(), packageInfo.Name.ToString());
 
-				// Check if we already built this package down a different dependency path
-				if (_buildCache.contains(packageInfo.Id))
-				{
-					Log::Diag("Recipe already built: [{}]{}", packageInfo.Recipe->GetLanguage().GetName(), packageInfo.Name.ToString());
-				}
-				else
-				{
-					// Run the required builds in process
-					RunBuild(packageGraph, packageInfo);
-				}
+				// Run the required builds in process
+				RunBuild(packageGraph, packageInfo);
 
-				Log::SetActiveId(0);
+				_stateLock.SetActiveId(0);
 			}
 			catch(...)
 			{
-				Log::SetActiveId(0);
+				_stateLock.SetActiveId(0);
 				throw;
 			}
 		}
@@ -178,6 +385,7 @@ namespace Soup::Core
 		void RunBuild(const PackageGraph& packageGraph, const PackageInfo& packageInfo)
 		{
 			Log::Info("Build '{}'", packageInfo.Name.ToString());
+			auto span = BuildTraceSpan(packageInfo.Name.ToString(), "Package");
 
 			// Build up the expected output directory for the build to be used to cache state
 			auto macroPackageDirectory = Path(
@@ -211,8 +419,9 @@ namespace Soup::Core
 			auto evaluateGraphFile = soupTargetDirectory + BuildConstants::EvaluateGraphFileName();
 			Log::Info("Checking for existing Evaluate Operation Graph");
 			Log::Diag(evaluateGraphFile.ToString());
-			auto evaluateGraph = OperationGraph();
+			auto evaluateGraph = CompactOperationGraph();
 			auto evaluateResults = OperationResults();
+			auto journaledOperations = std::vector<OperationId>();
 			auto hasExistingGraph = OperationGraphManager::TryLoadState(
 				evaluateGraphFile,
 				evaluateGraph,
@@ -236,17 +445,34 @@ namespace Soup::Core
 				{
 					Log::Info("No previous results found");
 				}
+
+				// Restore the progress from an evaluation that did not finish saving the results
+				auto evaluateResultsJournalFile = soupTargetDirectory + BuildConstants::EvaluateResultsJournalFileName();
+				if (OperationResultsManager::TryLoadJournal(
+					evaluateResultsJournalFile,
+					evaluateResults,
+					journaledOperations,
+					_fileSystemState) &&
+					!journaledOperations.empty())
+				{
+					Log::Info("Restored {} journaled results", journaledOperations.size());
+				}
 			}
 			else
 			{
 				Log::Info("No previous graph found");
 			}
 
+			// The journal must be compacted if the results no longer use the same operation ids
+			bool resultsRemapped = false;
+
 			//////////////////////////////////////////////
 			// GENERATE
 			/////////////////////////////////////////////
 			if (!_arguments.SkipGenerate)
 			{
+				auto generateSpan = BuildTraceSpan(packageInfo.Name.ToString(), "Generate");
+
 				// Ensure the target directories exists
 				if (!System::IFileSystem::Current().Exists(soupTargetDirectory))
 				{
@@ -271,7 +497,7 @@ namespace Soup::Core
 				if (ranGenerate)
 				{
 					Log::Info("Loading new Evaluate Operation Graph");
-					auto updatedEvaluateGraph = OperationGraph();
+					auto updatedEvaluateGraph = CompactOperationGraph();
 					if (!OperationGraphManager::TryLoadState(
 						evaluateGraphFile,
 						updatedEvaluateGraph,
@@ -289,6 +515,7 @@ namespace Soup::Core
 					// Replace the previous operation graph and results
 					evaluateGraph = std::move(updatedEvaluateGraph);
 					evaluateResults = std::move(updatedEvaluateResults);
+					resultsRemapped = true;
 				}
 			}
 
@@ -297,9 +524,12 @@ namespace Soup::Core
 			/////////////////////////////////////////////
 			if (!_arguments.SkipEvaluate)
 			{
+				auto evaluateSpan = BuildTraceSpan(packageInfo.Name.ToString(), "Evaluate");
 				RunEvaluate(
 					evaluateGraph,
 					evaluateResults,
+					journaledOperations,
+					resultsRemapped,
 					realTargetDirectory,
 					soupTargetDirectory);
 			}
@@ -404,8 +634,6 @@ namespace Soup::Core
 			}
 
 			// Run the incremental generate
-			auto generateGraph = OperationGraph();
-
 			// Add the single root operation to perform the generate
 			auto moduleName = System::IProcessManager::Current().GetCurrentProcessFileName();
 			auto generateFolder = moduleName.GetParent();
@@ -418,6 +646,10 @@ namespace Soup::Core
 			#error "Unknown platform"
 			#endif
 
+			// The in-process generate is implemented by the current executable
+			if (_generateEngine != nullptr)
+				generateExecutable = moduleName;
+
 			OperationId generateOperationId = 1;
 			auto generateArguments = std::vector<std::string>();
 			generateArguments.push_back(soupTargetDirectory.ToString());
@@ -433,12 +665,15 @@ namespace Soup::Core
 				{},
 				{});
 			generateOperation.DependencyCount = 1;
-			generateGraph.AddOperation(std::move(generateOperation));
+			auto generateOperations = std::vector<OperationInfo>();
+			generateOperations.push_back(std::move(generateOperation));
 
 			// Set the Generate operation as the root
-			generateGraph.SetRootOperationIds({
-				generateOperationId,
-			});
+			auto generateGraph = CompactOperationGraph(
+				std::vector<OperationId>({
+					generateOperationId,
+				}),
+				std::move(generateOperations));
 
 			// Set Read and Write access fore the generate phase
 			auto generateAllowedReadAccess = std::vector<Path>();
@@ -484,12 +719,25 @@ namespace Soup::Core
 			auto temporaryDirectory = realTargetDirectory + BuildConstants::TemporaryFolderName();
 
 			// Evaluate the Generate phase
-			bool ranEvaluate = _evaluateEngine.Evaluate(
-				generateGraph,
-				generateResults,
-				temporaryDirectory,
-				generateAllowedReadAccess,
-				generateAllowedWriteAccess);
+			bool ranEvaluate = false;
+			if (_generateEngine != nullptr)
+			{
+				ranEvaluate = RunInProcessGenerate(
+					generateGraph.GetOperationInfo(generateOperationId),
+					soupTargetDirectory,
+					inputTable,
+					generateResults);
+			}
+			else
+			{
+				ranEvaluate = _evaluateEngine.Evaluate(
+					generateGraph,
+					generateResults,
+					nullptr,
+					temporaryDirectory,
+					generateAllowedReadAccess,
+					generateAllowedWriteAccess);
+			}
 
 			if (ranEvaluate)
 			{
@@ -500,21 +748,119 @@ namespace Soup::Core
 			return ranEvaluate;
 		}
 
+		/// <summary>
+		/// Run the generate phase within the current process if it is out of date.
+		/// The file access is reported by the generate engine instead of the process monitor.
+		/// Generate runs without the build state lock on its own file system state and a copy of the
+		/// loaded recipes so the other packages can make progress.
+		/// </summary>
+		bool RunInProcessGenerate(
+			const OperationInfo& generateOperation,
+			const Path& soupTargetDirectory,
+			const ValueTable& inputTable,
+			OperationResults& generateResults)
+		{
+			// Check if the generate phase was run before and nothing it observed has changed
+			auto stateChecker = BuildHistoryChecker(_fileSystemState);
+			OperationResult* previousResult;
+			if (generateResults.TryFindResult(generateOperation.Id, previousResult) &&
+				previousResult->WasSuccessfulRun)
+			{
+				auto executableFileId = _fileSystemState.ToFileId(
+					generateOperation.Command.Executable,
+					generateOperation.Command.WorkingDirectory);
+				if (!stateChecker.IsOutdated(previousResult->EvaluateTime, executableFileId) &&
+					!stateChecker.IsOutdated(previousResult->ObservedOutput, previousResult->ObservedInput))
+				{
+					if (!_arguments.ForceRebuild)
+					{
+						Log::Info(generateOperation.Title);
+						Log::Info("Up to date");
+						return false;
+					}
+
+					Log::HighPriority("Up to date: Force Build");
+				}
+			}
+			else
+			{
+				Log::Info("Operation has no successful previous invocation");
+			}
+
+			Log::HighPriority(generateOperation.Title);
+			Log::Diag("Execute InProcess Generate: {}", soupTargetDirectory.ToString());
+
+			auto fileSystemState = FileSystemState();
+			auto recipeCache = _recipeCache;
+			auto input = std::vector<Path>();
+			auto output = std::vector<Path>();
+			try
+			{
+				auto release = BuildStateLock::ScopedRelease(&_stateLock);
+				_generateEngine->Generate(
+					soupTargetDirectory,
+					inputTable,
+					fileSystemState,
+					recipeCache,
+					input,
+					output);
+			}
+			catch (const BuildFailedException&)
+			{
+				throw;
+			}
+			catch (const std::exception& ex)
+			{
+				// Leave the previous state untouched and abandon the build
+				Log::Error(ex.what());
+				throw BuildFailedException();
+			}
+
+			auto operationResult = OperationResult();
+			operationResult.ObservedInput = _fileSystemState.ToFileIds(
+				input,
+				generateOperation.Command.WorkingDirectory);
+			operationResult.ObservedOutput = _fileSystemState.ToFileIds(
+				output,
+				generateOperation.Command.WorkingDirectory);
+
+			// Mark this operation as successful to enable future incremental builds
+			operationResult.WasSuccessfulRun = true;
+			operationResult.EvaluateTime = System::ISystem::Current().GetCurrentTime();
+
+			// Ensure the File System State is notified of any output files that have changed
+			_fileSystemState.InvalidateFileWriteTimes(operationResult.ObservedOutput);
+
+			generateResults.AddOrUpdateOperationResult(
+				generateOperation.Id,
+				std::move(operationResult));
+
+			return true;
+		}
+
 		OperationResults MergeOperationResults(
-			const OperationGraph& previousGraph,
+			const CompactOperationGraph& previousGraph,
 			OperationResults& previousResults,
-			const OperationGraph& updatedGraph)
+			const CompactOperationGraph& updatedGraph)
 		{
+			// The commands are only needed to match up the operations when the graph was generated again
+			auto previousOperationLookup = std::unordered_map<CommandInfo, OperationId>();
+			previousOperationLookup.reserve(previousGraph.GetOperationCount());
+			for (auto& previousOperation : previousGraph.GetOperations())
+			{
+				previousOperationLookup.emplace(previousOperation.Command, previousOperation.Id);
+			}
+
 			auto updatedResults = OperationResults();
-			for (auto& [operationId, updatedOperation] : updatedGraph.GetOperations())
+			for (auto& updatedOperation : updatedGraph.GetOperations())
 			{
 				// Check if the new operation command existing in the previous set too
-				OperationId previousOperationId;
-				if (previousGraph.TryFindOperation(updatedOperation.Command, previousOperationId))
+				auto findPreviousOperation = previousOperationLookup.find(updatedOperation.Command);
+				if (findPreviousOperation != previousOperationLookup.end())
 				{
 					// Check if there is an existing result for the previous operation
 					OperationResult* previousOperationResult;
-					if (previousResults.TryFindResult(previousOperationId, previousOperationResult))
+					if (previousResults.TryFindResult(findPreviousOperation->second, previousOperationResult))
 					{
 						// Move this result into the updated results store
 						updatedResults.AddOrUpdateOperationResult(updatedOperation.Id, std::move(*previousOperationResult));
@@ -526,8 +872,10 @@ namespace Soup::Core
 		}
 
 		void RunEvaluate(
-			const OperationGraph& evaluateGraph,
+			const CompactOperationGraph& evaluateGraph,
 			OperationResults& evaluateResults,
+			const std::vector<OperationId>& journaledOperations,
+			bool resultsRemapped,
 			const Path& realTargetDirectory,
 			const Path& soupTargetDirectory)
 		{
@@ -555,30 +903,24 @@ namespace Soup::Core
 				System::IFileSystem::Current().CreateDirectory(temporaryDirectory);
 			}
 
-			try
-			{
-				// Evaluate the build
-				auto ranEvaluate = _evaluateEngine.Evaluate(
-					evaluateGraph,
-					evaluateResults,
-					temporaryDirectory,
-					allowedReadAccess,
-					allowedWriteAccess);
+			// Append each completed operation to the journal so an interrupted build keeps its progress,
+			// the journal is closed when it goes out of scope on every exit path
+			auto evaluateResultsFile = soupTargetDirectory + BuildConstants::EvaluateResultsFileName();
+			auto evaluateResultsJournalFile = soupTargetDirectory + BuildConstants::EvaluateResultsJournalFileName();
+			auto evaluateResultsJournal = OperationResultsJournal(
+				evaluateResultsFile,
+				evaluateResultsJournalFile,
+				_fileSystemState);
+			evaluateResultsJournal.Open(evaluateResults, journaledOperations, resultsRemapped);
 
-				if (ranEvaluate)
-				{
-					Log::Info("Saving updated build state");
-					auto evaluateResultsFile = soupTargetDirectory + BuildConstants::EvaluateResultsFileName();
-					OperationResultsManager::SaveState(evaluateResultsFile, evaluateResults, _fileSystemState);
-				}
-			}
-			catch(const BuildFailedException&)
-			{
-				Log::Info("Saving partial build state");
-				auto evaluateResultsFile = soupTargetDirectory + BuildConstants::EvaluateResultsFileName();
-				OperationResultsManager::SaveState(evaluateResultsFile, evaluateResults, _fileSystemState);
-				throw;
-			}
+			// Evaluate the build
+			_evaluateEngine.Evaluate(
+				evaluateGraph,
+				evaluateResults,
+				&evaluateResultsJournal,
+				temporaryDirectory,
+				allowedReadAccess,
+				allowedWriteAccess);
 
 			Log::Info("Done");
 		}
@@ -0,0 +1,86 @@
+﻿// <copyright file="BuildStateLock.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// Serializes access to the shared build state (file system state, caches and logging) between
+	/// package builds that are running in parallel. A holder releases the lock while it is blocked
+	/// waiting on external processes so other packages can make progress.
+	/// </summary>
+	export class BuildStateLock
+	{
+	private:
+		std::mutex _mutex;
+		PackageId _activeId;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildStateLock"/> class.
+		/// </summary>
+		BuildStateLock() :
+			_mutex(),
+			_activeId(0)
+		{
+		}
+
+		BuildStateLock(const BuildStateLock&) = delete;
+		BuildStateLock& operator=(const BuildStateLock&) = delete;
+
+		void lock()
+		{
+			_mutex.lock();
+		}
+
+		void unlock()
+		{
+			_mutex.unlock();
+		}
+
+		/// <summary>
+		/// Set the log event id for the current holder of the lock
+		/// </summary>
+		void SetActiveId(PackageId activeId)
+		{
+			_activeId = activeId;
+			Log::SetActiveId(activeId);
+		}
+
+		/// <summary>
+		/// Temporarily release a held lock and restore the active log id once it has been reacquired
+		/// </summary>
+		class ScopedRelease
+		{
+		private:
+			BuildStateLock* _lock;
+			PackageId _activeId;
+
+		public:
+			ScopedRelease(BuildStateLock* lock) :
+				_lock(lock),
+				_activeId(0)
+			{
+				if (_lock != nullptr)
+				{
+					_activeId = _lock->_activeId;
+					_lock->unlock();
+				}
+			}
+
+			ScopedRelease(const ScopedRelease&) = delete;
+			ScopedRelease& operator=(const ScopedRelease&) = delete;
+
+			~ScopedRelease()
+			{
+				if (_lock != nullptr)
+				{
+					_lock->lock();
+					_lock->SetActiveId(_activeId);
+				}
+			}
+		};
+	};
+}
@@ -0,0 +1,262 @@
+﻿// <copyright file="BuildTrace.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+export module Soup.Core:BuildTrace;
+
+import Opal;
+
+using namespace Opal;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// A single completed span of work on the build timeline
+	/// </summary>
+	export struct BuildTraceEvent
+	{
+		std::string Name;
+		std::string Category;
+		std::string Detail;
+		int64_t StartTime;
+		int64_t Duration;
+		uint32_t ThreadId;
+	};
+
+	/// <summary>
+	/// Records the timeline of a build and saves it as Chrome trace event JSON that can be
+	/// opened in chrome://tracing or Perfetto.
+	/// Events are recorded from any thread, each thread is given a small sequential id in the
+	/// order it first reports so the build threads show up as separate tracks.
+	/// </summary>
+	export class BuildTrace
+	{
+	private:
+		static inline std::shared_ptr<BuildTrace> _current = nullptr;
+
+		std::chrono::steady_clock::time_point _startTime;
+		std::mutex _mutex;
+		std::vector<BuildTraceEvent> _events;
+		std::unordered_map<std::thread::id, uint32_t> _threadIds;
+
+	public:
+		/// <summary>
+		/// Get the active trace, null if tracing is disabled
+		/// </summary>
+		static BuildTrace* Current()
+		{
+			return _current.get();
+		}
+
+		/// <summary>
+		/// Register the active trace, must be set before the build starts running
+		/// </summary>
+		static void Register(std::shared_ptr<BuildTrace> trace)
+		{
+			_current = std::move(trace);
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildTrace"/> class.
+		/// </summary>
+		BuildTrace() :
+			_startTime(std::chrono::steady_clock::now()),
+			_mutex(),
+			_events(),
+			_threadIds()
+		{
+		}
+
+		BuildTrace(const BuildTrace&) = delete;
+		BuildTrace& operator=(const BuildTrace&) = delete;
+
+		/// <summary>
+		/// Get the current time in microseconds since the trace started
+		/// </summary>
+		int64_t GetTimestamp() const
+		{
+			return std::chrono::duration_cast<std::chrono::microseconds>(
+				std::chrono::steady_clock::now() - _startTime).count();
+		}
+
+		/// <summary>
+		/// Record a completed span of work for the calling thread
+		/// </summary>
+		void AddEvent(
+			std::string name,
+			std::string category,
+			std::string detail,
+			int64_t startTime,
+			int64_t duration)
+		{
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			auto threadIdResult = _threadIds.emplace(
+				std::this_thread::get_id(),
+				static_cast<uint32_t>(_threadIds.size() + 1));
+			_events.push_back(BuildTraceEvent({
+				std::move(name),
+				std::move(category),
+				std::move(detail),
+				startTime,
+				duration,
+				threadIdResult.first->second,
+			}));
+		}
+
+		/// <summary>
+		/// Get the recorded events
+		/// </summary>
+		std::vector<BuildTraceEvent> GetEvents()
+		{
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			return _events;
+		}
+
+		/// <summary>
+		/// Save the recorded events as Chrome trace event JSON
+		/// </summary>
+		void Save(const Path& traceFile)
+		{
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			auto file = System::IFileSystem::Current().OpenWrite(traceFile, true);
+			auto& stream = file->GetOutStream();
+
+			stream << "{\"traceEvents\":[";
+			bool isFirst = true;
+			for (auto& event : _events)
+			{
+				if (!isFirst)
+					stream << ",";
+				isFirst = false;
+
+				stream << "\n{\"name\":";
+				WriteString(stream, event.Name);
+				stream << ",\"cat\":";
+				WriteString(stream, event.Category);
+				stream << ",\"ph\":\"X\",\"ts\":" << event.StartTime;
+				stream << ",\"dur\":" << event.Duration;
+				stream << ",\"pid\":1,\"tid\":" << event.ThreadId;
+				if (!event.Detail.empty())
+				{
+					stream << ",\"args\":{\"detail\":";
+					WriteString(stream, event.Detail);
+					stream << "}";
+				}
+
+				stream << "}";
+			}
+
+			stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+		}
+
+	private:
+		static void WriteString(std::ostream& stream, std::string_view value)
+		{
+			stream << '"';
+			for (auto character : value)
+			{
+				switch (character)
+				{
+					case '"':
+						stream << "\\\"";
+						break;
+					case '\\':
+						stream << "\\\\";
+						break;
+					case '\n':
+						stream << "\\n";
+						break;
+					case '\r':
+						stream << "\\r";
+						break;
+					case '\t':
+						stream << "\\t";
+						break;
+					default:
+						if (static_cast<unsigned char>(character) < 0x20)
+						{
+							constexpr auto hexDigits = std::string_view("0123456789abcdef");
+							stream << "\\u00" << hexDigits[character >> 4] << hexDigits[character & 0xF];
+						}
+						else
+							stream << character;
+						break;
+				}
+			}
+
+			stream << '"';
+		}
+	};
+
+	/// <summary>
+	/// Records the lifetime of the current scope as a span on the active build trace.
+	/// Nothing is recorded when tracing is disabled.
+	/// </summary>
+	export class BuildTraceSpan
+	{
+	private:
+		BuildTrace* _trace;
+		std::string _name;
+		std::string _category;
+		std::string _detail;
+		int64_t _startTime;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildTraceSpan"/> class.
+		/// </summary>
+		BuildTraceSpan(std::string_view name, std::string_view category) :
+			BuildTraceSpan(name, category, std::string_view())
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildTraceSpan"/> class.
+		/// </summary>
+		BuildTraceSpan(std::string_view name, std::string_view category, std::string_view detail) :
+			_trace(BuildTrace::Current()),
+			_name(),
+			_category(),
+			_detail(),
+			_startTime(0)
+		{
+			// Only pay for the copies when the trace is active
+			if (_trace != nullptr)
+			{
+				_name = name;
+				_category = category;
+				_detail = detail;
+				_startTime = _trace->GetTimestamp();
+			}
+		}
+
+		BuildTraceSpan(const BuildTraceSpan&) = delete;
+		BuildTraceSpan& operator=(const BuildTraceSpan&) = delete;
+
+		~BuildTraceSpan()
+		{
+			if (_trace != nullptr)
+			{
+				auto duration = _trace->GetTimestamp() - _startTime;
+				_trace->AddEvent(
+					std::move(_name),
+					std::move(_category),
+					std::move(_detail),
+					_startTime,
+					duration);
+			}
+		}
+	};
+}
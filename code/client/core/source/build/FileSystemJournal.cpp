@@ -0,0 +1,125 @@
+﻿// <copyright file="FileSystemJournal.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <signal.h>
+#endif
+
+export module Soup.Core:FileSystemJournal;
+
+import Opal;
+
+using namespace Opal;
+
+export namespace Soup::Core
+{
+	enum class FileSystemJournalRecordType : uint32_t
+	{
+		// A directory tree that is being watched from this point on
+		Watch = 1,
+
+		// A file or directory entry that changed, a directory with a trailing separator
+		// means everything under the directory may have changed
+		Change = 2,
+
+		// The watcher dropped events and the journal cannot be trusted from this point on
+		Overflow = 3,
+
+		// A sync cookie written by a build, every change made before the cookie has been journaled
+		Cookie = 4,
+	};
+
+	/// <summary>
+	/// A single entry in the file system journal
+	/// </summary>
+	struct FileSystemJournalRecord
+	{
+		FileSystemJournalRecordType Type;
+		Path File;
+
+		// The offset in the journal directly after this record
+		uint64_t Offset;
+
+		bool operator ==(const FileSystemJournalRecord& rhs) const
+		{
+			return Type == rhs.Type &&
+				File == rhs.File &&
+				Offset == rhs.Offset;
+		}
+	};
+
+	/// <summary>
+	/// The changed file journal that is kept up to date by a long running file system watcher.
+	/// Each watcher session starts a new journal and appends the changes as they are observed.
+	/// The watcher drops the records that have been consumed by a build, the offsets of the remaining
+	/// records are unchanged so they stay comparable with the offset saved by a previous build.
+	/// </summary>
+	class FileSystemJournal
+	{
+	public:
+		FileSystemJournal() :
+			SessionId(0),
+			ProcessId(0),
+			Records(),
+			Size(0),
+			CompactedOffset(0)
+		{
+		}
+
+		FileSystemJournal(
+			int64_t sessionId,
+			uint32_t processId,
+			std::vector<FileSystemJournalRecord> records,
+			uint64_t size) :
+			FileSystemJournal(sessionId, processId, std::move(records), size, 0)
+		{
+		}
+
+		FileSystemJournal(
+			int64_t sessionId,
+			uint32_t processId,
+			std::vector<FileSystemJournalRecord> records,
+			uint64_t size,
+			uint64_t compactedOffset) :
+			SessionId(sessionId),
+			ProcessId(processId),
+			Records(std::move(records)),
+			Size(size),
+			CompactedOffset(compactedOffset)
+		{
+		}
+
+		// The unique id for the watcher session that owns the journal
+		int64_t SessionId;
+
+		// The watcher process that owns the journal
+		uint32_t ProcessId;
+
+		std::vector<FileSystemJournalRecord> Records;
+
+		// The number of bytes of the journal that have been read
+		uint64_t Size;
+
+		// The offset up to which the changes have been dropped, only the watched directories are kept
+		uint64_t CompactedOffset;
+
+		/// <summary>
+		/// Check if the watcher that owns the journal is still running and recording changes
+		/// </summary>
+		bool IsWatcherRunning() const
+		{
+			#if defined(__linux__)
+			return ProcessId != 0 && (kill(static_cast<pid_t>(ProcessId), 0) == 0 || errno == EPERM);
+			#else
+			return false;
+			#endif
+		}
+	};
+}
@@ -0,0 +1,196 @@
+﻿// <copyright file="FileSystemJournalManager.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <charconv>
+#include <chrono>
+#include <format>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+
+export module Soup.Core:FileSystemJournalManager;
+
+import Opal;
+import :BuildConstants;
+import :FileSystemJournal;
+import :FileSystemJournalReader;
+
+using namespace Opal;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The file system journal manager
+	/// </summary>
+	export class FileSystemJournalManager
+	{
+	public:
+		/// <summary>
+		/// Load the journal from an active file system watcher
+		/// </summary>
+		static bool TryLoadState(
+			const Path& fileSystemJournalFile,
+			FileSystemJournal& result)
+		{
+			auto journal = FileSystemJournal();
+			if (!TryReadState(fileSystemJournalFile, journal))
+				return false;
+
+			if (!journal.IsWatcherRunning())
+			{
+				Log::Info("File system watcher is not running");
+				return false;
+			}
+
+			result = std::move(journal);
+			return true;
+		}
+
+		/// <summary>
+		/// Wait for the watcher to journal every change made before this point. The watcher may still have
+		/// events queued, so a cookie file is written under each watched root and the journal is reloaded
+		/// until the watcher has recorded all of them, otherwise the journal cannot be trusted.
+		/// The cookie also tells the watcher the offset that was consumed by the previous build
+		/// so it can drop the records that are no longer needed.
+		/// </summary>
+		static bool TrySync(
+			const Path& fileSystemJournalFile,
+			FileSystemJournal& journal,
+			uint64_t consumedOffset)
+		{
+			// Use a unique cookie for this build so a concurrent build cannot sync on our behalf
+			auto cookieName = Path(std::format(
+				"{}{}-{}-{}",
+				BuildConstants::FileSystemJournalCookiePrefix(),
+				journal.SessionId,
+				consumedOffset,
+				std::chrono::steady_clock::now().time_since_epoch().count()));
+			auto cookies = std::set<std::string>();
+			for (auto& record : journal.Records)
+			{
+				if (record.Type == FileSystemJournalRecordType::Watch)
+					cookies.insert((record.File + cookieName).ToString());
+			}
+
+			auto syncOffset = journal.Size;
+			auto synced = false;
+			auto syncedJournal = FileSystemJournal();
+			try
+			{
+				for (auto& cookie : cookies)
+				{
+					// The watcher records the cookie once it is closed
+					auto file = System::IFileSystem::Current().OpenWrite(Path(cookie), false);
+				}
+
+				for (auto attempt = 0; attempt < MaxSyncAttempts; attempt++)
+				{
+					if (!TryReadState(fileSystemJournalFile, syncedJournal) ||
+						syncedJournal.SessionId != journal.SessionId)
+					{
+						break;
+					}
+
+					auto remainingCookies = cookies;
+					for (auto& record : syncedJournal.Records)
+					{
+						if (record.Type == FileSystemJournalRecordType::Cookie && record.Offset > syncOffset)
+							remainingCookies.erase(record.File.ToString());
+					}
+
+					if (remainingCookies.empty())
+					{
+						synced = true;
+						break;
+					}
+
+					std::this_thread::sleep_for(SyncPollInterval);
+				}
+			}
+			catch(std::exception& ex)
+			{
+				Log::Warning("Failed to sync file system journal: {}", ex.what());
+			}
+
+			for (auto& cookie : cookies)
+			{
+				if (System::IFileSystem::Current().Exists(Path(cookie)))
+					System::IFileSystem::Current().DeleteFile(Path(cookie));
+			}
+
+			if (!synced)
+			{
+				Log::Info("File system watcher did not sync the journal");
+				return false;
+			}
+
+			journal = std::move(syncedJournal);
+			return true;
+		}
+
+		/// <summary>
+		/// Parse the session and the consumed journal offset from the name of a sync cookie
+		/// </summary>
+		static bool TryParseCookie(
+			std::string_view name,
+			int64_t& sessionId,
+			uint64_t& consumedOffset)
+		{
+			auto& prefix = BuildConstants::FileSystemJournalCookiePrefix();
+			if (!name.starts_with(prefix))
+				return false;
+
+			auto current = name.data() + prefix.size();
+			auto end = name.data() + name.size();
+			auto sessionResult = std::from_chars(current, end, sessionId);
+			if (sessionResult.ec != std::errc() || sessionResult.ptr == end || *sessionResult.ptr != '-')
+				return false;
+
+			auto offsetResult = std::from_chars(sessionResult.ptr + 1, end, consumedOffset);
+			if (offsetResult.ec != std::errc() || offsetResult.ptr == end || *offsetResult.ptr != '-')
+				return false;
+
+			return true;
+		}
+
+	private:
+		static constexpr int MaxSyncAttempts = 200;
+		static constexpr auto SyncPollInterval = std::chrono::milliseconds(5);
+
+		static bool TryReadState(
+			const Path& fileSystemJournalFile,
+			FileSystemJournal& result)
+		{
+			// Open the file to read from
+			std::shared_ptr<System::IInputFile> file;
+			if (!System::IFileSystem::Current().TryOpenRead(fileSystemJournalFile, true, file))
+			{
+				Log::Info("File system journal file does not exist");
+				return false;
+			}
+
+			// Read the contents of the journal file
+			try
+			{
+				result = FileSystemJournalReader::Deserialize(file->GetInStream());
+				return true;
+			}
+			catch(std::runtime_error& ex)
+			{
+				Log::Error(ex.what());
+				return false;
+			}
+			catch(...)
+			{
+				Log::Error("Failed to parse file system journal");
+				return false;
+			}
+		}
+	};
+}
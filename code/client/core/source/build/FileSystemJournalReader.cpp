@@ -0,0 +1,149 @@
+﻿// <copyright file="FileSystemJournalReader.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <array>
+#include <cstring>
+#include <string>
+#include <vector>
+
+export module Soup.Core:FileSystemJournalReader;
+
+import Opal;
+import :FileSystemJournal;
+
+using namespace Opal;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The file system journal reader
+	/// </summary>
+	export class FileSystemJournalReader
+	{
+	private:
+		// Binary File System Journal file format
+		static constexpr uint32_t FileVersion = 2;
+
+	public:
+		static FileSystemJournal Deserialize(std::istream& stream)
+		{
+			// Read the entire file for fastest read operation
+			stream.seekg(0, std::ios_base::end);
+			auto size = stream.tellg();
+			stream.seekg(0, std::ios_base::beg);
+
+			auto contentBuffer = std::vector<char>(size);
+			stream.read(contentBuffer.data(), size);
+			auto data = contentBuffer.data();
+			size_t offset = 0;
+
+			return Deserialize(data, size, offset);
+		}
+
+	private:
+		static FileSystemJournal Deserialize(
+			char* data,
+			size_t size,
+			size_t& offset)
+		{
+			// Read the File Header with version
+			auto headerBuffer = std::array<char, 4>();
+			Read(data, size, offset, headerBuffer.data(), 4);
+			if (headerBuffer[0] != 'B' ||
+				headerBuffer[1] != 'F' ||
+				headerBuffer[2] != 'J' ||
+				headerBuffer[3] != '\0')
+			{
+				throw std::runtime_error("Invalid file system journal file header");
+			}
+
+			auto fileVersion = ReadUInt32(data, size, offset);
+			if (fileVersion != FileVersion)
+			{
+				throw std::runtime_error("File system journal file version does not match expected");
+			}
+
+			auto sessionId = ReadInt64(data, size, offset);
+			auto processId = ReadUInt32(data, size, offset);
+
+			// The bytes that were dropped from the front of the journal when it was compacted
+			auto baseOffset = ReadUInt64(data, size, offset);
+			auto compactedOffset = ReadUInt64(data, size, offset);
+
+			// The watcher is actively appending to the journal,
+			// stop at the last complete record and ignore a partial write
+			auto records = std::vector<FileSystemJournalRecord>();
+			while (true)
+			{
+				uint32_t type = 0;
+				uint32_t fileLength = 0;
+				if (!TryRead(data, size, offset, 0, reinterpret_cast<char*>(&type), sizeof(uint32_t)) ||
+					!TryRead(data, size, offset, sizeof(uint32_t), reinterpret_cast<char*>(&fileLength), sizeof(uint32_t)) ||
+					offset + 2 * sizeof(uint32_t) + fileLength > size)
+				{
+					break;
+				}
+
+				offset += 2 * sizeof(uint32_t);
+				auto file = std::string(data + offset, fileLength);
+				offset += fileLength;
+
+				records.push_back({
+					static_cast<FileSystemJournalRecordType>(type),
+					Path(std::move(file)),
+					baseOffset + offset,
+				});
+			}
+
+			return FileSystemJournal(
+				sessionId,
+				processId,
+				std::move(records),
+				baseOffset + offset,
+				compactedOffset);
+		}
+
+		static uint32_t ReadUInt32(char* data, size_t size, size_t& offset)
+		{
+			uint32_t result = 0;
+			Read(data, size, offset, reinterpret_cast<char*>(&result), sizeof(uint32_t));
+
+			return result;
+		}
+
+		static uint64_t ReadUInt64(char* data, size_t size, size_t& offset)
+		{
+			uint64_t result = 0;
+			Read(data, size, offset, reinterpret_cast<char*>(&result), sizeof(uint64_t));
+
+			return result;
+		}
+
+		static int64_t ReadInt64(char* data, size_t size, size_t& offset)
+		{
+			int64_t result = 0;
+			Read(data, size, offset, reinterpret_cast<char*>(&result), sizeof(int64_t));
+
+			return result;
+		}
+
+		static bool TryRead(char* data, size_t size, size_t offset, size_t skip, char* buffer, size_t count)
+		{
+			if (offset + skip + count > size)
+				return false;
+			memcpy(buffer, data + offset + skip, count);
+			return true;
+		}
+
+		static void Read(char* data, size_t size, size_t& offset, char* buffer, size_t count)
+		{
+			if (offset + count > size)
+				throw std::runtime_error("Tried to read past end of data");
+			memcpy(buffer, data + offset, count);
+			offset += count;
+		}
+	};
+}
@@ -0,0 +1,139 @@
+﻿// <copyright file="FileSystemJournalWriter.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+export module Soup.Core:FileSystemJournalWriter;
+
+import Opal;
+import :FileSystemJournal;
+
+using namespace Opal;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The file system journal writer used by the watcher to append records as they are observed
+	/// and to compact the journal once the records have been consumed by a build
+	/// </summary>
+	export class FileSystemJournalWriter
+	{
+	private:
+		// Binary File System Journal file format
+		static constexpr uint32_t FileVersion = 2;
+		static constexpr uint64_t HeaderSize = 4 + sizeof(uint32_t) + sizeof(int64_t) + sizeof(uint32_t) + 2 * sizeof(uint64_t);
+
+	public:
+		static void WriteHeader(
+			std::ostream& stream,
+			int64_t sessionId,
+			uint32_t processId)
+		{
+			WriteHeader(stream, sessionId, processId, 0, 0);
+		}
+
+		/// <summary>
+		/// Write a copy of the journal without the changes up to the compacted offset.
+		/// The watched directories are kept directly before the compacted offset and the remaining records
+		/// keep their offsets so a build that has consumed the journal up to the compacted offset can still use it.
+		/// </summary>
+		static void WriteCompacted(
+			std::ostream& stream,
+			const FileSystemJournal& journal,
+			uint64_t compactedOffset)
+		{
+			if (compactedOffset < journal.CompactedOffset || compactedOffset > journal.Size)
+				throw std::runtime_error("The compacted offset is outside of the journal");
+
+			auto watchRecords = std::vector<const FileSystemJournalRecord*>();
+			auto remainingRecords = std::vector<const FileSystemJournalRecord*>();
+			uint64_t watchRecordsSize = 0;
+			bool isRecordBoundary = false;
+			for (auto& record : journal.Records)
+			{
+				if (record.Offset == compactedOffset)
+					isRecordBoundary = true;
+
+				if (record.Type == FileSystemJournalRecordType::Watch && record.Offset <= compactedOffset)
+				{
+					watchRecords.push_back(&record);
+					watchRecordsSize += GetRecordSize(record.File);
+				}
+				else if (record.Offset > compactedOffset)
+				{
+					remainingRecords.push_back(&record);
+				}
+			}
+
+			if (!isRecordBoundary)
+				throw std::runtime_error("The compacted offset is not at the end of a record");
+
+			if (HeaderSize + watchRecordsSize > compactedOffset)
+				throw std::runtime_error("The compacted offset is before the watched directories");
+
+			auto baseOffset = compactedOffset - watchRecordsSize - HeaderSize;
+			WriteHeader(stream, journal.SessionId, journal.ProcessId, baseOffset, compactedOffset);
+			for (auto record : watchRecords)
+				WriteRecord(stream, record->Type, record->File);
+			for (auto record : remainingRecords)
+				WriteRecord(stream, record->Type, record->File);
+		}
+
+		static void WriteRecord(
+			std::ostream& stream,
+			FileSystemJournalRecordType type,
+			const Path& file)
+		{
+			WriteValue(stream, static_cast<uint32_t>(type));
+			WriteValue(stream, file.ToString());
+		}
+
+	private:
+		static void WriteHeader(
+			std::ostream& stream,
+			int64_t sessionId,
+			uint32_t processId,
+			uint64_t baseOffset,
+			uint64_t compactedOffset)
+		{
+			// Write the File Header with version
+			stream.write("BFJ\0", 4);
+			WriteValue(stream, FileVersion);
+			WriteValue(stream, sessionId);
+			WriteValue(stream, processId);
+			WriteValue(stream, baseOffset);
+			WriteValue(stream, compactedOffset);
+		}
+
+		static uint64_t GetRecordSize(const Path& file)
+		{
+			return 2 * sizeof(uint32_t) + file.ToString().size();
+		}
+
+		static void WriteValue(std::ostream& stream, uint32_t value)
+		{
+			stream.write(reinterpret_cast<char*>(&value), sizeof(uint32_t));
+		}
+
+		static void WriteValue(std::ostream& stream, uint64_t value)
+		{
+			stream.write(reinterpret_cast<char*>(&value), sizeof(uint64_t));
+		}
+
+		static void WriteValue(std::ostream& stream, int64_t value)
+		{
+			stream.write(reinterpret_cast<char*>(&value), sizeof(int64_t));
+		}
+
+		static void WriteValue(std::ostream& stream, std::string_view value)
+		{
+			WriteValue(stream, static_cast<uint32_t>(value.size()));
+			stream.write(value.data(), value.size());
+		}
+	};
+}
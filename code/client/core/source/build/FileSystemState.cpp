@@ -4,16 +4,25 @@
 
 module;
 
+#include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <set>
+#include <span>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 export module Soup.Core:FileSystemState;
 
 import Opal;
+import :ContentHash;
+import :FileSystemJournal;
 
 using namespace Opal;
 
@@ -37,6 +46,93 @@ export namespace Soup::Core
 		std::unordered_map<std::string, DirectoryState, string_hash, std::equal_to<>> ChildDirectories;
 	};
 
+	/// <summary>
+	/// A single interned path component, the full path is the chain of parent components.
+	/// A directory and a file with the same name are separate components.
+	/// </summary>
+	struct PathNode
+	{
+		uint32_t Parent;
+		std::string_view Name;
+		bool IsDirectory;
+
+		// The file id for the path that ends with this component, zero if the path is not a known file
+		FileId File;
+	};
+
+	struct PathNodeKey
+	{
+		uint32_t Parent;
+		std::string_view Name;
+		bool IsDirectory;
+
+		bool operator ==(const PathNodeKey& rhs) const = default;
+	};
+
+	struct PathNodeKeyHash
+	{
+		std::size_t operator()(const PathNodeKey& key) const
+		{
+			auto result = std::hash<std::string_view>{}(key.Name);
+			result ^= (static_cast<std::size_t>(key.Parent) << 1 | (key.IsDirectory ? 1u : 0u)) +
+				0x9e3779b97f4a7c15ull + (result << 6) + (result >> 2);
+			return result;
+		}
+	};
+
+	/// <summary>
+	/// The storage for the interned path component names, the names never move once they are added
+	/// </summary>
+	class PathNameArena
+	{
+	private:
+		static constexpr size_t BlockSize = 64 * 1024;
+
+		std::vector<std::unique_ptr<char[]>> _blocks;
+		size_t _blockOffset;
+
+	public:
+		PathNameArena() :
+			_blocks(),
+			_blockOffset(BlockSize)
+		{
+		}
+
+		std::string_view Add(std::string_view value)
+		{
+			// Names that do not fit in a block are given their own block ahead of the active block
+			if (value.size() > BlockSize)
+			{
+				auto block = std::make_unique<char[]>(value.size());
+				std::memcpy(block.get(), value.data(), value.size());
+				auto result = std::string_view(block.get(), value.size());
+				_blocks.insert(_blocks.empty() ? _blocks.end() : _blocks.end() - 1, std::move(block));
+				return result;
+			}
+
+			if (_blockOffset + value.size() > BlockSize)
+			{
+				_blocks.push_back(std::make_unique<char[]>(BlockSize));
+				_blockOffset = 0;
+			}
+
+			auto data = _blocks.back().get() + _blockOffset;
+			std::memcpy(data, value.data(), value.size());
+			_blockOffset += value.size();
+
+			return std::string_view(data, value.size());
+		}
+	};
+
+	/// <summary>
+	/// The state of a directory that has been preloaded and the files and directories it contained
+	/// </summary>
+	struct PreloadedDirectoryState
+	{
+		bool TrackDirectories;
+		std::vector<FileId> Children;
+	};
+
 	/// <summary>
 	/// The complete set of known files that tracking the active change state during execution
 	/// </summary>
@@ -47,23 +143,62 @@ export namespace Soup::Core
 		// Used to ensure unique ids are generated across the entire system
 		FileId _maxFileId;
 
-		std::unordered_map<FileId, Path> _files;
-		std::unordered_map<std::string, FileId> _fileLookup;
-		
+		// The interned path node for each known file indexed by its id, zero is an unused id.
+		// Each path component is interned once and shared by all of the files below it,
+		// the full path is rebuilt from the chain of components when it is requested.
+		std::vector<uint32_t> _fileNodes;
+		size_t _fileCount;
+
+		// The reverse lookup from a path to its id
+		std::vector<PathNode> _pathNodes;
+		std::unordered_map<PathNodeKey, uint32_t, PathNodeKeyHash> _pathNodeLookup;
+		PathNameArena _pathNames;
+
 		std::unordered_map<std::string, DirectoryState, string_hash, std::equal_to<>> _directoryLookup;
 
 		std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>> _writeCache;
 
+		// The content hashes for files that have been read during this run
+		std::unordered_map<FileId, std::optional<uint64_t>> _contentHashCache;
+
+		// The directories that have been crawled and the set restored from a previous run
+		// that must be checked for changes before they are trusted
+		std::unordered_map<FileId, PreloadedDirectoryState> _preloadedDirectories;
+		std::unordered_set<FileId> _unverifiedDirectories;
+
+		// The file write times from a previous run that can be trusted once the file system journal
+		// shows they have not changed since the state was saved
+		std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>> _restoredWriteCache;
+		int64_t _restoredJournalSessionId;
+		uint64_t _restoredJournalOffset;
+		std::unordered_set<FileId> _journalVerifiedDirectories;
+
+		// The position in the file system journal that the current write times are valid for
+		int64_t _journalSessionId;
+		uint64_t _journalOffset;
+
 	public:
 		/// <summary>
 		/// Initializes a new instance of the <see cref="FileSystemState"/> class.
 		/// </summary>
 		FileSystemState() :
 			_maxFileId(0),
-			_files(),
-			_fileLookup(),
+			_fileNodes(),
+			_fileCount(0),
+			_pathNodes({ PathNode({ 0, {}, true, 0 }) }),
+			_pathNodeLookup(),
+			_pathNames(),
 			_directoryLookup(),
-			_writeCache()
+			_writeCache(),
+			_contentHashCache(),
+			_preloadedDirectories(),
+			_unverifiedDirectories(),
+			_restoredWriteCache(),
+			_restoredJournalSessionId(0),
+			_restoredJournalOffset(0),
+			_journalVerifiedDirectories(),
+			_journalSessionId(0),
+			_journalOffset(0)
 		{
 		}
 
@@ -86,26 +221,151 @@ export namespace Soup::Core
 			std::unordered_map<std::string, DirectoryState, string_hash, std::equal_to<>> directoryLookup,
 			std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>> writeCache) :
 			_maxFileId(maxFileId),
-			_files(std::move(files)),
-			_fileLookup(),
+			_fileNodes(),
+			_fileCount(0),
+			_pathNodes({ PathNode({ 0, {}, true, 0 }) }),
+			_pathNodeLookup(),
+			_pathNames(),
 			_directoryLookup(std::move(directoryLookup)),
-			_writeCache(std::move(writeCache))
+			_writeCache(std::move(writeCache)),
+			_contentHashCache(),
+			_preloadedDirectories(),
+			_unverifiedDirectories(),
+			_restoredWriteCache(),
+			_restoredJournalSessionId(0),
+			_restoredJournalOffset(0),
+			_journalVerifiedDirectories(),
+			_journalSessionId(0),
+			_journalOffset(0)
 		{
 			// Build up the reverse lookup for new files
-			for (const auto& [key, value] : _files)
+			_pathNodeLookup.reserve(files.size());
+			for (auto& [key, value] : files)
 			{
-				auto insertResult = _fileLookup.emplace(value.ToString(), key);
-				if (!insertResult.second)
+				if (!TryAddFile(key, value))
 					throw std::runtime_error("The file was not unique in the provided set.");
 			}
 		}
 
 		/// <summary>
-		/// Get Files
+		/// Initializes a new instance of the <see cref="FileSystemState"/> class from a previous run.
+		/// The preloaded directories are verified against their last write time the next time they are preloaded
+		/// and only their write times are kept, files may have changed without updating the parent directory.
+		/// The remaining write times are held back until the file system journal proves they are still valid.
+		/// </summary>
+		FileSystemState(
+			FileId maxFileId,
+			std::unordered_map<FileId, Path> files,
+			std::unordered_map<std::string, DirectoryState, string_hash, std::equal_to<>> directoryLookup,
+			std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>> writeCache,
+			std::unordered_map<FileId, PreloadedDirectoryState> preloadedDirectories,
+			int64_t journalSessionId,
+			uint64_t journalOffset) :
+			FileSystemState(maxFileId, std::move(files), std::move(directoryLookup), {})
+		{
+			_preloadedDirectories = std::move(preloadedDirectories);
+			_restoredJournalSessionId = journalSessionId;
+			_restoredJournalOffset = journalOffset;
+			for (auto& [fileId, lastWriteTime] : writeCache)
+			{
+				if (_preloadedDirectories.contains(fileId))
+					_writeCache.insert_or_assign(fileId, lastWriteTime);
+				else
+					_restoredWriteCache.insert_or_assign(fileId, lastWriteTime);
+			}
+
+			for (const auto& [directoryId, directoryState] : _preloadedDirectories)
+			{
+				_unverifiedDirectories.insert(directoryId);
+			}
+		}
+
+		/// <summary>
+		/// Get a copy of the files
+		/// </summary>
+		std::unordered_map<FileId, Path> GetFiles() const
+		{
+			auto result = std::unordered_map<FileId, Path>();
+			result.reserve(_fileCount);
+			VisitFiles([&result](FileId fileId, std::string_view file)
+			{
+				result.emplace(fileId, Path(std::string(file)));
+			});
+
+			return result;
+		}
+
+		/// <summary>
+		/// Visit each known file in id order, the path is only valid for the duration of the callback
+		/// </summary>
+		void VisitFiles(const std::function<void(FileId fileId, std::string_view file)>& callback) const
+		{
+			auto file = std::string();
+			for (FileId fileId = 0; fileId < _fileNodes.size(); fileId++)
+			{
+				if (_fileNodes[fileId] != 0)
+				{
+					BuildPath(_fileNodes[fileId], file);
+					callback(fileId, file);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Get the number of known files
+		/// </summary>
+		size_t GetFileCount() const
+		{
+			return _fileCount;
+		}
+
+		/// <summary>
+		/// Get the directory structure for the tracked directories
+		/// </summary>
+		const std::unordered_map<std::string, DirectoryState, string_hash, std::equal_to<>>& GetDirectoryLookup() const
+		{
+			return _directoryLookup;
+		}
+
+		/// <summary>
+		/// Get the cached write times
+		/// </summary>
+		const std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>& GetWriteCache() const
+		{
+			return _writeCache;
+		}
+
+		/// <summary>
+		/// Get the directories that have been preloaded
 		/// </summary>
-		const std::unordered_map<FileId, Path>& GetFiles() const
+		const std::unordered_map<FileId, PreloadedDirectoryState>& GetPreloadedDirectories() const
 		{
-			return _files;
+			return _preloadedDirectories;
+		}
+
+		/// <summary>
+		/// Get the file system journal session that the write times are valid for
+		/// </summary>
+		int64_t GetJournalSessionId() const
+		{
+			return _journalSessionId;
+		}
+
+		/// <summary>
+		/// Get the offset in the file system journal that the write times are valid for
+		/// </summary>
+		uint64_t GetJournalOffset() const
+		{
+			return _journalOffset;
+		}
+
+		/// <summary>
+		/// Get the offset in the file system journal that the restored write times were saved at,
+		/// the journal up to this offset has been consumed by the previous build
+		/// </summary>
+		uint64_t GetRestoredJournalOffset(int64_t journalSessionId) const
+		{
+			return journalSessionId == _restoredJournalSessionId ? _restoredJournalOffset : 0;
 		}
 
 		/// <summary>
@@ -143,20 +403,85 @@ export namespace Soup::Core
 			}
 		}
 
+		/// <summary>
+		/// Find the content hash for a given file id
+		/// </summary>
+		std::optional<uint64_t> GetContentHash(FileId file)
+		{
+			auto findResult = _contentHashCache.find(file);
+			if (findResult != _contentHashCache.end())
+			{
+				return findResult->second;
+			}
+			else
+			{
+				return CheckContentHash(file);
+			}
+		}
+
 		/// <summary>
 		/// Convert a set of file paths to file ids
 		/// </summary>
 		std::vector<FileId> ToFileIds(const std::vector<Path>& files, const Path& workingDirectory)
 		{
 			auto result = std::vector<FileId>();
+			result.reserve(files.size());
+
+			// Resolve relative files from the working directory node so known files
+			// do not need to build and hash their full absolute path
+			const auto& workingDirectoryValue = workingDirectory.ToString();
+			uint32_t workingDirectoryNode = 0;
+			bool hasWorkingDirectoryNode =
+				workingDirectoryValue.ends_with('/') &&
+				TryFindPathNode(0, workingDirectoryValue, workingDirectoryNode);
+
 			for (auto& file : files)
 			{
-				result.push_back(ToFileId(file, workingDirectory));
+				uint32_t node;
+				if (hasWorkingDirectoryNode &&
+					!file.HasRoot() &&
+					TryFindPathNode(workingDirectoryNode, file.ToString(), node) &&
+					_pathNodes[node].File != 0)
+				{
+					result.push_back(_pathNodes[node].File);
+				}
+				else
+				{
+					result.push_back(ToFileId(file, workingDirectory));
+				}
 			}
 
 			return result;
 		}
 
+		/// <summary>
+		/// Convert a set of unique absolute file path strings to sorted file ids
+		/// </summary>
+		std::vector<FileId> ToFileIds(std::span<const std::string_view> absoluteFiles)
+		{
+			auto result = std::vector<FileId>();
+			result.reserve(absoluteFiles.size());
+
+			for (auto file : absoluteFiles)
+			{
+				// Known files resolve directly from the interned path without parsing the path
+				uint32_t node;
+				if (TryFindPathNode(0, file, node) && _pathNodes[node].File != 0)
+				{
+					result.push_back(_pathNodes[node].File);
+				}
+				else
+				{
+					result.push_back(ToFileId(Path::Parse(std::string(file))));
+				}
+			}
+
+			std::sort(result.begin(), result.end());
+			result.erase(std::unique(result.begin(), result.end()), result.end());
+
+			return result;
+		}
+
 		/// <summary>
 		/// Convert a file path to file id
 		/// </summary>
@@ -177,12 +502,10 @@ export namespace Soup::Core
 			{
 				// Insert the new file
 				result = ++_maxFileId;
-				auto insertResult = _files.emplace(result, file);
-				if (!insertResult.second)
+				if (result < _fileNodes.size() && _fileNodes[result] != 0)
 					throw std::runtime_error("The provided file id already exists in the file system state");
 
-				auto insertLookupResult = _fileLookup.emplace(file.ToString(), result);
-				if (!insertLookupResult.second)
+				if (!TryAddFile(result, file))
 					throw std::runtime_error("The file was not unique even though we just failed to find it");
 			}
 
@@ -194,10 +517,10 @@ export namespace Soup::Core
 		/// </summary>
 		bool TryFindFileId(const Path& file, FileId& fileId) const
 		{
-			auto findResult = _fileLookup.find(file.ToString());
-			if (findResult != _fileLookup.end())
+			uint32_t node;
+			if (TryFindPathNode(0, file.ToString(), node) && _pathNodes[node].File != 0)
 			{
-				fileId = findResult->second;
+				fileId = _pathNodes[node].File;
 				return true;
 			}
 			else
@@ -223,12 +546,13 @@ export namespace Soup::Core
 		/// <summary>
 		/// Find a file path
 		/// </summary>
-		const Path& GetFilePath(FileId fileId) const
+		Path GetFilePath(FileId fileId) const
 		{
-			auto findResult = _files.find(fileId);
-			if (findResult != _files.end())
+			if (fileId < _fileNodes.size() && _fileNodes[fileId] != 0)
 			{
-				return findResult->second;
+				auto file = std::string();
+				BuildPath(_fileNodes[fileId], file);
+				return Path(file);
 			}
 			else
 			{
@@ -236,6 +560,108 @@ export namespace Soup::Core
 			}
 		}
 
+		/// <summary>
+		/// Use the changed file journal from an active file system watcher to trust the write times
+		/// restored from the previous run. Only files under a directory that was already watched when
+		/// the state was saved and that have not been reported as changed since then are trusted.
+		/// </summary>
+		void ApplyJournal(const FileSystemJournal& journal)
+		{
+			// The current write times will be valid from this point in the journal forward
+			_journalSessionId = journal.SessionId;
+			_journalOffset = journal.Size;
+
+			if (journal.SessionId != _restoredJournalSessionId ||
+				journal.Size < _restoredJournalOffset)
+			{
+				Log::Diag("File system journal session does not match");
+				return;
+			}
+
+			if (journal.CompactedOffset > _restoredJournalOffset)
+			{
+				Log::Diag("File system journal was compacted past the previous build");
+				return;
+			}
+
+			// A changed directory with a trailing separator was removed, moved or replaced
+			// and everything under it may have changed
+			auto watchedDirectories = std::vector<std::string>();
+			auto changedFiles = std::unordered_set<std::string>();
+			auto changedDirectories = std::unordered_set<std::string>();
+			for (auto& record : journal.Records)
+			{
+				switch (record.Type)
+				{
+					case FileSystemJournalRecordType::Watch:
+						if (record.Offset <= _restoredJournalOffset)
+							watchedDirectories.push_back(record.File.ToString());
+						break;
+					case FileSystemJournalRecordType::Change:
+						if (record.Offset > _restoredJournalOffset)
+						{
+							auto file = record.File.ToString();
+							if (file.ends_with('/'))
+								changedDirectories.insert(std::move(file));
+							else
+								changedFiles.insert(std::move(file));
+						}
+						break;
+					case FileSystemJournalRecordType::Overflow:
+						if (record.Offset > _restoredJournalOffset)
+						{
+							Log::Diag("File system journal overflowed");
+							return;
+						}
+						break;
+					case FileSystemJournalRecordType::Cookie:
+						break;
+					default:
+						throw std::runtime_error("Unknown file system journal record type");
+				}
+			}
+
+			auto isTrusted = [&](FileId fileId)
+			{
+				auto file = GetFilePath(fileId).ToString();
+				if (changedFiles.contains(file))
+					return false;
+
+				// The entry for a directory changed without its contents changing
+				if (file.ends_with('/') && changedFiles.contains(file.substr(0, file.size() - 1)))
+					return false;
+
+				// Check the file and each parent directory for a changed tree
+				for (auto separator = file.find('/'); separator != std::string::npos; separator = file.find('/', separator + 1))
+				{
+					if (changedDirectories.contains(file.substr(0, separator + 1)))
+						return false;
+				}
+
+				for (auto& watchedDirectory : watchedDirectories)
+				{
+					if (file.starts_with(watchedDirectory))
+						return true;
+				}
+
+				return false;
+			};
+
+			for (auto& [fileId, lastWriteTime] : _restoredWriteCache)
+			{
+				if (isTrusted(fileId))
+					_writeCache.insert_or_assign(fileId, lastWriteTime);
+			}
+
+			for (auto directoryId : _unverifiedDirectories)
+			{
+				if (isTrusted(directoryId))
+					_journalVerifiedDirectories.insert(directoryId);
+			}
+
+			_restoredWriteCache.clear();
+		}
+
 		void PreloadDirectory(const Path& directory, bool trackDirectories)
 		{
 			#ifdef TRACE_FILE_SYSTEM_STATE
@@ -246,60 +672,279 @@ export namespace Soup::Core
 			if (!TryFindFileId(directory, directoryId))
 			{
 				directoryId = ToFileId(directory);
-				
-				// Add the requested file as null
-				// This will be replaced if the file exists with the find all callback
-				auto insertResult = _writeCache.insert_or_assign(directoryId, std::nullopt);
+				LoadDirectory(directory, directoryId, trackDirectories);
+			}
+			else if (_unverifiedDirectories.erase(directoryId) > 0)
+			{
+				VerifyDirectory(directory, directoryId);
+			}
+		}
+
+		DirectoryState& GetDirectoryState(const Path& directory)
+		{
+			auto activeDirectory = GetDirectoryState(_directoryLookup, directory.GetRoot());
+			const auto directories = directory.DecomposeDirectories();
+			for (auto currentDirectory : directories)
+			{
+				activeDirectory = GetDirectoryState(activeDirectory->ChildDirectories, currentDirectory);
+			}
+
+			return *activeDirectory;
+		}
+
+	private:
+		/// <summary>
+		/// Register a file with the provided id, fails if the path is already known
+		/// </summary>
+		bool TryAddFile(FileId fileId, const Path& file)
+		{
+			auto node = EnsurePathNode(file.ToString());
+			if (_pathNodes[node].File != 0)
+				return false;
+
+			if (fileId >= _fileNodes.size())
+				_fileNodes.resize(std::max<size_t>(fileId + 1, _fileNodes.size() * 2));
+
+			_pathNodes[node].File = fileId;
+			_fileNodes[fileId] = node;
+			_fileCount++;
+
+			return true;
+		}
+
+		/// <summary>
+		/// Rebuild the full path that ends at the provided node from the chain of parent components
+		/// </summary>
+		void BuildPath(uint32_t node, std::string& result) const
+		{
+			// Measure the full path so it is built in place from the end
+			size_t size = 0;
+			for (auto current = node; current != 0; current = _pathNodes[current].Parent)
+			{
+				auto& pathNode = _pathNodes[current];
+				size += pathNode.Name.size() + (pathNode.IsDirectory ? 1 : 0);
+			}
+
+			result.resize(size);
+			for (auto current = node; current != 0; current = _pathNodes[current].Parent)
+			{
+				auto& pathNode = _pathNodes[current];
+				if (pathNode.IsDirectory)
+					result[--size] = '/';
+
+				size -= pathNode.Name.size();
+				std::memcpy(result.data() + size, pathNode.Name.data(), pathNode.Name.size());
+			}
+		}
+
+		/// <summary>
+		/// Walk the path components from the provided node, a trailing separator ends at a directory node.
+		/// The relative components are resolved as they are found.
+		/// </summary>
+		bool TryFindPathNode(uint32_t startNode, std::string_view path, uint32_t& node) const
+		{
+			node = startNode;
+			size_t offset = 0;
+			while (offset < path.size())
+			{
+				auto end = path.find('/', offset);
+				bool isDirectory = end != std::string_view::npos;
+				if (!isDirectory)
+					end = path.size();
+
+				auto name = path.substr(offset, end - offset);
+				offset = end + 1;
+
+				if (isDirectory && name == "." && node != 0)
+					continue;
 
-				std::function<void(const Path& file, std::chrono::time_point<std::chrono::file_clock>)> callback =
-					[&](const Path& file, std::chrono::time_point<std::chrono::file_clock> lastWriteTime)
+				if (isDirectory && name == ".." && node != 0)
+				{
+					// Do not walk past the root
+					auto parent = _pathNodes[node].Parent;
+					if (parent == 0)
+						return false;
+
+					node = parent;
+					continue;
+				}
+
+				auto findResult = _pathNodeLookup.find(PathNodeKey({ node, name, isDirectory }));
+				if (findResult == _pathNodeLookup.end())
+					return false;
+
+				node = findResult->second;
+			}
+
+			return true;
+		}
+
+		/// <summary>
+		/// Find or create the nodes for each component of an absolute path
+		/// </summary>
+		uint32_t EnsurePathNode(std::string_view path)
+		{
+			uint32_t node = 0;
+			size_t offset = 0;
+			while (offset < path.size())
+			{
+				auto end = path.find('/', offset);
+				bool isDirectory = end != std::string_view::npos;
+				if (!isDirectory)
+					end = path.size();
+
+				auto name = path.substr(offset, end - offset);
+				offset = end + 1;
+
+				auto findResult = _pathNodeLookup.find(PathNodeKey({ node, name, isDirectory }));
+				if (findResult != _pathNodeLookup.end())
+				{
+					node = findResult->second;
+				}
+				else
+				{
+					auto childNode = static_cast<uint32_t>(_pathNodes.size());
+					auto childName = _pathNames.Add(name);
+					_pathNodes.push_back(PathNode({ node, childName, isDirectory, 0 }));
+					_pathNodeLookup.emplace(PathNodeKey({ node, childName, isDirectory }), childNode);
+					node = childNode;
+				}
+			}
+
+			return node;
+		}
+
+		/// <summary>
+		/// Load the write times for all files in the directory
+		/// </summary>
+		void LoadDirectory(const Path& directory, FileId directoryId, bool trackDirectories)
+		{
+			// Add the requested file as null
+			// This will be replaced if the file exists with the find all callback
+			auto insertResult = _writeCache.insert_or_assign(directoryId, std::nullopt);
+
+			auto children = std::vector<FileId>();
+			std::function<void(const Path& file, std::chrono::time_point<std::chrono::file_clock>)> callback =
+				[&](const Path& file, std::chrono::time_point<std::chrono::file_clock> lastWriteTime)
+				{
+					auto& absolutePath = file.HasRoot() ? file : directory + file;
+
+					#ifdef TRACE_FILE_SYSTEM_STATE
+					std::cout << "PreloadDirectory: File " << file.ToString() << std::endl;
+					#endif
+
+					// Recursively load child directories
+					if (!file.IsEmpty() && !absolutePath.HasFileName())
 					{
-						auto& absolutePath = file.HasRoot() ? file : directory + file;
+						PreloadDirectory(absolutePath, trackDirectories);
+					}
 
-						#ifdef TRACE_FILE_SYSTEM_STATE
-						std::cout << "PreloadDirectory: File " << file.ToString() << std::endl;
-						#endif
+					if (trackDirectories)
+					{
+						UpdateDirectoryLookup(absolutePath);
+					}
 
-						// Recursively load child directories
-						if (!file.IsEmpty() && !absolutePath.HasFileName())
-						{
-							PreloadDirectory(absolutePath, trackDirectories);
-						}
+					FileId fileId = ToFileId(absolutePath);
+					auto insertResult = _writeCache.insert_or_assign(fileId, lastWriteTime);
+
+					if (fileId != directoryId)
+						children.push_back(fileId);
+				};
 
-						if (trackDirectories)
+			// Load the write times for all files in the directory
+			// This optimization assumes that most files in a directory are relevant to the build
+			// and on windows it is a lot faster to iterate over the files instead of making individual calls
+			if (!System::IFileSystem::Current().TryGetDirectoryFilesLastWriteTime(
+				directory,
+				callback))
+			{
+				Log::Info("Preload Directory Missing: {}", directory.ToString());
+			}
+
+			_preloadedDirectories.insert_or_assign(
+				directoryId,
+				PreloadedDirectoryState({ trackDirectories, std::move(children) }));
+		}
+
+		/// <summary>
+		/// Check a directory restored from a previous run. If the directory has not changed then
+		/// the known contents are still valid and only the child directories must be checked,
+		/// otherwise the contents are loaded again.
+		/// </summary>
+		void VerifyDirectory(const Path& directory, FileId directoryId)
+		{
+			auto& preloadedDirectory = _preloadedDirectories.at(directoryId);
+			auto trackDirectories = preloadedDirectory.TrackDirectories;
+
+			auto previousWriteTime = std::optional<std::chrono::time_point<std::chrono::file_clock>>();
+			auto findPreviousWriteTime = _writeCache.find(directoryId);
+			if (findPreviousWriteTime != _writeCache.end())
+				previousWriteTime = findPreviousWriteTime->second;
+
+			// The file system journal has already shown the directory is unchanged
+			auto currentWriteTime = std::optional<std::chrono::time_point<std::chrono::file_clock>>();
+			std::chrono::time_point<std::chrono::file_clock> currentWriteTimeValue;
+			if (_journalVerifiedDirectories.contains(directoryId))
+				currentWriteTime = previousWriteTime;
+			else if (System::IFileSystem::Current().TryGetLastWriteTime(directory, currentWriteTimeValue))
+				currentWriteTime = currentWriteTimeValue;
+
+			if (previousWriteTime == currentWriteTime)
+			{
+				for (auto childId : preloadedDirectory.Children)
+				{
+					if (_preloadedDirectories.contains(childId))
+						PreloadDirectory(GetFilePath(childId), trackDirectories);
+				}
+			}
+			else
+			{
+				if (trackDirectories)
+				{
+					// Drop the previous files before they are loaded again, the child directories
+					// are kept so the contents of those that did not change are still known
+					auto& directoryState = *EnsureDirectoryExists(directory);
+					directoryState.Files.clear();
+
+					LoadDirectory(directory, directoryId, trackDirectories);
+
+					// Remove the child directories that no longer exist
+					auto childDirectories = std::set<std::string>();
+					for (auto childId : _preloadedDirectories.at(directoryId).Children)
+					{
+						auto childPath = GetFilePath(childId);
+						if (!childPath.HasFileName())
 						{
-							UpdateDirectoryLookup(absolutePath);
+							auto childName = std::string();
+							for (auto name : childPath.DecomposeDirectories())
+								childName = name;
+							childDirectories.insert(std::move(childName));
 						}
+					}
 
-						FileId fileId = ToFileId(absolutePath);
-						auto insertResult = _writeCache.insert_or_assign(fileId, lastWriteTime);
-					};
-
-				// Load the write times for all files in the directory
-				// This optimization assumes that most files in a directory are relevant to the build
-				// and on windows it is a lot faster to iterate over the files instead of making individual calls
-				if (!System::IFileSystem::Current().TryGetDirectoryFilesLastWriteTime(
-					directory,
-					callback))
+					std::erase_if(
+						directoryState.ChildDirectories,
+						[&](const auto& childDirectory) { return !childDirectories.contains(childDirectory.first); });
+				}
+				else
 				{
-					Log::Info("Preload Directory Missing: {}", directory.ToString());
+					LoadDirectory(directory, directoryId, trackDirectories);
 				}
 			}
 		}
 
-		DirectoryState& GetDirectoryState(const Path& directory)
+		DirectoryState* EnsureDirectoryExists(const Path& directory)
 		{
-			auto activeDirectory = GetDirectoryState(_directoryLookup, directory.GetRoot());
+			auto activeDirectory = EnsureDirectoryExists(_directoryLookup, directory.GetRoot());
 			const auto directories = directory.DecomposeDirectories();
 			for (auto currentDirectory : directories)
 			{
-				activeDirectory = GetDirectoryState(activeDirectory->ChildDirectories, currentDirectory);
+				activeDirectory = EnsureDirectoryExists(activeDirectory->ChildDirectories, currentDirectory);
 			}
 
-			return *activeDirectory;
+			return activeDirectory;
 		}
 
-	private:
 		DirectoryState* GetDirectoryState(
 			std::unordered_map<std::string, DirectoryState, string_hash, std::equal_to<>>& activeDirectory,
 			const std::string_view name)
@@ -354,6 +999,7 @@ export namespace Soup::Core
 		void InvalidateFileWriteTime(FileId fileId)
 		{
 			_writeCache.erase(fileId);
+			_contentHashCache.erase(fileId);
 		}
 
 		std::string format(std::chrono::time_point<std::chrono::file_clock> time)
@@ -376,7 +1022,7 @@ export namespace Soup::Core
 		/// </summary>
 		std::optional<std::chrono::time_point<std::chrono::file_clock>> CheckFileWriteTime(FileId fileId)
 		{
-			auto& filePath = GetFilePath(fileId);
+			auto filePath = GetFilePath(fileId);
 
 			// The file does not exist in the cache
 			// Load the actual value and save it for later
@@ -397,5 +1043,30 @@ export namespace Soup::Core
 			auto insertResult = _writeCache.insert_or_assign(fileId, lastWriteTime);
 			return lastWriteTime;
 		}
+
+		/// <summary>
+		/// Hash the current contents of the provided file
+		/// </summary>
+		std::optional<uint64_t> CheckContentHash(FileId fileId)
+		{
+			auto filePath = GetFilePath(fileId);
+
+			std::optional<uint64_t> contentHash = std::nullopt;
+			std::shared_ptr<System::IInputFile> file;
+			if (System::IFileSystem::Current().TryOpenRead(filePath, true, file))
+			{
+				contentHash = ContentHash::Hash(file->GetInStream());
+			}
+
+#ifdef TRACE_FILE_SYSTEM_STATE
+			if (contentHash.has_value())
+				std::cout << "CheckContentHash: " << filePath.ToString() << " " << contentHash.value() << std::endl;
+			else
+				std::cout << "CheckContentHash: " << filePath.ToString() << " NONE" << std::endl;
+#endif
+
+			_contentHashCache.insert_or_assign(fileId, contentHash);
+			return contentHash;
+		}
 	};
 }
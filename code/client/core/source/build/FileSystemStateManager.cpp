@@ -0,0 +1,74 @@
+﻿// <copyright file="FileSystemStateManager.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <memory>
+#include <stdexcept>
+
+export module Soup.Core:FileSystemStateManager;
+
+import Opal;
+import :FileSystemState;
+import :FileSystemStateReader;
+import :FileSystemStateWriter;
+
+using namespace Opal;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The file system state manager that persists the known files between builds
+	/// </summary>
+	export class FileSystemStateManager
+	{
+	public:
+		/// <summary>
+		/// Load the file system state from the provided file
+		/// </summary>
+		static bool TryLoadState(
+			const Path& fileSystemStateFile,
+			FileSystemState& result)
+		{
+			// Open the file to read from
+			std::shared_ptr<System::IInputFile> file;
+			if (!System::IFileSystem::Current().TryOpenRead(fileSystemStateFile, true, file))
+			{
+				Log::Info("File system state file does not exist");
+				return false;
+			}
+
+			// Read the contents of the file system state file
+			try
+			{
+				result = FileSystemStateReader::Deserialize(file->GetInStream());
+				return true;
+			}
+			catch(std::runtime_error& ex)
+			{
+				Log::Error(ex.what());
+				return false;
+			}
+			catch(...)
+			{
+				Log::Error("Failed to parse file system state");
+				return false;
+			}
+		}
+
+		/// <summary>
+		/// Save the file system state to the provided file
+		/// </summary>
+		static void SaveState(
+			const Path& fileSystemStateFile,
+			const FileSystemState& state)
+		{
+			// Open the file to write to
+			auto file = System::IFileSystem::Current().OpenWrite(fileSystemStateFile, true);
+
+			// Write the file system state to the file stream
+			FileSystemStateWriter::Serialize(state, file->GetOutStream());
+		}
+	};
+}
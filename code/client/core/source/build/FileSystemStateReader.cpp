@@ -0,0 +1,279 @@
+﻿// <copyright file="FileSystemStateReader.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+export module Soup.Core:FileSystemStateReader;
+
+import Opal;
+import :FileSystemState;
+
+using namespace Opal;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The file system state snapshot reader
+	/// </summary>
+	export class FileSystemStateReader
+	{
+	private:
+		// Binary File System State file format
+		static constexpr uint32_t FileVersion = 2;
+
+		// The time duration that represents how we store the values in the file using 64 bit integer with resolution of 100 nanoseconds
+		// Note: Unix Time, time since 00:00:00 Coordinated Universal Time (UTC), Thursday, 1 January 1970, not counting leap seconds
+		using ContentTimePeriod = std::ratio<1, 10'000'000>;
+		using ContentDuration = std::chrono::duration<long long, ContentTimePeriod>;
+
+	public:
+		static FileSystemState Deserialize(std::istream& stream)
+		{
+			// Read the entire file for fastest read operation
+			stream.seekg(0, std::ios_base::end);
+			auto size = stream.tellg();
+			stream.seekg(0, std::ios_base::beg);
+
+			auto contentBuffer = std::vector<char>(size);
+			stream.read(contentBuffer.data(), size);
+			auto data = contentBuffer.data();
+			size_t offset = 0;
+
+			auto result = Deserialize(data, size, offset);
+
+			if (offset != contentBuffer.size())
+			{
+				throw std::runtime_error("File system state file corrupted - Did not read the entire file");
+			}
+
+			return result;
+		}
+
+	private:
+		static FileSystemState Deserialize(
+			char* data,
+			size_t size,
+			size_t& offset)
+		{
+			// Read the File Header with version
+			auto headerBuffer = std::array<char, 4>();
+			Read(data, size, offset, headerBuffer.data(), 4);
+			if (headerBuffer[0] != 'B' ||
+				headerBuffer[1] != 'F' ||
+				headerBuffer[2] != 'S' ||
+				headerBuffer[3] != '\0')
+			{
+				throw std::runtime_error("Invalid file system state file header");
+			}
+
+			auto fileVersion = ReadUInt32(data, size, offset);
+			if (fileVersion != FileVersion)
+			{
+				throw std::runtime_error("File system state file version does not match expected");
+			}
+
+			// Read the position in the file system journal
+			Read(data, size, offset, headerBuffer.data(), 4);
+			if (headerBuffer[0] != 'J' ||
+				headerBuffer[1] != 'N' ||
+				headerBuffer[2] != 'L' ||
+				headerBuffer[3] != '\0')
+			{
+				throw std::runtime_error("Invalid file system state journal header");
+			}
+
+			auto journalSessionId = ReadInt64(data, size, offset);
+			auto journalOffset = static_cast<uint64_t>(ReadInt64(data, size, offset));
+
+			// Read the set of files
+			Read(data, size, offset, headerBuffer.data(), 4);
+			if (headerBuffer[0] != 'F' ||
+				headerBuffer[1] != 'I' ||
+				headerBuffer[2] != 'S' ||
+				headerBuffer[3] != '\0')
+			{
+				throw std::runtime_error("Invalid file system state files header");
+			}
+
+			auto maxFileId = ReadUInt32(data, size, offset);
+			auto fileCount = ReadUInt32(data, size, offset);
+			auto files = std::unordered_map<FileId, Path>();
+			for (auto i = 0u; i < fileCount; i++)
+			{
+				auto fileId = ReadUInt32(data, size, offset);
+				auto file = Path(ReadString(data, size, offset));
+
+				auto insertResult = files.emplace(fileId, std::move(file));
+				if (!insertResult.second)
+					throw std::runtime_error("Duplicate file id in file system state");
+			}
+
+			// Read the set of preloaded directories
+			Read(data, size, offset, headerBuffer.data(), 4);
+			if (headerBuffer[0] != 'P' ||
+				headerBuffer[1] != 'D' ||
+				headerBuffer[2] != 'S' ||
+				headerBuffer[3] != '\0')
+			{
+				throw std::runtime_error("Invalid file system state preloaded directories header");
+			}
+
+			auto preloadedDirectoryCount = ReadUInt32(data, size, offset);
+			auto preloadedDirectories = std::unordered_map<FileId, PreloadedDirectoryState>();
+			for (auto i = 0u; i < preloadedDirectoryCount; i++)
+			{
+				auto directoryId = ReadUInt32(data, size, offset);
+				auto trackDirectories = ReadBoolean(data, size, offset);
+				auto children = ReadFileIdList(data, size, offset);
+
+				preloadedDirectories.emplace(
+					directoryId,
+					PreloadedDirectoryState({ trackDirectories, std::move(children) }));
+			}
+
+			// Read the tracked directory structure
+			Read(data, size, offset, headerBuffer.data(), 4);
+			if (headerBuffer[0] != 'D' ||
+				headerBuffer[1] != 'L' ||
+				headerBuffer[2] != 'S' ||
+				headerBuffer[3] != '\0')
+			{
+				throw std::runtime_error("Invalid file system state directory lookup header");
+			}
+
+			auto directoryLookup = std::unordered_map<std::string, DirectoryState, string_hash, std::equal_to<>>();
+			ReadDirectoryLookup(data, size, offset, directoryLookup);
+
+			// Read the cached write times
+			Read(data, size, offset, headerBuffer.data(), 4);
+			if (headerBuffer[0] != 'W' ||
+				headerBuffer[1] != 'T' ||
+				headerBuffer[2] != 'C' ||
+				headerBuffer[3] != '\0')
+			{
+				throw std::runtime_error("Invalid file system state write cache header");
+			}
+
+			auto writeCacheCount = ReadUInt32(data, size, offset);
+			auto writeCache = std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>();
+			for (auto i = 0u; i < writeCacheCount; i++)
+			{
+				auto fileId = ReadUInt32(data, size, offset);
+				auto hasValue = ReadBoolean(data, size, offset);
+				auto lastWriteTime = std::optional<std::chrono::time_point<std::chrono::file_clock>>();
+				if (hasValue)
+					lastWriteTime = ReadTime(data, size, offset);
+
+				writeCache.emplace(fileId, lastWriteTime);
+			}
+
+			return FileSystemState(
+				maxFileId,
+				std::move(files),
+				std::move(directoryLookup),
+				std::move(writeCache),
+				std::move(preloadedDirectories),
+				journalSessionId,
+				journalOffset);
+		}
+
+		static void ReadDirectoryLookup(
+			char* data,
+			size_t size,
+			size_t& offset,
+			std::unordered_map<std::string, DirectoryState, string_hash, std::equal_to<>>& directories)
+		{
+			auto directoryCount = ReadUInt32(data, size, offset);
+			for (auto i = 0u; i < directoryCount; i++)
+			{
+				auto name = ReadString(data, size, offset);
+				auto& directoryState = directories.emplace(std::move(name), DirectoryState()).first->second;
+
+				auto fileCount = ReadUInt32(data, size, offset);
+				for (auto j = 0u; j < fileCount; j++)
+				{
+					directoryState.Files.insert(ReadString(data, size, offset));
+				}
+
+				ReadDirectoryLookup(data, size, offset, directoryState.ChildDirectories);
+			}
+		}
+
+		static std::chrono::time_point<std::chrono::file_clock> ReadTime(char* data, size_t size, size_t& offset)
+		{
+			// Read the tick offset of the system clock since its epoch
+			auto ticks = ReadInt64(data, size, offset);
+			auto duration = ContentDuration(ticks);
+
+			// Use system clock with a known epoch
+			auto timeSystem = std::chrono::time_point<std::chrono::system_clock>(duration);
+			#ifdef _WIN32
+			return std::chrono::clock_cast<std::chrono::file_clock>(timeSystem);
+			#else
+			return std::chrono::file_clock::from_sys(timeSystem);
+			#endif
+		}
+
+		static uint32_t ReadUInt32(char* data, size_t size, size_t& offset)
+		{
+			uint32_t result = 0;
+			Read(data, size, offset, reinterpret_cast<char*>(&result), sizeof(uint32_t));
+
+			return result;
+		}
+
+		static int64_t ReadInt64(char* data, size_t size, size_t& offset)
+		{
+			int64_t result = 0;
+			Read(data, size, offset, reinterpret_cast<char*>(&result), sizeof(int64_t));
+
+			return result;
+		}
+
+		static bool ReadBoolean(char* data, size_t size, size_t& offset)
+		{
+			uint32_t result = 0;
+			Read(data, size, offset, reinterpret_cast<char*>(&result), sizeof(uint32_t));
+
+			return result != 0;
+		}
+
+		static std::string ReadString(char* data, size_t size, size_t& offset)
+		{
+			auto stringLength = ReadUInt32(data, size, offset);
+			auto result = std::string(stringLength, '\0');
+			Read(data, size, offset, result.data(), stringLength);
+
+			return result;
+		}
+
+		static std::vector<FileId> ReadFileIdList(char* data, size_t size, size_t& offset)
+		{
+			auto listLength = ReadUInt32(data, size, offset);
+			auto result = std::vector<FileId>(listLength);
+			for (auto i = 0u; i < listLength; i++)
+			{
+				result[i] = ReadUInt32(data, size, offset);
+			}
+
+			return result;
+		}
+
+		static void Read(char* data, size_t size, size_t& offset, char* buffer, size_t count)
+		{
+			if (offset + count > size)
+				throw std::runtime_error("Tried to read past end of data");
+			memcpy(buffer, data + offset, count);
+			offset += count;
+		}
+	};
+}
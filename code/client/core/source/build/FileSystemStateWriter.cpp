@@ -0,0 +1,166 @@
+﻿// <copyright file="FileSystemStateWriter.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <chrono>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+export module Soup.Core:FileSystemStateWriter;
+
+import Opal;
+import :FileSystemState;
+
+using namespace Opal;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The file system state snapshot writer
+	/// </summary>
+	export class FileSystemStateWriter
+	{
+	private:
+		// Binary File System State file format
+		static constexpr uint32_t FileVersion = 2;
+
+		// The time duration that represents how we store the values in the file using 64 bit integer with resolution of 100 nanoseconds
+		// Note: Unix Time, time since 00:00:00 Coordinated Universal Time (UTC), Thursday, 1 January 1970, not counting leap seconds
+		using ContentTimePeriod = std::ratio<1, 10'000'000>;
+		using ContentDuration = std::chrono::duration<long long, ContentTimePeriod>;
+
+	public:
+		static void Serialize(
+			const FileSystemState& state,
+			std::ostream& stream)
+		{
+			// Write the File Header with version
+			stream.write("BFS\0", 4);
+			WriteValue(stream, FileVersion);
+
+			// Write out the position in the file system journal the write times are valid for
+			stream.write("JNL\0", 4);
+			WriteValue(stream, state.GetJournalSessionId());
+			WriteValue(stream, static_cast<int64_t>(state.GetJournalOffset()));
+
+			// Write out the set of files, the files are visited in id order which keeps the output stable
+			stream.write("FIS\0", 4);
+			WriteValue(stream, state.GetMaxFileId());
+			WriteValue(stream, static_cast<uint32_t>(state.GetFileCount()));
+			state.VisitFiles([&stream](FileId fileId, std::string_view file)
+			{
+				// Write the file id + path length + path
+				WriteValue(stream, fileId);
+				WriteValue(stream, file);
+			});
+
+			// Write out the set of preloaded directories
+			auto preloadedDirectories = std::map<FileId, const PreloadedDirectoryState*>();
+			for (auto& [directoryId, directoryState] : state.GetPreloadedDirectories())
+				preloadedDirectories.emplace(directoryId, &directoryState);
+
+			stream.write("PDS\0", 4);
+			WriteValue(stream, static_cast<uint32_t>(preloadedDirectories.size()));
+			for (auto& [directoryId, directoryState] : preloadedDirectories)
+			{
+				WriteValue(stream, directoryId);
+				WriteValue(stream, directoryState->TrackDirectories);
+				WriteValues(stream, directoryState->Children);
+			}
+
+			// Write out the tracked directory structure
+			stream.write("DLS\0", 4);
+			WriteDirectoryLookup(stream, state.GetDirectoryLookup());
+
+			// Write out the cached write times
+			auto writeCache = std::map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>(
+				state.GetWriteCache().begin(),
+				state.GetWriteCache().end());
+
+			stream.write("WTC\0", 4);
+			WriteValue(stream, static_cast<uint32_t>(writeCache.size()));
+			for (auto& [fileId, lastWriteTime] : writeCache)
+			{
+				WriteValue(stream, fileId);
+				WriteValue(stream, lastWriteTime.has_value());
+				if (lastWriteTime.has_value())
+					WriteValue(stream, lastWriteTime.value());
+			}
+		}
+
+	private:
+		static void WriteDirectoryLookup(
+			std::ostream& stream,
+			const std::unordered_map<std::string, DirectoryState, string_hash, std::equal_to<>>& directories)
+		{
+			auto sortedDirectories = std::map<std::string_view, const DirectoryState*>();
+			for (auto& [name, directoryState] : directories)
+				sortedDirectories.emplace(name, &directoryState);
+
+			WriteValue(stream, static_cast<uint32_t>(sortedDirectories.size()));
+			for (auto& [name, directoryState] : sortedDirectories)
+			{
+				WriteValue(stream, name);
+
+				WriteValue(stream, static_cast<uint32_t>(directoryState->Files.size()));
+				for (auto& file : directoryState->Files)
+					WriteValue(stream, file);
+
+				WriteDirectoryLookup(stream, directoryState->ChildDirectories);
+			}
+		}
+
+		static void WriteValue(std::ostream& stream, std::chrono::time_point<std::chrono::file_clock> value)
+		{
+			// Use system clock with a known epoch
+			#ifdef _WIN32
+			auto valueSystem = std::chrono::clock_cast<std::chrono::system_clock>(value);
+			#else
+			auto valueSystem = std::chrono::file_clock::to_sys(value);
+			#endif
+
+			// Write the tick offset of the system clock since its epoch
+			auto valueDuration = std::chrono::duration_cast<ContentDuration>(valueSystem.time_since_epoch());
+			int64_t valueCount = valueDuration.count();
+			WriteValue(stream, valueCount);
+		}
+
+		static void WriteValue(std::ostream& stream, uint32_t value)
+		{
+			stream.write(reinterpret_cast<char*>(&value), sizeof(uint32_t));
+		}
+
+		static void WriteValue(std::ostream& stream, int64_t value)
+		{
+			stream.write(reinterpret_cast<char*>(&value), sizeof(int64_t));
+		}
+
+		static void WriteValue(std::ostream& stream, bool value)
+		{
+			uint32_t integerValue = value ? 1u : 0u;
+			stream.write(reinterpret_cast<char*>(&integerValue), sizeof(uint32_t));
+		}
+
+		static void WriteValue(std::ostream& stream, std::string_view value)
+		{
+			WriteValue(stream, static_cast<uint32_t>(value.size()));
+			stream.write(value.data(), value.size());
+		}
+
+		static void WriteValues(std::ostream& stream, const std::vector<uint32_t>& values)
+		{
+			WriteValue(stream, static_cast<uint32_t>(values.size()));
+			for (auto& value : values)
+			{
+				WriteValue(stream, value);
+			}
+		}
+	};
+}
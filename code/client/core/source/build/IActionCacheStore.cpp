@@ -0,0 +1,35 @@
+﻿// <copyright file="IActionCacheStore.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <string>
+
+export module Soup.Core:IActionCacheStore;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The storage backend for the action cache.
+	/// A simple key value store that allows the cache to live in a local directory or be served by a shared remote.
+	/// </summary>
+	export class IActionCacheStore
+	{
+	public:
+		/// <summary>
+		/// Load the content for the requested key if it exists
+		/// </summary>
+		virtual bool TryLoad(const std::string& key, std::string& content) = 0;
+
+		/// <summary>
+		/// Save the content for the provided key, replacing any existing content
+		/// </summary>
+		virtual void Store(const std::string& key, const std::string& content) = 0;
+
+		/// <summary>
+		/// Persist any pending changes to the backing storage
+		/// </summary>
+		virtual void Flush() = 0;
+	};
+}
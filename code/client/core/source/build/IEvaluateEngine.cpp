@@ -9,8 +9,9 @@ module;
 export module Soup.Core:IEvaluateEngine;
 
 import Opal;
-import :OperationGraph;
+import :CompactOperationGraph;
 import :OperationResults;
+import :OperationResultsJournal;
 
 using namespace Opal;
 
@@ -25,10 +26,12 @@ namespace Soup::Core
 		/// <summary>
 		/// Execute the entire operation graph that is referenced by this build evaluate engine
 		/// Returns true if any of the operations were evaluated
+		/// The results of each completed operation are appended to the journal when provided
 		/// </summary>
 		virtual bool Evaluate(
-			const OperationGraph& operationGraph,
+			const CompactOperationGraph& operationGraph,
 			OperationResults& operationResults,
+			OperationResultsJournal* operationResultsJournal,
 			const Path& temporaryDirectory,
 			const std::vector<Path>& globalAllowedReadAccess,
 			const std::vector<Path>& globalAllowedWriteAccess) = 0;
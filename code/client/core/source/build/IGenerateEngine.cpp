@@ -0,0 +1,40 @@
+﻿// <copyright file="IGenerateEngine.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <vector>
+
+export module Soup.Core:IGenerateEngine;
+
+import Opal;
+import :FileSystemState;
+import :RecipeCache;
+import :Value;
+
+using namespace Opal;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The build generate interface that knows how to run the generate phase for a single package
+	/// within the current process.
+	/// </summary>
+	export class IGenerateEngine
+	{
+	public:
+		/// <summary>
+		/// Run the generate phase using the provided input table.
+		/// The file system state and recipe cache belong to this call, the build state lock is not held
+		/// while it runs. All files that were read or written are reported back to be used for future incremental builds
+		/// </summary>
+		virtual void Generate(
+			const Path& soupTargetDirectory,
+			const ValueTable& inputTable,
+			FileSystemState& fileSystemState,
+			RecipeCache& recipeCache,
+			std::vector<Path>& observedInput,
+			std::vector<Path>& observedOutput) = 0;
+	};
+}
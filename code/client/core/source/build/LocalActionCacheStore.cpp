@@ -0,0 +1,375 @@
+﻿// <copyright file="LocalActionCacheStore.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <array>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+export module Soup.Core:LocalActionCacheStore;
+
+import Opal;
+import :IActionCacheStore;
+
+using namespace Opal;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// An action cache store that keeps each entry as a file in a shared local directory.
+	/// The total size is bounded by evicting the least recently used entries, the usage
+	/// order is tracked in an index file within the directory. Multiple builds may share the
+	/// directory so the index is merged with the latest saved copy before it is replaced.
+	/// </summary>
+	export class LocalActionCacheStore : public IActionCacheStore
+	{
+	private:
+		// Binary Action Cache Index file format
+		static constexpr uint32_t FileVersion = 1;
+
+	public:
+		// The default upper bound on the size of all entries in the cache
+		static constexpr uint64_t DefaultMaxSize = 10ull * 1024 * 1024 * 1024;
+
+	private:
+
+		struct IndexEntry
+		{
+			uint64_t Size;
+			uint64_t LastAccess;
+		};
+
+		Path _directory;
+		uint64_t _maxSize;
+
+		bool _isIndexLoaded;
+		bool _isIndexModified;
+		uint64_t _totalSize;
+		uint64_t _accessCounter;
+		std::unordered_map<std::string, IndexEntry> _entries;
+		std::map<uint64_t, std::string> _accessOrder;
+
+	public:
+		static const Path& IndexFileName()
+		{
+			static const auto value = Path("./Index.bai");
+			return value;
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="LocalActionCacheStore"/> class.
+		/// </summary>
+		LocalActionCacheStore(Path directory, uint64_t maxSize) :
+			_directory(std::move(directory)),
+			_maxSize(maxSize),
+			_isIndexLoaded(false),
+			_isIndexModified(false),
+			_totalSize(0),
+			_accessCounter(0),
+			_entries(),
+			_accessOrder()
+		{
+		}
+
+		/// <summary>
+		/// Load the content for the requested key if it exists
+		/// </summary>
+		bool TryLoad(const std::string& key, std::string& content) override final
+		{
+			EnsureIndexLoaded();
+
+			auto findEntry = _entries.find(key);
+			if (findEntry == _entries.end())
+				return false;
+
+			std::shared_ptr<System::IInputFile> file;
+			if (!System::IFileSystem::Current().TryOpenRead(_directory + Path(key), true, file))
+			{
+				// The entry was removed outside of the cache
+				RemoveEntry(findEntry);
+				return false;
+			}
+
+			auto& stream = file->GetInStream();
+			content = std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+
+			// Move the entry to the back of the eviction order
+			_accessOrder.erase(findEntry->second.LastAccess);
+			findEntry->second.LastAccess = ++_accessCounter;
+			_accessOrder.emplace(findEntry->second.LastAccess, key);
+			_isIndexModified = true;
+
+			return true;
+		}
+
+		/// <summary>
+		/// Save the content for the provided key, replacing any existing content
+		/// </summary>
+		void Store(const std::string& key, const std::string& content) override final
+		{
+			EnsureIndexLoaded();
+
+			auto file = System::IFileSystem::Current().OpenWrite(_directory + Path(key), true);
+			file->GetOutStream().write(content.data(), content.size());
+
+			auto findEntry = _entries.find(key);
+			if (findEntry != _entries.end())
+				RemoveEntry(findEntry);
+
+			auto entry = IndexEntry({ content.size(), ++_accessCounter });
+			_entries.emplace(key, entry);
+			_accessOrder.emplace(entry.LastAccess, key);
+			_totalSize += entry.Size;
+			_isIndexModified = true;
+
+			Evict();
+		}
+
+		/// <summary>
+		/// Save the index so the usage order is known to the next build
+		/// </summary>
+		void Flush() override final
+		{
+			if (!_isIndexModified)
+				return;
+
+			// Keep the entries stored by other builds since the index was loaded, otherwise their
+			// content would no longer be tracked and could never be evicted
+			MergeSavedIndex();
+			Evict();
+
+			auto file = System::IFileSystem::Current().OpenWrite(_directory + IndexFileName(), true);
+			auto& stream = file->GetOutStream();
+
+			// Write the File Header with version
+			stream.write("BAI\0", 4);
+			WriteValue(stream, FileVersion);
+
+			// Write out the entries in the order they were used
+			stream.write("ENT\0", 4);
+			WriteValue(stream, static_cast<uint32_t>(_accessOrder.size()));
+			for (auto& [lastAccess, key] : _accessOrder)
+			{
+				auto& entry = _entries.at(key);
+				WriteValue(stream, static_cast<uint32_t>(key.size()));
+				stream.write(key.data(), key.size());
+				WriteValue(stream, entry.Size);
+			}
+
+			_isIndexModified = false;
+		}
+
+		/// <summary>
+		/// Get the total size of all entries in the cache
+		/// </summary>
+		uint64_t GetTotalSize()
+		{
+			EnsureIndexLoaded();
+			return _totalSize;
+		}
+
+	private:
+		/// <summary>
+		/// Remove the least recently used entries until the cache fits within the max size
+		/// </summary>
+		void Evict()
+		{
+			while (_totalSize > _maxSize && !_accessOrder.empty())
+			{
+				auto key = _accessOrder.begin()->second;
+				Log::Diag("Evict action cache entry: {}", key);
+
+				// The entry may have already been evicted by another build
+				auto entryFile = _directory + Path(key);
+				if (System::IFileSystem::Current().Exists(entryFile))
+					System::IFileSystem::Current().DeleteFile(entryFile);
+
+				RemoveEntry(_entries.find(key));
+			}
+		}
+
+		void RemoveEntry(std::unordered_map<std::string, IndexEntry>::iterator entry)
+		{
+			_totalSize -= entry->second.Size;
+			_accessOrder.erase(entry->second.LastAccess);
+			_entries.erase(entry);
+			_isIndexModified = true;
+		}
+
+		void EnsureIndexLoaded()
+		{
+			if (_isIndexLoaded)
+				return;
+
+			_isIndexLoaded = true;
+			if (!System::IFileSystem::Current().Exists(_directory))
+			{
+				Log::Info("Create Directory: {}", _directory.ToString());
+				System::IFileSystem::Current().CreateDirectory(_directory);
+				return;
+			}
+
+			std::shared_ptr<System::IInputFile> file;
+			if (!System::IFileSystem::Current().TryOpenRead(_directory + IndexFileName(), true, file))
+			{
+				Log::Info("Action cache index does not exist");
+				return;
+			}
+
+			try
+			{
+				for (auto& [key, size] : ReadIndex(file->GetInStream()))
+				{
+					auto entry = IndexEntry({ size, ++_accessCounter });
+					if (!_entries.emplace(key, entry).second)
+						throw std::runtime_error("Action cache index entry was not unique");
+
+					_accessOrder.emplace(entry.LastAccess, std::move(key));
+					_totalSize += entry.Size;
+				}
+			}
+			catch (std::runtime_error& ex)
+			{
+				// Start over with an empty cache, any orphaned entries will be replaced as they are stored again
+				Log::Warning("Failed to load action cache index: {}", ex.what());
+				_totalSize = 0;
+				_accessCounter = 0;
+				_entries.clear();
+				_accessOrder.clear();
+			}
+		}
+
+		/// <summary>
+		/// Add any entries from the saved index that are not known to this store and still exist.
+		/// Entries this store has evicted no longer exist and are not brought back.
+		/// </summary>
+		void MergeSavedIndex()
+		{
+			std::shared_ptr<System::IInputFile> file;
+			if (!System::IFileSystem::Current().TryOpenRead(_directory + IndexFileName(), true, file))
+				return;
+
+			try
+			{
+				// The unknown entries were stored after this index was loaded, treat them as recently used
+				for (auto& [key, size] : ReadIndex(file->GetInStream()))
+				{
+					if (!_entries.contains(key) &&
+						System::IFileSystem::Current().Exists(_directory + Path(key)))
+					{
+						auto entry = IndexEntry({ size, ++_accessCounter });
+						_entries.emplace(key, entry);
+						_accessOrder.emplace(entry.LastAccess, std::move(key));
+						_totalSize += entry.Size;
+					}
+				}
+			}
+			catch (std::runtime_error& ex)
+			{
+				Log::Warning("Failed to merge action cache index: {}", ex.what());
+			}
+		}
+
+		static std::vector<std::pair<std::string, uint64_t>> ReadIndex(std::istream& stream)
+		{
+			// Read the entire file for fastest read operation
+			stream.seekg(0, std::ios_base::end);
+			auto size = static_cast<size_t>(stream.tellg());
+			stream.seekg(0, std::ios_base::beg);
+
+			auto contentBuffer = std::vector<char>(size);
+			stream.read(contentBuffer.data(), size);
+			auto data = contentBuffer.data();
+			size_t offset = 0;
+
+			// Read the File Header with version
+			auto headerBuffer = std::array<char, 4>();
+			Read(data, size, offset, headerBuffer.data(), 4);
+			if (headerBuffer[0] != 'B' ||
+				headerBuffer[1] != 'A' ||
+				headerBuffer[2] != 'I' ||
+				headerBuffer[3] != '\0')
+			{
+				throw std::runtime_error("Invalid action cache index file header");
+			}
+
+			auto fileVersion = ReadUInt32(data, size, offset);
+			if (fileVersion != FileVersion)
+			{
+				throw std::runtime_error("Action cache index file version does not match expected");
+			}
+
+			Read(data, size, offset, headerBuffer.data(), 4);
+			if (headerBuffer[0] != 'E' ||
+				headerBuffer[1] != 'N' ||
+				headerBuffer[2] != 'T' ||
+				headerBuffer[3] != '\0')
+			{
+				throw std::runtime_error("Invalid action cache index entries header");
+			}
+
+			// The entries are saved from least to most recently used
+			auto entryCount = ReadUInt32(data, size, offset);
+			auto result = std::vector<std::pair<std::string, uint64_t>>();
+			for (auto i = 0u; i < entryCount; i++)
+			{
+				auto keyLength = ReadUInt32(data, size, offset);
+				auto key = std::string(keyLength, '\0');
+				Read(data, size, offset, key.data(), keyLength);
+
+				auto entrySize = ReadUInt64(data, size, offset);
+				result.emplace_back(std::move(key), entrySize);
+			}
+
+			if (offset != size)
+			{
+				throw std::runtime_error("Action cache index file corrupted - Did not read the entire file");
+			}
+
+			return result;
+		}
+
+		static uint32_t ReadUInt32(char* data, size_t size, size_t& offset)
+		{
+			uint32_t result = 0;
+			Read(data, size, offset, reinterpret_cast<char*>(&result), sizeof(uint32_t));
+
+			return result;
+		}
+
+		static uint64_t ReadUInt64(char* data, size_t size, size_t& offset)
+		{
+			uint64_t result = 0;
+			Read(data, size, offset, reinterpret_cast<char*>(&result), sizeof(uint64_t));
+
+			return result;
+		}
+
+		static void Read(char* data, size_t size, size_t& offset, char* buffer, size_t count)
+		{
+			if (offset + count > size)
+				throw std::runtime_error("Tried to read past end of data");
+			memcpy(buffer, data + offset, count);
+			offset += count;
+		}
+
+		static void WriteValue(std::ostream& stream, uint32_t value)
+		{
+			stream.write(reinterpret_cast<char*>(&value), sizeof(uint32_t));
+		}
+
+		static void WriteValue(std::ostream& stream, uint64_t value)
+		{
+			stream.write(reinterpret_cast<char*>(&value), sizeof(uint64_t));
+		}
+	};
+}
@@ -4,8 +4,12 @@
 
 module;
 
+#include <algorithm>
+#include <deque>
+#include <limits>
 #include <map>
 #include <string>
+#include <vector>
 
 export module Soup.Core:MacroManager;
 
@@ -17,47 +21,177 @@ namespace Soup::Core
 {
 	/// <summary>
 	/// The macro manager handles all things macro... It just replaces stuff.
+	/// All of the macros are compiled into a single matcher (Aho-Corasick) so a value is resolved
+	/// in one pass over its characters no matter how many macros are known.
 	/// </summary>
 	export class MacroManager
 	{
 	private:
+		static constexpr uint32_t RootNode = 0;
+		static constexpr uint32_t NoMatch = std::numeric_limits<uint32_t>::max();
+
+		struct MatchNode
+		{
+			// The sorted transitions to the next nodes
+			std::vector<std::pair<char, uint32_t>> Next;
+
+			// The node for the longest suffix of the current match that is also a macro prefix
+			uint32_t Fail;
+
+			// The longest macro that ends at this node, or NoMatch
+			uint32_t Match;
+		};
+
 		const std::map<std::string, std::string>& _macros;
+		std::vector<const std::pair<const std::string, std::string>*> _macroValues;
+		std::vector<MatchNode> _nodes;
 
 	public:
 		MacroManager(
 			const std::map<std::string, std::string>& macros) :
-			_macros(macros)
+			_macros(macros),
+			_macroValues(),
+			_nodes()
 		{
+			BuildMatcher();
 		}
 
-		Path ResolveMacros(Path value)
+		Path ResolveMacros(Path value) const
 		{
 			// TODO: Is there a way to not process the path again?
 			auto rawValue = std::move(value.ToString());
 			return Path(ResolveMacros(std::move(rawValue)));
 		}
 
-		std::string ResolveMacros(std::string value)
+		std::string ResolveMacros(std::string value) const
+		{
+			auto result = std::string();
+			size_t copiedOffset = 0;
+			uint32_t node = RootNode;
+			for (size_t i = 0; i < value.size(); i++)
+			{
+				node = GetNextNode(node, value[i]);
+				auto match = _nodes[node].Match;
+				if (match == NoMatch)
+					continue;
+
+				// Copy the text before the macro and the real value
+				auto& [macro, macroValue] = *_macroValues[match];
+				if (copiedOffset == 0 && result.empty())
+					result.reserve(value.size() + macroValue.size());
+
+				auto macroStart = i + 1 - macro.size();
+				result.append(value, copiedOffset, macroStart - copiedOffset);
+				result.append(macroValue);
+				copiedOffset = i + 1;
+
+				// Macros do not overlap, start a fresh match after the replaced text
+				node = RootNode;
+			}
+
+			// Nothing to replace, hand back the original value
+			if (copiedOffset == 0)
+				return value;
+
+			result.append(value, copiedOffset, std::string::npos);
+			return result;
+		}
+
+	private:
+		void BuildMatcher()
 		{
-			for (auto& [macro, macroValue] : _macros)
+			_nodes.push_back(MatchNode({ {}, RootNode, NoMatch }));
+
+			// Add each macro to the prefix tree
+			for (auto& macro : _macros)
 			{
-				for(size_t i = 0; ; i += macroValue.length())
+				if (macro.first.empty())
+					continue;
+
+				uint32_t node = RootNode;
+				for (auto value : macro.first)
 				{
-					// Find the next instance of the macro
-					i = value.find(macro, i);
+					uint32_t next;
+					if (!TryGetTransition(node, value, next))
+					{
+						next = static_cast<uint32_t>(_nodes.size());
+						_nodes.push_back(MatchNode({ {}, RootNode, NoMatch }));
+						auto& transitions = _nodes[node].Next;
+						transitions.insert(
+							std::lower_bound(
+								transitions.begin(),
+								transitions.end(),
+								value,
+								[](const auto& transition, char value) { return transition.first < value; }),
+							{ value, next });
+					}
+
+					node = next;
+				}
+
+				_nodes[node].Match = static_cast<uint32_t>(_macroValues.size());
+				_macroValues.push_back(&macro);
+			}
 
-					// No more instances, early exit
-					if(i == std::string::npos)
-						break;
+			// Link each node to its longest proper suffix in breadth first order so the
+			// shorter nodes are complete before they are used
+			auto queue = std::deque<uint32_t>();
+			for (auto& [value, next] : _nodes[RootNode].Next)
+				queue.push_back(next);
 
-					// Erase the macro and insert the real value
-					// TODO: Less than ideal, but gets the job done
-					value.erase(i, macro.length());
-					value.insert(i, macroValue);
+			while (!queue.empty())
+			{
+				auto node = queue.front();
+				queue.pop_front();
+				for (auto& [value, next] : _nodes[node].Next)
+				{
+					auto fail = _nodes[node].Fail;
+					uint32_t failNext;
+					while (fail != RootNode && !TryGetTransition(fail, value, failNext))
+						fail = _nodes[fail].Fail;
+
+					_nodes[next].Fail =
+						TryGetTransition(fail, value, failNext) && failNext != next ? failNext : RootNode;
+
+					// Use the longest macro that ends here
+					if (_nodes[next].Match == NoMatch)
+						_nodes[next].Match = _nodes[_nodes[next].Fail].Match;
+
+					queue.push_back(next);
+				}
+			}
+		}
+
+		uint32_t GetNextNode(uint32_t node, char value) const
+		{
+			uint32_t next;
+			while (!TryGetTransition(node, value, next))
+			{
+				if (node == RootNode)
+					return RootNode;
+
+				node = _nodes[node].Fail;
+			}
+
+			return next;
+		}
+
+		bool TryGetTransition(uint32_t node, char value, uint32_t& next) const
+		{
+			for (auto& transition : _nodes[node].Next)
+			{
+				if (transition.first == value)
+				{
+					next = transition.second;
+					return true;
+				}
+				else if (transition.first > value)
+				{
+					break;
 				}
 			}
 
-			return value;
+			return false;
 		}
 	};
 }
\ No newline at end of file
@@ -0,0 +1,258 @@
+﻿// <copyright file="OperationOutputSink.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+export module Soup.Core:OperationOutputSink;
+
+import Opal;
+import Monitor.Host;
+
+using namespace Opal;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// Receives the output of a single operation as it runs and queues each completed line to be logged
+	/// prefixed with the operation title so output stays readable when operations run in parallel.
+	/// The output arrives on the monitor threads, the owner of the build state logs the queued lines.
+	/// Standard output is retained to report on failure, up to a maximum size in memory and the
+	/// remainder is spilled to a file.
+	/// </summary>
+	export class OperationOutputSink : public Monitor::IProcessOutputSink
+	{
+	public:
+		static constexpr size_t DefaultMaxBufferSize = 1024 * 1024;
+
+	private:
+		struct QueuedLine
+		{
+			std::string Text;
+			bool IsError;
+		};
+
+		std::string _operationTitle;
+		size_t _maxBufferSize;
+		Path _spillDirectory;
+		std::string _spillFileName;
+
+		std::string _standardOutputLine;
+		std::string _standardErrorLine;
+
+		std::string _standardOutput;
+		std::shared_ptr<System::IOutputFile> _spillOutput;
+		size_t _spilledSize;
+
+		uint64_t _peakMemoryUsage;
+
+		std::mutex _queuedLinesMutex;
+		std::vector<QueuedLine> _queuedLines;
+		std::function<void()> _linesQueued;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="OperationOutputSink"/> class.
+		/// </summary>
+		OperationOutputSink(
+			std::string operationTitle,
+			size_t maxBufferSize,
+			Path spillDirectory,
+			std::string spillFileName) :
+			_operationTitle(std::move(operationTitle)),
+			_maxBufferSize(maxBufferSize),
+			_spillDirectory(std::move(spillDirectory)),
+			_spillFileName(std::move(spillFileName)),
+			_standardOutputLine(),
+			_standardErrorLine(),
+			_standardOutput(),
+			_spillOutput(nullptr),
+			_spilledSize(0),
+			_peakMemoryUsage(0),
+			_queuedLinesMutex(),
+			_queuedLines(),
+			_linesQueued()
+		{
+		}
+
+		/// <summary>
+		/// Set the callback that is notified when new lines are queued, called on the thread that received the output
+		/// </summary>
+		void SetLinesQueuedCallback(std::function<void()> linesQueued)
+		{
+			_linesQueued = std::move(linesQueued);
+		}
+
+		virtual void OnStandardOutput(std::string_view chunk) override final
+		{
+			RetainStandardOutput(chunk);
+			QueueLines(chunk, _standardOutputLine, false);
+		}
+
+		virtual void OnStandardError(std::string_view chunk) override final
+		{
+			QueueLines(chunk, _standardErrorLine, true);
+		}
+
+		virtual void OnProcessExit(uint64_t peakMemoryUsage) override final
+		{
+			_peakMemoryUsage = peakMemoryUsage;
+		}
+
+		/// <summary>
+		/// Log the lines that have been queued so far, must be called by the owner of the build state
+		/// </summary>
+		void LogQueuedLines()
+		{
+			auto queuedLines = std::vector<QueuedLine>();
+			{
+				auto lock = std::unique_lock<std::mutex>(_queuedLinesMutex);
+				queuedLines.swap(_queuedLines);
+			}
+
+			for (auto& line : queuedLines)
+			{
+				if (line.IsError)
+					Log::Error("{}: {}", _operationTitle, line.Text);
+				else
+					Log::Info("{}: {}", _operationTitle, line.Text);
+			}
+		}
+
+		/// <summary>
+		/// Log any remaining lines including the trailing partial lines once the process has exited
+		/// </summary>
+		void Flush()
+		{
+			if (!_standardOutputLine.empty())
+			{
+				QueueLine(_standardOutputLine, false);
+				_standardOutputLine.clear();
+			}
+
+			if (!_standardErrorLine.empty())
+			{
+				QueueLine(_standardErrorLine, true);
+				_standardErrorLine.clear();
+			}
+
+			LogQueuedLines();
+
+			if (_spillOutput != nullptr)
+			{
+				_spillOutput->GetOutStream().flush();
+				_spillOutput = nullptr;
+			}
+		}
+
+		/// <summary>
+		/// Get the standard output that was retained in memory
+		/// </summary>
+		const std::string& GetStandardOutput() const
+		{
+			return _standardOutput;
+		}
+
+		/// <summary>
+		/// Get the number of bytes of standard output that did not fit in memory
+		/// </summary>
+		size_t GetSpilledSize() const
+		{
+			return _spilledSize;
+		}
+
+		/// <summary>
+		/// Get the peak resident memory in bytes reported when the process exited
+		/// </summary>
+		uint64_t GetPeakMemoryUsage() const
+		{
+			return _peakMemoryUsage;
+		}
+
+		/// <summary>
+		/// Get the file that holds the standard output that did not fit in memory
+		/// </summary>
+		Path GetSpillFile() const
+		{
+			return _spillDirectory + Path(_spillFileName);
+		}
+
+	private:
+		void RetainStandardOutput(std::string_view chunk)
+		{
+			// Keep as much as fits in memory
+			auto retainSize = std::min(chunk.size(), _maxBufferSize - _standardOutput.size());
+			_standardOutput.append(chunk.substr(0, retainSize));
+
+			// Write the remainder to the spill file
+			auto spillChunk = chunk.substr(retainSize);
+			if (!spillChunk.empty())
+			{
+				if (_spillOutput == nullptr)
+					_spillOutput = System::IFileSystem::Current().OpenWrite(GetSpillFile(), true);
+
+				_spillOutput->GetOutStream().write(spillChunk.data(), spillChunk.size());
+				_spilledSize += spillChunk.size();
+			}
+		}
+
+		void QueueLines(std::string_view chunk, std::string& pendingLine, bool isError)
+		{
+			bool queuedAny = false;
+			size_t offset = 0;
+			while (offset < chunk.size())
+			{
+				auto end = chunk.find('\n', offset);
+				if (end == std::string_view::npos)
+				{
+					// Hold on to the partial line until the rest arrives, unless it grows past the buffer size
+					pendingLine.append(chunk.substr(offset));
+					if (pendingLine.size() >= _maxBufferSize)
+					{
+						QueueLine(pendingLine, isError);
+						pendingLine.clear();
+						queuedAny = true;
+					}
+
+					break;
+				}
+
+				auto line = chunk.substr(offset, end - offset);
+				if (pendingLine.empty())
+				{
+					QueueLine(line, isError);
+				}
+				else
+				{
+					pendingLine.append(line);
+					QueueLine(pendingLine, isError);
+					pendingLine.clear();
+				}
+
+				queuedAny = true;
+				offset = end + 1;
+			}
+
+			if (queuedAny && _linesQueued)
+				_linesQueued();
+		}
+
+		void QueueLine(std::string_view line, bool isError)
+		{
+			if (line.ends_with('\r'))
+				line.remove_suffix(1);
+
+			auto lock = std::unique_lock<std::mutex>(_queuedLinesMutex);
+			_queuedLines.push_back({ std::string(line), isError });
+		}
+	};
+}
@@ -0,0 +1,104 @@
+﻿// <copyright file="OperationReadyQueue.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The set of operations whose dependencies have all completed, the operation with the longest
+	/// remaining critical path is run first so the longest chains are started as early as possible.
+	/// Ties are run last in first out to keep a depth first order so that the children of a finished
+	/// operation are started as soon as possible.
+	/// </summary>
+	class OperationReadyQueue
+	{
+	private:
+		struct ReadyOperation
+		{
+			int64_t CriticalPathTime;
+			uint64_t Sequence;
+			OperationId Id;
+		};
+
+		const std::vector<int64_t>& _criticalPathTimes;
+		std::vector<ReadyOperation> _operations;
+		uint64_t _nextSequence;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="OperationReadyQueue"/> class.
+		/// </summary>
+		OperationReadyQueue(const std::vector<int64_t>& criticalPathTimes) :
+			_criticalPathTimes(criticalPathTimes),
+			_operations(),
+			_nextSequence(0)
+		{
+		}
+
+		bool IsEmpty() const
+		{
+			return _operations.empty();
+		}
+
+		void Push(OperationId operationId)
+		{
+			_operations.push_back(ReadyOperation({
+				_criticalPathTimes[operationId],
+				_nextSequence++,
+				operationId,
+			}));
+			std::push_heap(_operations.begin(), _operations.end(), &IsLowerPriority);
+		}
+
+		OperationId Pop()
+		{
+			std::pop_heap(_operations.begin(), _operations.end(), &IsLowerPriority);
+			auto operationId = _operations.back().Id;
+			_operations.pop_back();
+			return operationId;
+		}
+
+		/// <summary>
+		/// Remove the highest priority operation that is allowed to start, the skipped operations keep their place
+		/// </summary>
+		template<typename TCanStart>
+		bool TryPop(TCanStart canStart, OperationId& result)
+		{
+			auto skipped = std::vector<ReadyOperation>();
+			auto found = false;
+			while (!_operations.empty())
+			{
+				std::pop_heap(_operations.begin(), _operations.end(), &IsLowerPriority);
+				auto operation = _operations.back();
+				_operations.pop_back();
+				if (canStart(operation.Id))
+				{
+					result = operation.Id;
+					found = true;
+					break;
+				}
+
+				skipped.push_back(operation);
+			}
+
+			for (auto& operation : skipped)
+			{
+				_operations.push_back(operation);
+				std::push_heap(_operations.begin(), _operations.end(), &IsLowerPriority);
+			}
+
+			return found;
+		}
+
+	private:
+		static bool IsLowerPriority(const ReadyOperation& lhs, const ReadyOperation& rhs)
+		{
+			if (lhs.CriticalPathTime != rhs.CriticalPathTime)
+				return lhs.CriticalPathTime < rhs.CriticalPathTime;
+			else
+				return lhs.Sequence < rhs.Sequence;
+		}
+	};
+}
@@ -0,0 +1,191 @@
+﻿// <copyright file="OperationResourceTracker.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// Tracks the shared resources held by the active operations to decide when another operation can start.
+	/// Each named resource pool allows a limited total weight of operations to run at once and the optional
+	/// memory budget limits the total peak memory the active operations used on their last run.
+	/// A single tracker is shared by every parallel package build so the limits apply to the entire build.
+	/// A pool or budget with nothing active always admits the next operation so an operation that is larger
+	/// than the limit can still run on its own.
+	/// </summary>
+	class OperationResourceTracker
+	{
+	private:
+		std::map<std::string, uint32_t> _poolLimits;
+		uint32_t _defaultPoolLimit;
+		uint64_t _memoryBudget;
+
+		mutable std::mutex _mutex;
+		std::condition_variable _releasedCondition;
+		std::map<std::string, uint32_t> _activePoolWeights;
+		uint64_t _activeMemoryUsage;
+		uint64_t _releaseCount;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="OperationResourceTracker"/> class.
+		/// Pools without an explicit limit use the default limit and a memory budget of zero is unlimited.
+		/// </summary>
+		OperationResourceTracker(
+			std::map<std::string, uint32_t> poolLimits,
+			uint32_t defaultPoolLimit,
+			uint64_t memoryBudget) :
+			_poolLimits(std::move(poolLimits)),
+			_defaultPoolLimit(defaultPoolLimit),
+			_memoryBudget(memoryBudget),
+			_mutex(),
+			_releasedCondition(),
+			_activePoolWeights(),
+			_activeMemoryUsage(0),
+			_releaseCount(0)
+		{
+		}
+
+		OperationResourceTracker(const OperationResourceTracker&) = delete;
+		OperationResourceTracker& operator=(const OperationResourceTracker&) = delete;
+
+		/// <summary>
+		/// Get the memory to reserve for an operation that has no measurement from a previous run.
+		/// Each job is assumed to use an even share of the budget, scaled by the weight of the operation.
+		/// </summary>
+		uint64_t GetDefaultMemoryUsage(const OperationInfo& operation) const
+		{
+			if (_memoryBudget == 0)
+				return 0;
+
+			auto jobShare = _memoryBudget / std::max<uint32_t>(_defaultPoolLimit, 1);
+			return std::min<uint64_t>(jobShare * operation.ResourceWeight, _memoryBudget);
+		}
+
+		/// <summary>
+		/// Check if the operation fits within the remaining resources
+		/// </summary>
+		bool CanStart(const OperationInfo& operation, uint64_t memoryUsage) const
+		{
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			return HasCapacity(operation, memoryUsage);
+		}
+
+		/// <summary>
+		/// Reserve the resources for an operation that is starting
+		/// </summary>
+		void Start(const OperationInfo& operation, uint64_t memoryUsage)
+		{
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			Reserve(operation, memoryUsage);
+		}
+
+		/// <summary>
+		/// Reserve the resources for an operation only if it fits within the remaining resources
+		/// </summary>
+		bool TryStart(const OperationInfo& operation, uint64_t memoryUsage)
+		{
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			if (!HasCapacity(operation, memoryUsage))
+				return false;
+
+			Reserve(operation, memoryUsage);
+			return true;
+		}
+
+		/// <summary>
+		/// Release the resources that were reserved when the operation started and wake any waiting builds
+		/// </summary>
+		void Complete(const OperationInfo& operation, uint64_t memoryUsage)
+		{
+			{
+				auto lock = std::lock_guard<std::mutex>(_mutex);
+
+				if (!operation.ResourcePool.empty())
+				{
+					auto findResult = _activePoolWeights.find(operation.ResourcePool);
+					if (findResult == _activePoolWeights.end() || findResult->second < operation.ResourceWeight)
+						throw std::runtime_error("Released more weight than is active in the resource pool");
+
+					findResult->second -= operation.ResourceWeight;
+					if (findResult->second == 0)
+						_activePoolWeights.erase(findResult);
+				}
+
+				if (_activeMemoryUsage < memoryUsage)
+					throw std::runtime_error("Released more memory than is active");
+
+				_activeMemoryUsage -= memoryUsage;
+				_releaseCount++;
+			}
+
+			_releasedCondition.notify_all();
+		}
+
+		/// <summary>
+		/// Get the number of times resources have been released, used to wait for the next release
+		/// without missing one that happens before the wait starts
+		/// </summary>
+		uint64_t GetReleaseCount() const
+		{
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			return _releaseCount;
+		}
+
+		/// <summary>
+		/// Wait until resources have been released since the provided release count
+		/// </summary>
+		void WaitForRelease(uint64_t releaseCount)
+		{
+			auto lock = std::unique_lock<std::mutex>(_mutex);
+			_releasedCondition.wait(lock, [&]() { return _releaseCount != releaseCount; });
+		}
+
+	private:
+		bool HasCapacity(const OperationInfo& operation, uint64_t memoryUsage) const
+		{
+			if (!operation.ResourcePool.empty())
+			{
+				auto activeWeight = GetActivePoolWeight(operation.ResourcePool);
+				if (activeWeight > 0 && activeWeight + operation.ResourceWeight > GetPoolLimit(operation.ResourcePool))
+					return false;
+			}
+
+			if (_memoryBudget > 0 &&
+				_activeMemoryUsage > 0 &&
+				_activeMemoryUsage + memoryUsage > _memoryBudget)
+			{
+				return false;
+			}
+
+			return true;
+		}
+
+		void Reserve(const OperationInfo& operation, uint64_t memoryUsage)
+		{
+			if (!operation.ResourcePool.empty())
+				_activePoolWeights[operation.ResourcePool] += operation.ResourceWeight;
+
+			_activeMemoryUsage += memoryUsage;
+		}
+
+		uint32_t GetPoolLimit(const std::string& resourcePool) const
+		{
+			auto findResult = _poolLimits.find(resourcePool);
+			if (findResult != _poolLimits.end())
+				return findResult->second;
+			else
+				return _defaultPoolLimit;
+		}
+
+		uint32_t GetActivePoolWeight(const std::string& resourcePool) const
+		{
+			auto findResult = _activePoolWeights.find(resourcePool);
+			if (findResult != _activePoolWeights.end())
+				return findResult->second;
+			else
+				return 0;
+		}
+	};
+}
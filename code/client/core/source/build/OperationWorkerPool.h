@@ -0,0 +1,258 @@
+﻿// <copyright file="OperationWorkerPool.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "OperationResourceTracker.h"
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The in flight state for a single operation process that has been handed off to a worker
+	/// </summary>
+	struct OperationExecution
+	{
+		OperationExecution(
+			const OperationInfo& operation,
+			std::shared_ptr<SystemAccessTracker> monitor,
+			std::shared_ptr<OperationOutputSink> output,
+			std::shared_ptr<System::IProcess> process) :
+			Operation(operation),
+			Monitor(std::move(monitor)),
+			Output(std::move(output)),
+			Process(std::move(process)),
+			StartTime(),
+			Duration(0),
+			ReservedMemoryUsage(0),
+			Exception(nullptr)
+		{
+		}
+
+		const OperationInfo& Operation;
+		std::shared_ptr<SystemAccessTracker> Monitor;
+		std::shared_ptr<OperationOutputSink> Output;
+		std::shared_ptr<System::IProcess> Process;
+
+		// The time before the process was started, an input written after this may have changed after it was read
+		std::chrono::time_point<std::chrono::file_clock> StartTime;
+		std::chrono::microseconds Duration;
+
+		// The memory to reserve from the budget while the process runs
+		uint64_t ReservedMemoryUsage;
+
+		std::exception_ptr Exception;
+
+		/// <summary>
+		/// Run the process to completion and capture any failure to be handled by the owner
+		/// </summary>
+		void Run()
+		{
+			auto span = BuildTraceSpan(Operation.Title, "Operation");
+
+			try
+			{
+				auto startTime = std::chrono::steady_clock::now();
+				Process->Start();
+				Process->WaitForExit();
+				Duration = std::chrono::duration_cast<std::chrono::microseconds>(
+					std::chrono::steady_clock::now() - startTime);
+			}
+			catch (...)
+			{
+				Exception = std::current_exception();
+			}
+		}
+	};
+
+	/// <summary>
+	/// The set of executions that have finished running for a single owner of the worker pool
+	/// and the signal that in flight executions have output waiting to be logged by the owner
+	/// </summary>
+	class OperationCompletionQueue
+	{
+	private:
+		std::mutex _mutex;
+		std::condition_variable _completedCondition;
+		std::deque<std::shared_ptr<OperationExecution>> _completed;
+		bool _hasQueuedOutput;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="OperationCompletionQueue"/> class.
+		/// </summary>
+		OperationCompletionQueue() :
+			_mutex(),
+			_completedCondition(),
+			_completed(),
+			_hasQueuedOutput(false)
+		{
+		}
+
+		OperationCompletionQueue(const OperationCompletionQueue&) = delete;
+		OperationCompletionQueue& operator=(const OperationCompletionQueue&) = delete;
+
+		/// <summary>
+		/// Notify the owner that an execution has completed
+		/// </summary>
+		void Push(std::shared_ptr<OperationExecution> execution)
+		{
+			// Notify while holding the lock, the owner may destroy the queue as soon as it sees the last execution
+			auto lock = std::unique_lock<std::mutex>(_mutex);
+			_completed.push_back(std::move(execution));
+			_completedCondition.notify_one();
+		}
+
+		/// <summary>
+		/// Notify the owner that an in flight execution has queued output
+		/// </summary>
+		void NotifyOutput()
+		{
+			auto lock = std::unique_lock<std::mutex>(_mutex);
+			_hasQueuedOutput = true;
+			_completedCondition.notify_one();
+		}
+
+		/// <summary>
+		/// Block until the next queued execution has completed or an in flight execution has queued output,
+		/// returns null when there is only output to be logged
+		/// </summary>
+		std::shared_ptr<OperationExecution> WaitForCompletedOrOutput()
+		{
+			auto lock = std::unique_lock<std::mutex>(_mutex);
+			_completedCondition.wait(lock, [this]() { return _hasQueuedOutput || !_completed.empty(); });
+
+			_hasQueuedOutput = false;
+			if (_completed.empty())
+				return nullptr;
+
+			auto result = std::move(_completed.front());
+			_completed.pop_front();
+			return result;
+		}
+	};
+
+	/// <summary>
+	/// A fixed size pool of worker threads that run operation processes in parallel.
+	/// The pool may be shared by multiple evaluations so the worker count bounds the total number of active processes.
+	/// A worker takes the first queued execution that fits within the shared resources, reserves them just before
+	/// the process starts and releases them as soon as it exits, so queued work never holds resources.
+	/// The owner is responsible for all other bookkeeping, workers only start and wait for the processes.
+	/// </summary>
+	class OperationWorkerPool
+	{
+	private:
+		struct PendingExecution
+		{
+			std::shared_ptr<OperationExecution> Execution;
+			OperationCompletionQueue* Completion;
+		};
+
+		std::vector<std::thread> _workers;
+		OperationResourceTracker& _resourceTracker;
+
+		std::mutex _mutex;
+		std::condition_variable _pendingCondition;
+		std::deque<PendingExecution> _pending;
+		bool _isShutdown;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="OperationWorkerPool"/> class.
+		/// </summary>
+		OperationWorkerPool(uint32_t workerCount, OperationResourceTracker& resourceTracker) :
+			_workers(),
+			_resourceTracker(resourceTracker),
+			_mutex(),
+			_pendingCondition(),
+			_pending(),
+			_isShutdown(false)
+		{
+			for (auto i = 0u; i < workerCount; i++)
+			{
+				_workers.emplace_back(&OperationWorkerPool::WorkerThread, this);
+			}
+		}
+
+		OperationWorkerPool(const OperationWorkerPool&) = delete;
+		OperationWorkerPool& operator=(const OperationWorkerPool&) = delete;
+
+		/// <summary>
+		/// Finalizes an instance of the <see cref="OperationWorkerPool"/> class.
+		/// Drops any work that has not started and waits for the active processes to exit.
+		/// </summary>
+		~OperationWorkerPool()
+		{
+			{
+				auto lock = std::unique_lock<std::mutex>(_mutex);
+				_isShutdown = true;
+				_pending.clear();
+			}
+
+			_pendingCondition.notify_all();
+			for (auto& worker : _workers)
+			{
+				worker.join();
+			}
+		}
+
+		/// <summary>
+		/// Queue an execution to be run on the next available worker and report back to the completion queue
+		/// </summary>
+		void Queue(std::shared_ptr<OperationExecution> execution, OperationCompletionQueue& completion)
+		{
+			{
+				auto lock = std::unique_lock<std::mutex>(_mutex);
+				_pending.push_back({ std::move(execution), &completion });
+			}
+
+			_pendingCondition.notify_one();
+		}
+
+	private:
+		void WorkerThread()
+		{
+			while (true)
+			{
+				auto pending = PendingExecution();
+				{
+					auto lock = std::unique_lock<std::mutex>(_mutex);
+					_pendingCondition.wait(lock, [&]() { return _isShutdown || TryTakeStartable(pending); });
+					if (_isShutdown)
+						return;
+				}
+
+				auto& execution = *pending.Execution;
+				execution.Run();
+				_resourceTracker.Complete(execution.Operation, execution.ReservedMemoryUsage);
+
+				// Take the lock before waking the workers so a worker cannot miss the release
+				// between checking the queued executions and starting to wait
+				{
+					auto lock = std::unique_lock<std::mutex>(_mutex);
+				}
+
+				_pendingCondition.notify_all();
+				pending.Completion->Push(std::move(pending.Execution));
+			}
+		}
+
+		/// <summary>
+		/// Take the first queued execution that fits within the remaining resources and reserve them
+		/// </summary>
+		bool TryTakeStartable(PendingExecution& result)
+		{
+			for (auto iterator = _pending.begin(); iterator != _pending.end(); ++iterator)
+			{
+				auto& execution = *iterator->Execution;
+				if (_resourceTracker.TryStart(execution.Operation, execution.ReservedMemoryUsage))
+				{
+					result = std::move(*iterator);
+					_pending.erase(iterator);
+					return true;
+				}
+			}
+
+			return false;
+		}
+	};
+}
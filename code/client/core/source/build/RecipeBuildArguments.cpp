@@ -61,6 +61,36 @@ namespace Soup::Core
 		/// </summary>
 		bool ForceRebuild;
 
+		/// <summary>
+		/// Gets or sets a value indicating whether to compare input content hashes when the write times are out of date
+		/// </summary>
+		bool ContentHash;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to restore operation outputs from the shared action cache
+		/// </summary>
+		bool ActionCache;
+
+		/// <summary>
+		/// Gets or sets the maximum number of packages and operations to build in parallel
+		/// </summary>
+		uint32_t MaxJobs = 1;
+
+		/// <summary>
+		/// Gets or sets the maximum size of operation output to keep in memory before it is written to a file
+		/// </summary>
+		uint64_t MaxOutputBufferSize = 1024 * 1024;
+
+		/// <summary>
+		/// Gets or sets the maximum total weight of operations that can run at once in each named resource pool
+		/// </summary>
+		std::map<std::string, uint32_t> ResourcePoolLimits;
+
+		/// <summary>
+		/// Gets or sets the maximum total peak memory in bytes of the operations that can run at once, zero is unlimited
+		/// </summary>
+		uint64_t MemoryBudget = 0;
+
 		/// <summary>
 		/// Equality operator
 		/// </summary>
@@ -4,31 +4,48 @@
 
 module;
 
-#include <set>
+#include <algorithm>
+#include <span>
 #include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
 
 export module Soup.Core:SystemAccessTracker;
 
 import Opal;
 import Monitor.Host;
+import :FileSystemState;
 
 using namespace Opal;
 
 namespace Soup::Core
 {
+	/// <summary>
+	/// Tracks the file system accesses for a single operation as they are reported by the monitor.
+	/// Each unique path is copied once into an arena and the access sets only hold views into it,
+	/// the sets are resolved to file ids once the operation completes.
+	/// </summary>
 	class SystemAccessTracker : public Monitor::ISystemAccessMonitor
 	{
 	private:
+		Path _workingDirectory;
 		int _activeProcessCount;
-		std::set<std::string> _input;
-		std::set<std::string> _inputMissing;
-		std::set<std::string> _output;
-		std::set<std::string> _deleteOnClose;
+		PathNameArena _pathStorage;
+		std::unordered_set<std::string_view> _paths;
+		std::unordered_set<std::string_view> _input;
+		std::unordered_set<std::string_view> _inputMissing;
+		std::unordered_set<std::string_view> _output;
+		std::unordered_set<std::string_view> _deleteOnClose;
 
 	public:
-		SystemAccessTracker() :
+		SystemAccessTracker(Path workingDirectory) :
+			_workingDirectory(std::move(workingDirectory)),
 			_activeProcessCount(0),
+			_pathStorage(),
+			_paths(),
 			_input(),
+			_inputMissing(),
 			_output(),
 			_deleteOnClose()
 		{
@@ -42,21 +59,27 @@ namespace Soup::Core
 			}
 
 			// Cleanup on close delete files
-			for (auto& file : _deleteOnClose)
+			for (auto file : _deleteOnClose)
 			{
-				auto extractOutputResult = _output.extract(file);
-				auto extractInputResult = _input.extract(file);
+				_output.erase(file);
+				_input.erase(file);
 			}
 		}
 
-		std::set<std::string> GetInput()
+		/// <summary>
+		/// Resolve the observed input files to sorted file ids
+		/// </summary>
+		std::vector<FileId> GetInput(FileSystemState& fileSystemState) const
 		{
-			return _input;
+			return ToFileIds(fileSystemState, _input);
 		}
 
-		std::set<std::string> GetOutput()
+		/// <summary>
+		/// Resolve the observed output files to sorted file ids
+		/// </summary>
+		std::vector<FileId> GetOutput(FileSystemState& fileSystemState) const
 		{
-			return _output;
+			return ToFileIds(fileSystemState, _output);
 		}
 
 		virtual void OnCreateProcess(std::string_view applicationName, bool wasDetoured) override final
@@ -76,7 +99,7 @@ namespace Soup::Core
 			}
 			else
 			{
-				auto value = filePath.ToString();
+				auto value = InternPath(filePath);
 
 				#ifdef TRACE_SYSTEM_ACCESS
 				Log::Diag("TouchFileRead {}", value);
@@ -84,11 +107,11 @@ namespace Soup::Core
 
 				if (exists)
 				{
-					_input.insert(std::move(value));
+					_input.insert(value);
 				}
 				else
 				{
-					_inputMissing.insert(std::move(value));
+					_inputMissing.insert(value);
 				}
 			}
 		}
@@ -102,13 +125,13 @@ namespace Soup::Core
 			}
 			else
 			{
-				auto value = filePath.ToString();
+				auto value = InternPath(filePath);
 
 				#ifdef TRACE_SYSTEM_ACCESS
 				Log::Diag("TouchFileWrite {}", value);
 				#endif
 
-				_output.insert(std::move(value));
+				_output.insert(value);
 			}
 		}
 
@@ -121,7 +144,7 @@ namespace Soup::Core
 			}
 			else
 			{
-				auto value = filePath.ToString();
+				auto value = InternPath(filePath);
 
 				#ifdef TRACE_SYSTEM_ACCESS
 				Log::Diag("TouchFileDelete {}", value);
@@ -129,25 +152,61 @@ namespace Soup::Core
 
 				// If this was an output file extract it as it was a transient file
 				// TODO: May want to track if we created the file
-				auto extractOutputResult = _output.extract(value);
-				auto extractInputResult = _input.extract(value);
+				_output.erase(value);
+				_input.erase(value);
 			}
 		}
 
 		virtual void TouchFileDeleteOnClose(Path filePath) override final
 		{
-			auto value = filePath.ToString();
+			auto value = InternPath(filePath);
 
 			#ifdef TRACE_SYSTEM_ACCESS
 			Log::Diag("TouchFileDeleteOnClose {}", value);
 			#endif
 
-			_deleteOnClose.insert(std::move(value));
+			_deleteOnClose.insert(value);
 		}
 
 		virtual void SearchPath(std::string_view path, std::string_view filename) override final
 		{
 			Log::Warning("Search Path encountered: {} - {}", path, filename);
 		}
+
+	private:
+		/// <summary>
+		/// Get the stable view of the absolute path, copying it into the arena the first time it is seen
+		/// </summary>
+		std::string_view InternPath(const Path& filePath)
+		{
+			if (filePath.HasRoot())
+			{
+				return InternPath(filePath.ToString());
+			}
+			else
+			{
+				auto absolutePath = _workingDirectory + filePath;
+				return InternPath(absolutePath.ToString());
+			}
+		}
+
+		std::string_view InternPath(std::string_view value)
+		{
+			auto findResult = _paths.find(value);
+			if (findResult != _paths.end())
+				return *findResult;
+
+			auto result = _pathStorage.Add(value);
+			_paths.insert(result);
+			return result;
+		}
+
+		static std::vector<FileId> ToFileIds(
+			FileSystemState& fileSystemState,
+			const std::unordered_set<std::string_view>& paths)
+		{
+			auto files = std::vector<std::string_view>(paths.begin(), paths.end());
+			return fileSystemState.ToFileIds(files);
+		}
 	};
 }
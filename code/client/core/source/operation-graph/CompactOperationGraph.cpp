@@ -0,0 +1,199 @@
+﻿// <copyright file="CompactOperationGraph.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+export module Soup.Core:CompactOperationGraph;
+
+import Opal;
+import :FileSystemState;
+import :OperationGraph;
+import :OperationInfo;
+
+using namespace Opal;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// A read only operation graph that is cheap to traverse and is loaded directly from the operation graph file.
+	/// The operations are stored contiguously with a table indexed by their id, so a lookup is a single index
+	/// instead of a tree walk. The file and child lists are viewed in place in each operation.
+	/// </summary>
+	export class CompactOperationGraph
+	{
+	private:
+		static constexpr uint32_t NoOperation = std::numeric_limits<uint32_t>::max();
+
+		std::vector<OperationId> _rootOperations;
+		std::vector<OperationInfo> _operations;
+
+		// The position of each operation indexed by its id
+		std::vector<uint32_t> _operationIndices;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="CompactOperationGraph"/> class.
+		/// </summary>
+		CompactOperationGraph() :
+			_rootOperations(),
+			_operations(),
+			_operationIndices()
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="CompactOperationGraph"/> class.
+		/// </summary>
+		CompactOperationGraph(
+			std::vector<OperationId> rootOperations,
+			std::vector<OperationInfo> operations) :
+			_rootOperations(std::move(rootOperations)),
+			_operations(std::move(operations)),
+			_operationIndices()
+		{
+			OperationId operationIdLimit = 0;
+			for (const auto& operationInfo : _operations)
+			{
+				if (operationInfo.Id >= operationIdLimit)
+					operationIdLimit = operationInfo.Id + 1;
+			}
+
+			_operationIndices.resize(operationIdLimit, NoOperation);
+			for (auto index = 0u; index < _operations.size(); index++)
+			{
+				auto& operationIndex = _operationIndices[_operations[index].Id];
+				if (operationIndex != NoOperation)
+					throw std::runtime_error("The provided operation id already exists in the graph");
+
+				operationIndex = index;
+			}
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="CompactOperationGraph"/> class
+		/// with a copy of an operation graph that was built in memory.
+		/// </summary>
+		CompactOperationGraph(const OperationGraph& graph) :
+			CompactOperationGraph(graph.GetRootOperationIds(), CopyOperations(graph))
+		{
+		}
+
+		/// <summary>
+		/// Get the list of root operation ids
+		/// </summary>
+		const std::vector<OperationId>& GetRootOperationIds() const
+		{
+			return _rootOperations;
+		}
+
+		/// <summary>
+		/// Get the operations in the order they were loaded
+		/// </summary>
+		const std::vector<OperationInfo>& GetOperations() const
+		{
+			return _operations;
+		}
+
+		/// <summary>
+		/// Get the number of operations
+		/// </summary>
+		uint32_t GetOperationCount() const
+		{
+			return static_cast<uint32_t>(_operations.size());
+		}
+
+		/// <summary>
+		/// Get the upper bound for the operation ids, all ids are less than this value
+		/// </summary>
+		OperationId GetOperationIdLimit() const
+		{
+			return static_cast<OperationId>(_operationIndices.size());
+		}
+
+		/// <summary>
+		/// Check if the operation exists
+		/// </summary>
+		bool HasOperation(OperationId operationId) const
+		{
+			return operationId < _operationIndices.size() && _operationIndices[operationId] != NoOperation;
+		}
+
+		/// <summary>
+		/// Get an operation info
+		/// </summary>
+		const OperationInfo& GetOperationInfo(OperationId operationId) const
+		{
+			if (!HasOperation(operationId))
+				throw std::runtime_error("The provided operation id does not exist");
+
+			return _operations[_operationIndices[operationId]];
+		}
+
+		/// <summary>
+		/// Get the number of operations that must complete before the operation can run
+		/// </summary>
+		uint32_t GetDependencyCount(OperationId operationId) const
+		{
+			return GetOperationInfo(operationId).DependencyCount;
+		}
+
+		/// <summary>
+		/// Get the operations that depend on the operation
+		/// </summary>
+		std::span<const OperationId> GetChildren(OperationId operationId) const
+		{
+			return GetOperationInfo(operationId).Children;
+		}
+
+		/// <summary>
+		/// Get the declared input files
+		/// </summary>
+		std::span<const FileId> GetDeclaredInput(OperationId operationId) const
+		{
+			return GetOperationInfo(operationId).DeclaredInput;
+		}
+
+		/// <summary>
+		/// Get the declared output files
+		/// </summary>
+		std::span<const FileId> GetDeclaredOutput(OperationId operationId) const
+		{
+			return GetOperationInfo(operationId).DeclaredOutput;
+		}
+
+		/// <summary>
+		/// Get the files and directories the operation is allowed to read
+		/// </summary>
+		std::span<const FileId> GetReadAccess(OperationId operationId) const
+		{
+			return GetOperationInfo(operationId).ReadAccess;
+		}
+
+		/// <summary>
+		/// Get the files and directories the operation is allowed to write
+		/// </summary>
+		std::span<const FileId> GetWriteAccess(OperationId operationId) const
+		{
+			return GetOperationInfo(operationId).WriteAccess;
+		}
+
+	private:
+		static std::vector<OperationInfo> CopyOperations(const OperationGraph& graph)
+		{
+			auto result = std::vector<OperationInfo>();
+			result.reserve(graph.GetOperations().size());
+			for (const auto& [operationId, operationInfo] : graph.GetOperations())
+			{
+				result.push_back(operationInfo);
+			}
+
+			return result;
+		}
+	};
+}
@@ -11,6 +11,7 @@ module;
 export module Soup.Core:OperationGraphManager;
 
 import Opal;
+import :CompactOperationGraph;
 import :FileSystemState;
 import :OperationGraph;
 import :OperationGraphReader;
@@ -60,6 +61,40 @@ namespace Soup::Core
 			}
 		}
 
+		/// <summary>
+		/// Load the operation state straight into the compact form used to evaluate it
+		/// </summary>
+		static bool TryLoadState(
+			const Path& operationGraphFile,
+			CompactOperationGraph& result,
+			FileSystemState& fileSystemState)
+		{
+			// Open the file to read from
+			std::shared_ptr<System::IInputFile> file;
+			if (!System::IFileSystem::Current().TryOpenRead(operationGraphFile, true, file))
+			{
+				Log::Info("Operation graph file does not exist");
+				return false;
+			}
+
+			// Read the contents of the build state file
+			try
+			{
+				result = OperationGraphReader::DeserializeCompact(file->GetInStream(), fileSystemState);
+				return true;
+			}
+			catch(std::runtime_error& ex)
+			{
+				Log::Error(ex.what());
+				return false;
+			}
+			catch(...)
+			{
+				Log::Error("Failed to parse operation graph");
+				return false;
+			}
+		}
+
 		/// <summary>
 		/// Save the operation state for the provided directory
 		/// </summary>
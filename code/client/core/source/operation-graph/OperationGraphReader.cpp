@@ -15,8 +15,10 @@ export module Soup.Core:OperationGraphReader;
 
 import Opal;
 import :CommandInfo;
+import :CompactOperationGraph;
 import :FileSystemState;
 import :OperationGraph;
+import :OperationGraphView;
 import :OperationInfo;
 
 using namespace Opal;
@@ -30,10 +32,46 @@ namespace Soup::Core
 	{
 	private:
 		// Binary Operation Graph file format
-		static constexpr uint32_t FileVersion = 6;
+		static constexpr uint32_t FileVersion = 8;
+
+		// The previous version without the resource pool that can be read in place
+		static constexpr uint32_t NoResourcePoolFileVersion = 7;
+
+		// The previous version that stored each operation inline that can still be read
+		static constexpr uint32_t InlineFileVersion = 6;
 
 	public:
 		static OperationGraph Deserialize(std::istream& stream, FileSystemState& fileSystemState)
+		{
+			auto rootOperationIds = std::vector<OperationId>();
+			auto operations = std::vector<OperationInfo>();
+			Deserialize(stream, fileSystemState, rootOperationIds, operations);
+
+			return OperationGraph(
+				std::move(rootOperationIds),
+				std::move(operations));
+		}
+
+		/// <summary>
+		/// Load the operations straight into the compact form used to evaluate the graph
+		/// </summary>
+		static CompactOperationGraph DeserializeCompact(std::istream& stream, FileSystemState& fileSystemState)
+		{
+			auto rootOperationIds = std::vector<OperationId>();
+			auto operations = std::vector<OperationInfo>();
+			Deserialize(stream, fileSystemState, rootOperationIds, operations);
+
+			return CompactOperationGraph(
+				std::move(rootOperationIds),
+				std::move(operations));
+		}
+
+	private:
+		static void Deserialize(
+			std::istream& stream,
+			FileSystemState& fileSystemState,
+			std::vector<OperationId>& rootOperationIds,
+			std::vector<OperationInfo>& operations)
 		{
 			// Read the entire file for fastest read operation
 			stream.seekg(0, std::ios_base::end);
@@ -45,19 +83,21 @@ namespace Soup::Core
 			auto data = contentBuffer.data();
 			size_t offset = 0;
 			
-			auto result = Deserialize(data, size, offset, fileSystemState);
+			Deserialize(data, size, offset, fileSystemState, rootOperationIds, operations);
 
 			if (offset != contentBuffer.size())
 			{
 				throw std::runtime_error("Value Table file corrupted - Did not read the entire file");
 			}
-
-			return result;
 		}
 
-	private:
-		static OperationGraph Deserialize(
-			char* data, size_t size, size_t& offset, FileSystemState& fileSystemState)
+		static void Deserialize(
+			char* data,
+			size_t size,
+			size_t& offset,
+			FileSystemState& fileSystemState,
+			std::vector<OperationId>& rootOperationIds,
+			std::vector<OperationInfo>& operations)
 		{
 			// BUG: Why does this need to be at the start of the file?
 			auto activeFileIdMap = std::unordered_map<FileId, FileId>();
@@ -74,7 +114,22 @@ namespace Soup::Core
 			}
 
 			auto fileVersion = ReadUInt32(data, size, offset);
-			if (fileVersion != FileVersion)
+			if (fileVersion == FileVersion || fileVersion == NoResourcePoolFileVersion)
+			{
+				// Validate the layout once and copy each operation out of the buffer
+				auto view = OperationGraphView(data, size);
+				offset = view.GetSize();
+
+				rootOperationIds = view.GetRootOperationIds();
+				operations.reserve(view.GetOperationCount());
+				for (auto i = 0u; i < view.GetOperationCount(); i++)
+				{
+					operations.push_back(view.GetOperation(i, fileSystemState));
+				}
+
+				return;
+			}
+			else if (fileVersion != InlineFileVersion)
 			{
 				throw std::runtime_error("Operation graph file version does not match expected");
 			}
@@ -116,7 +171,7 @@ namespace Soup::Core
 			}
 
 			// Read the root operation ids
-			auto rootOperationIds = ReadOperationIdList(data, size, offset);
+			rootOperationIds = ReadOperationIdList(data, size, offset);
 
 			// Read the set of operations
 			Read(data, size, offset, headerBuffer.data(), 4);
@@ -129,15 +184,11 @@ namespace Soup::Core
 			}
 
 			auto operationCount = ReadUInt32(data, size, offset);
-			auto operations = std::vector<OperationInfo>(operationCount);
+			operations.resize(operationCount);
 			for (auto i = 0u; i < operationCount; i++)
 			{
 				operations[i] = ReadOperationInfo(data, size, offset, activeFileIdMap);
 			}
-
-			return OperationGraph(
-				std::move(rootOperationIds),
-				std::move(operations));
 		}
 
 		static OperationInfo ReadOperationInfo(
@@ -0,0 +1,425 @@
+﻿// <copyright file="OperationGraphView.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+export module Soup.Core:OperationGraphView;
+
+import Opal;
+import :CommandInfo;
+import :FileSystemState;
+import :OperationInfo;
+
+using namespace Opal;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// A read only view of a serialized operation graph that reads the values in place.
+	/// The format only uses fixed width values and offsets so the loaded buffer can be read without
+	/// an intermediate parse. The entire layout is validated up front and the reader then copies each
+	/// operation out once, straight into the compact graph used by evaluate.
+	/// </summary>
+	export class OperationGraphView
+	{
+	public:
+		// Binary Operation Graph file format
+		static constexpr uint32_t FileVersion = 8;
+
+		// The previous version without the resource pool that can still be read
+		static constexpr uint32_t NoResourcePoolFileVersion = 7;
+
+	private:
+		// The number of values in a single operation record
+		// Id, Title, WorkingDirectory, Executable, five (offset, count) ranges for the arguments and
+		// file lists, one (offset, count) range for the children, the dependency count,
+		// the resource pool and the resource weight
+		static constexpr uint32_t OperationRecordSize = 19;
+		static constexpr uint32_t NoResourcePoolOperationRecordSize = 17;
+
+		const char* _data;
+		size_t _size;
+		uint32_t _operationRecordSize;
+
+		uint32_t _stringCount;
+		size_t _stringOffsetsOffset;
+		size_t _stringDataOffset;
+		uint32_t _stringDataSize;
+
+		uint32_t _fileCount;
+		size_t _fileIdsOffset;
+		size_t _filePathsOffset;
+
+		uint32_t _rootOperationCount;
+		size_t _rootOperationsOffset;
+
+		uint32_t _operationCount;
+		size_t _operationsOffset;
+
+		uint32_t _valueCount;
+		size_t _valuesOffset;
+
+		size_t _endOffset;
+
+		// The files that have been resolved into the active file system state, zero if not resolved
+		std::vector<FileId> _activeFileIds;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="OperationGraphView"/> class.
+		/// The data must outlive the view.
+		/// </summary>
+		OperationGraphView(const char* data, size_t size) :
+			_data(data),
+			_size(size),
+			_operationRecordSize(OperationRecordSize),
+			_stringCount(0),
+			_stringOffsetsOffset(0),
+			_stringDataOffset(0),
+			_stringDataSize(0),
+			_fileCount(0),
+			_fileIdsOffset(0),
+			_filePathsOffset(0),
+			_rootOperationCount(0),
+			_rootOperationsOffset(0),
+			_operationCount(0),
+			_operationsOffset(0),
+			_valueCount(0),
+			_valuesOffset(0),
+			_endOffset(0),
+			_activeFileIds()
+		{
+			size_t offset = 0;
+
+			// Read the File Header with version
+			ReadHeader(offset, 'B', 'O', 'G', "Invalid operation graph file header");
+			auto fileVersion = ReadUInt32(offset);
+			if (fileVersion == NoResourcePoolFileVersion)
+			{
+				_operationRecordSize = NoResourcePoolOperationRecordSize;
+			}
+			else if (fileVersion != FileVersion)
+			{
+				throw std::runtime_error("Operation graph file version does not match expected");
+			}
+
+			// Read the string table
+			ReadHeader(offset, 'S', 'T', 'R', "Invalid operation graph strings header");
+			_stringCount = ReadUInt32(offset);
+			_stringDataSize = ReadUInt32(offset);
+			_stringOffsetsOffset = SkipValues(offset, _stringCount);
+			_stringDataOffset = offset;
+			Skip(offset, AlignSize(_stringDataSize));
+
+			uint32_t previousStringOffset = 0;
+			for (auto i = 0u; i < _stringCount; i++)
+			{
+				auto stringOffset = GetUInt32(_stringOffsetsOffset, i);
+				if (stringOffset < previousStringOffset || stringOffset > _stringDataSize)
+					throw std::runtime_error("Invalid operation graph string offset");
+				previousStringOffset = stringOffset;
+			}
+
+			// Read the set of files
+			ReadHeader(offset, 'F', 'I', 'S', "Invalid operation graph files header");
+			_fileCount = ReadUInt32(offset);
+			_fileIdsOffset = SkipValues(offset, _fileCount);
+			_filePathsOffset = SkipValues(offset, _fileCount);
+			for (auto i = 0u; i < _fileCount; i++)
+			{
+				// The ids must be sorted to allow them to be searched in place
+				if (i > 0 && GetUInt32(_fileIdsOffset, i - 1) >= GetUInt32(_fileIdsOffset, i))
+					throw std::runtime_error("Operation graph file ids must be unique and sorted");
+				VerifyString(GetUInt32(_filePathsOffset, i));
+			}
+
+			// Read the root operation ids
+			ReadHeader(offset, 'R', 'O', 'P', "Invalid operation graph root operations header");
+			_rootOperationCount = ReadUInt32(offset);
+			_rootOperationsOffset = SkipValues(offset, _rootOperationCount);
+
+			// Read the set of operations
+			ReadHeader(offset, 'O', 'P', 'S', "Invalid operation graph operations header");
+			_operationCount = ReadUInt32(offset);
+			if (_operationCount > (_size / sizeof(uint32_t)) / _operationRecordSize)
+				throw std::runtime_error("Tried to read past end of data");
+			_operationsOffset = SkipValues(offset, _operationCount * _operationRecordSize);
+
+			// Read the shared list values
+			ReadHeader(offset, 'V', 'A', 'L', "Invalid operation graph values header");
+			_valueCount = ReadUInt32(offset);
+			_valuesOffset = SkipValues(offset, _valueCount);
+			_endOffset = offset;
+
+			for (auto i = 0u; i < _operationCount; i++)
+			{
+				VerifyOperation(i);
+			}
+
+			_activeFileIds = std::vector<FileId>(_fileCount, 0);
+		}
+
+		/// <summary>
+		/// Get the number of bytes used by the graph
+		/// </summary>
+		size_t GetSize() const
+		{
+			return _endOffset;
+		}
+
+		/// <summary>
+		/// Get the root operation ids
+		/// </summary>
+		std::vector<OperationId> GetRootOperationIds() const
+		{
+			auto result = std::vector<OperationId>(_rootOperationCount);
+			for (auto i = 0u; i < _rootOperationCount; i++)
+			{
+				result[i] = GetUInt32(_rootOperationsOffset, i);
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Get the number of operations
+		/// </summary>
+		uint32_t GetOperationCount() const
+		{
+			return _operationCount;
+		}
+
+		/// <summary>
+		/// Get the id for the operation at the provided index
+		/// </summary>
+		OperationId GetOperationId(uint32_t index) const
+		{
+			return GetOperationValue(index, 0);
+		}
+
+		/// <summary>
+		/// Get the title for the operation at the provided index without copying
+		/// </summary>
+		std::string_view GetOperationTitle(uint32_t index) const
+		{
+			return GetString(GetOperationValue(index, 1));
+		}
+
+		/// <summary>
+		/// Get the number of files in the file table
+		/// </summary>
+		uint32_t GetFileCount() const
+		{
+			return _fileCount;
+		}
+
+		/// <summary>
+		/// Get a string from the string table without copying
+		/// </summary>
+		std::string_view GetString(uint32_t index) const
+		{
+			auto start = GetUInt32(_stringOffsetsOffset, index);
+			auto end = index + 1 < _stringCount ? GetUInt32(_stringOffsetsOffset, index + 1) : _stringDataSize;
+			return std::string_view(_data + _stringDataOffset + start, end - start);
+		}
+
+		/// <summary>
+		/// Materialize the operation at the provided index with the file ids resolved into the active file system state
+		/// </summary>
+		OperationInfo GetOperation(uint32_t index, FileSystemState& fileSystemState)
+		{
+			auto arguments = std::vector<std::string>();
+			auto argumentsOffset = GetOperationValue(index, 4);
+			auto argumentsCount = GetOperationValue(index, 5);
+			arguments.reserve(argumentsCount);
+			for (auto i = 0u; i < argumentsCount; i++)
+			{
+				arguments.push_back(std::string(GetString(GetUInt32(_valuesOffset, argumentsOffset + i))));
+			}
+
+			// Operations from before resource pools were recorded are only limited by the maximum jobs
+			auto resourcePool = std::string();
+			uint32_t resourceWeight = 1;
+			if (_operationRecordSize == OperationRecordSize)
+			{
+				resourcePool = std::string(GetString(GetOperationValue(index, 17)));
+				resourceWeight = GetOperationValue(index, 18);
+			}
+
+			return OperationInfo(
+				GetOperationId(index),
+				std::string(GetOperationTitle(index)),
+				CommandInfo(
+					Path(std::string(GetString(GetOperationValue(index, 2)))),
+					Path(std::string(GetString(GetOperationValue(index, 3)))),
+					std::move(arguments)),
+				GetFileIdList(index, 6, fileSystemState),
+				GetFileIdList(index, 8, fileSystemState),
+				GetFileIdList(index, 10, fileSystemState),
+				GetFileIdList(index, 12, fileSystemState),
+				GetValueList(index, 14),
+				GetOperationValue(index, 16),
+				std::move(resourcePool),
+				resourceWeight);
+		}
+
+	private:
+		std::vector<FileId> GetFileIdList(uint32_t index, uint32_t rangeIndex, FileSystemState& fileSystemState)
+		{
+			auto offset = GetOperationValue(index, rangeIndex);
+			auto count = GetOperationValue(index, rangeIndex + 1);
+			auto result = std::vector<FileId>(count);
+			for (auto i = 0u; i < count; i++)
+			{
+				result[i] = ResolveFileId(GetUInt32(_valuesOffset, offset + i), fileSystemState);
+			}
+
+			return result;
+		}
+
+		std::vector<uint32_t> GetValueList(uint32_t index, uint32_t rangeIndex) const
+		{
+			auto offset = GetOperationValue(index, rangeIndex);
+			auto count = GetOperationValue(index, rangeIndex + 1);
+			auto result = std::vector<uint32_t>(count);
+			for (auto i = 0u; i < count; i++)
+			{
+				result[i] = GetUInt32(_valuesOffset, offset + i);
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Map the file id from the graph to the active file system state id, files are only
+		/// added to the file system state the first time they are referenced
+		/// </summary>
+		FileId ResolveFileId(FileId fileId, FileSystemState& fileSystemState)
+		{
+			// Binary search the sorted file ids in place
+			uint32_t low = 0;
+			uint32_t high = _fileCount;
+			while (low < high)
+			{
+				auto middle = low + ((high - low) / 2);
+				if (GetUInt32(_fileIdsOffset, middle) < fileId)
+					low = middle + 1;
+				else
+					high = middle;
+			}
+
+			if (low == _fileCount || GetUInt32(_fileIdsOffset, low) != fileId)
+				throw std::runtime_error("Could not find file id in active map");
+
+			auto& activeFileId = _activeFileIds[low];
+			if (activeFileId == 0)
+			{
+				auto file = Path(std::string(GetString(GetUInt32(_filePathsOffset, low))));
+				activeFileId = fileSystemState.ToFileId(file);
+			}
+
+			return activeFileId;
+		}
+
+		void VerifyOperation(uint32_t index) const
+		{
+			VerifyString(GetOperationValue(index, 1));
+			VerifyString(GetOperationValue(index, 2));
+			VerifyString(GetOperationValue(index, 3));
+			if (_operationRecordSize == OperationRecordSize)
+				VerifyString(GetOperationValue(index, 17));
+
+			for (auto rangeIndex = 4u; rangeIndex < 16; rangeIndex += 2)
+			{
+				auto offset = GetOperationValue(index, rangeIndex);
+				auto count = GetOperationValue(index, rangeIndex + 1);
+				if (offset > _valueCount || count > _valueCount - offset)
+					throw std::runtime_error("Invalid operation graph value range");
+			}
+
+			// Verify the arguments reference valid strings
+			auto argumentsOffset = GetOperationValue(index, 4);
+			auto argumentsCount = GetOperationValue(index, 5);
+			for (auto i = 0u; i < argumentsCount; i++)
+			{
+				VerifyString(GetUInt32(_valuesOffset, argumentsOffset + i));
+			}
+		}
+
+		void VerifyString(uint32_t index) const
+		{
+			if (index >= _stringCount)
+				throw std::runtime_error("Invalid operation graph string index");
+		}
+
+		uint32_t GetOperationValue(uint32_t index, uint32_t valueIndex) const
+		{
+			return GetUInt32(_operationsOffset, (static_cast<size_t>(index) * _operationRecordSize) + valueIndex);
+		}
+
+		uint32_t GetUInt32(size_t sectionOffset, size_t index) const
+		{
+			uint32_t result;
+			std::memcpy(&result, _data + sectionOffset + (index * sizeof(uint32_t)), sizeof(uint32_t));
+			return result;
+		}
+
+		void ReadHeader(size_t& offset, char header0, char header1, char header2, const char* message) const
+		{
+			Verify(offset, 4);
+			if (_data[offset] != header0 ||
+				_data[offset + 1] != header1 ||
+				_data[offset + 2] != header2 ||
+				_data[offset + 3] != '\0')
+			{
+				throw std::runtime_error(message);
+			}
+
+			offset += 4;
+		}
+
+		uint32_t ReadUInt32(size_t& offset) const
+		{
+			Verify(offset, sizeof(uint32_t));
+			auto result = GetUInt32(offset, 0);
+			offset += sizeof(uint32_t);
+			return result;
+		}
+
+		size_t SkipValues(size_t& offset, size_t count) const
+		{
+			if (count > _size / sizeof(uint32_t))
+				throw std::runtime_error("Tried to read past end of data");
+
+			auto start = offset;
+			Skip(offset, count * sizeof(uint32_t));
+			return start;
+		}
+
+		void Skip(size_t& offset, size_t count) const
+		{
+			Verify(offset, count);
+			offset += count;
+		}
+
+		void Verify(size_t offset, size_t count) const
+		{
+			if (offset + count > _size)
+				throw std::runtime_error("Tried to read past end of data");
+		}
+
+		static size_t AlignSize(size_t size)
+		{
+			return (size + (sizeof(uint32_t) - 1)) & ~(sizeof(uint32_t) - 1);
+		}
+	};
+}
@@ -8,6 +8,9 @@ module;
 #include <cstring>
 #include <iostream>
 #include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 export module Soup.Core:OperationGraphWriter;
@@ -28,7 +31,35 @@ namespace Soup::Core
 	{
 	private:
 		// Binary Operation graph file format
-		static constexpr uint32_t FileVersion = 6;
+		static constexpr uint32_t FileVersion = 8;
+
+		// The number of values in a single operation record
+		static constexpr uint32_t OperationRecordSize = 19;
+
+		/// <summary>
+		/// The deduplicated set of strings referenced by the graph
+		/// </summary>
+		class StringTable
+		{
+		private:
+			std::unordered_map<std::string, uint32_t> _lookup;
+			std::vector<std::string_view> _values;
+
+		public:
+			uint32_t Add(const std::string& value)
+			{
+				auto [iterator, wasInserted] = _lookup.emplace(value, static_cast<uint32_t>(_values.size()));
+				if (wasInserted)
+					_values.push_back(iterator->first);
+
+				return iterator->second;
+			}
+
+			const std::vector<std::string_view>& GetValues() const
+			{
+				return _values;
+			}
+		};
 
 	public:
 		static void Serialize(
@@ -37,69 +68,103 @@ namespace Soup::Core
 			const FileSystemState& fileSystemState,
 			std::ostream& stream)
 		{
+			auto strings = StringTable();
+
+			// Build the file table, the ids are kept in sorted order to allow in place lookups
+			auto filePaths = std::vector<uint32_t>();
+			filePaths.reserve(files.size());
+			for (auto fileId : files)
+			{
+				filePaths.push_back(strings.Add(fileSystemState.GetFilePath(fileId).ToString()));
+			}
+
+			// Build the fixed size operation records with all lists flattened into a single set of values
+			auto& operations = state.GetOperations();
+			auto operationRecords = std::vector<uint32_t>();
+			operationRecords.reserve(operations.size() * OperationRecordSize);
+			auto values = std::vector<uint32_t>();
+			for (auto& [operationId, operation] : operations)
+			{
+				operationRecords.push_back(operation.Id);
+				operationRecords.push_back(strings.Add(operation.Title));
+				operationRecords.push_back(strings.Add(operation.Command.WorkingDirectory.ToString()));
+				operationRecords.push_back(strings.Add(operation.Command.Executable.ToString()));
+
+				// Write the command arguments
+				operationRecords.push_back(static_cast<uint32_t>(values.size()));
+				operationRecords.push_back(static_cast<uint32_t>(operation.Command.Arguments.size()));
+				for (auto& argument : operation.Command.Arguments)
+					values.push_back(strings.Add(argument));
+
+				AppendValues(operationRecords, values, operation.DeclaredInput);
+				AppendValues(operationRecords, values, operation.DeclaredOutput);
+				AppendValues(operationRecords, values, operation.ReadAccess);
+				AppendValues(operationRecords, values, operation.WriteAccess);
+				AppendValues(operationRecords, values, operation.Children);
+
+				operationRecords.push_back(operation.DependencyCount);
+				operationRecords.push_back(strings.Add(operation.ResourcePool));
+				operationRecords.push_back(operation.ResourceWeight);
+			}
+
 			// Write the File Header with version
 			stream.write("BOG\0", 4);
 			WriteValue(stream, FileVersion);
 
+			// Write out the string table as the start offsets followed by the packed characters
+			auto& stringValues = strings.GetValues();
+			stream.write("STR\0", 4);
+			WriteValue(stream, static_cast<uint32_t>(stringValues.size()));
+			uint32_t stringDataSize = 0;
+			for (auto value : stringValues)
+				stringDataSize += static_cast<uint32_t>(value.size());
+			WriteValue(stream, stringDataSize);
+			uint32_t stringOffset = 0;
+			for (auto value : stringValues)
+			{
+				WriteValue(stream, stringOffset);
+				stringOffset += static_cast<uint32_t>(value.size());
+			}
+			for (auto value : stringValues)
+				stream.write(value.data(), value.size());
+
+			// Pad the characters to keep the following values aligned
+			auto padding = (sizeof(uint32_t) - (stringDataSize % sizeof(uint32_t))) % sizeof(uint32_t);
+			stream.write("\0\0\0", padding);
+
 			// Write out the set of files
 			stream.write("FIS\0", 4);
 			WriteValue(stream, static_cast<uint32_t>(files.size()));
 			for (auto fileId : files)
-			{
-				// Write the file id + path length + path
 				WriteValue(stream, fileId);
-				WriteValue(stream, fileSystemState.GetFilePath(fileId).ToString());
-			}
+			for (auto filePath : filePaths)
+				WriteValue(stream, filePath);
 
 			// Write out the root operation ids
 			stream.write("ROP\0", 4);
 			WriteValues(stream, state.GetRootOperationIds());
 
 			// Write out the set of operations
-			auto& operations = state.GetOperations();
 			stream.write("OPS\0", 4);
 			WriteValue(stream, static_cast<uint32_t>(operations.size()));
-			for (auto& operationValue : state.GetOperations())
-			{
-				WriteOperationInfo(stream, operationValue.second);
-			}
+			for (auto value : operationRecords)
+				WriteValue(stream, value);
+
+			// Write out the shared list values
+			stream.write("VAL\0", 4);
+			WriteValues(stream, values);
 		}
 
 	private:
-		static void WriteOperationInfo(std::ostream& stream, const OperationInfo& operation)
+		static void AppendValues(
+			std::vector<uint32_t>& operationRecords,
+			std::vector<uint32_t>& values,
+			const std::vector<uint32_t>& list)
 		{
-			// Write out the operation id
-			WriteValue(stream, operation.Id);
-
-			// Write out the operation title
-			WriteValue(stream, operation.Title);
-
-			// Write the command working directory
-			WriteValue(stream, operation.Command.WorkingDirectory.ToString());
-
-			// Write the command executable
-			WriteValue(stream, operation.Command.Executable.ToString());
-
-			// Write the command arguments
-			WriteValues(stream, operation.Command.Arguments);
-
-			// Write out the declared input files
-			WriteValues(stream, operation.DeclaredInput);
-
-			// Write out the declared output files
-			WriteValues(stream, operation.DeclaredOutput);
-
-			// Write out the read access list
-			WriteValues(stream, operation.ReadAccess);
-
-			// Write out the write access list
-			WriteValues(stream, operation.WriteAccess);
-
-			// Write out the child operation ids
-			WriteValues(stream, operation.Children);
-
-			// Write out the dependency count
-			WriteValue(stream, operation.DependencyCount);
+			// Write the offset and count for the list
+			operationRecords.push_back(static_cast<uint32_t>(values.size()));
+			operationRecords.push_back(static_cast<uint32_t>(list.size()));
+			values.insert(values.end(), list.begin(), list.end());
 		}
 
 		static void WriteValue(std::ostream& stream, uint32_t value)
@@ -107,32 +172,6 @@ namespace Soup::Core
 			stream.write(reinterpret_cast<char*>(&value), sizeof(uint32_t));
 		}
 
-		static void WriteValue(std::ostream& stream, int64_t value)
-		{
-			stream.write(reinterpret_cast<char*>(&value), sizeof(int64_t));
-		}
-
-		static void WriteValue(std::ostream& stream, bool value)
-		{
-			uint32_t integerValue = value ? 1u : 0u;
-			stream.write(reinterpret_cast<char*>(&integerValue), sizeof(uint32_t));
-		}
-
-		static void WriteValue(std::ostream& stream, std::string_view value)
-		{
-			WriteValue(stream, static_cast<uint32_t>(value.size()));
-			stream.write(value.data(), value.size());
-		}
-
-		static void WriteValues(std::ostream& stream, const std::vector<std::string>& values)
-		{
-			WriteValue(stream, static_cast<uint32_t>(values.size()));
-			for (auto& value : values)
-			{
-				WriteValue(stream, value);
-			}
-		}
-
 		static void WriteValues(std::ostream& stream, const std::vector<uint32_t>& values)
 		{
 			WriteValue(stream, static_cast<uint32_t>(values.size()));
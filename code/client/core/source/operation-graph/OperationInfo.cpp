@@ -36,6 +36,12 @@ export namespace Soup::Core
 		std::vector<OperationId> Children;
 		uint32_t DependencyCount;
 
+		// The shared resource pool the operation runs in, empty if it is only limited by the maximum jobs
+		std::string ResourcePool;
+
+		// The share of the resource pool that is used while the operation runs
+		uint32_t ResourceWeight;
+
 	public:
 		OperationInfo() :
 			Id(0),
@@ -46,7 +52,9 @@ export namespace Soup::Core
 			ReadAccess(),
 			WriteAccess(),
 			Children(),
-			DependencyCount(0)
+			DependencyCount(0),
+			ResourcePool(),
+			ResourceWeight(1)
 		{
 		}
 
@@ -66,7 +74,9 @@ export namespace Soup::Core
 			ReadAccess(std::move(readAccess)),
 			WriteAccess(std::move(writeAccess)),
 			Children(),
-			DependencyCount(0)
+			DependencyCount(0),
+			ResourcePool(),
+			ResourceWeight(1)
 		{
 		}
 
@@ -88,7 +98,35 @@ export namespace Soup::Core
 			ReadAccess(std::move(readAccess)),
 			WriteAccess(std::move(writeAccess)),
 			Children(std::move(children)),
-			DependencyCount(dependencyCount)
+			DependencyCount(dependencyCount),
+			ResourcePool(),
+			ResourceWeight(1)
+		{
+		}
+
+		OperationInfo(
+			OperationId id,
+			std::string title,
+			CommandInfo command,
+			std::vector<FileId> declaredInput,
+			std::vector<FileId> declaredOutput,
+			std::vector<FileId> readAccess,
+			std::vector<FileId> writeAccess,
+			std::vector<OperationId> children,
+			uint32_t dependencyCount,
+			std::string resourcePool,
+			uint32_t resourceWeight) :
+			Id(id),
+			Title(std::move(title)),
+			Command(std::move(command)),
+			DeclaredInput(std::move(declaredInput)),
+			DeclaredOutput(std::move(declaredOutput)),
+			ReadAccess(std::move(readAccess)),
+			WriteAccess(std::move(writeAccess)),
+			Children(std::move(children)),
+			DependencyCount(dependencyCount),
+			ResourcePool(std::move(resourcePool)),
+			ResourceWeight(resourceWeight)
 		{
 		}
 
@@ -102,7 +140,9 @@ export namespace Soup::Core
 				ReadAccess == rhs.ReadAccess &&
 				WriteAccess == rhs.WriteAccess &&
 				Children == rhs.Children &&
-				DependencyCount == rhs.DependencyCount;
+				DependencyCount == rhs.DependencyCount &&
+				ResourcePool == rhs.ResourcePool &&
+				ResourceWeight == rhs.ResourceWeight;
 		}
 	};
 }
\ No newline at end of file
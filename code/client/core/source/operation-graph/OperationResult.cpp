@@ -28,12 +28,24 @@ namespace Soup::Core
 		std::vector<FileId> ObservedInput;
 		std::vector<FileId> ObservedOutput;
 
+		// The content hash of each observed input at the time of the run
+		// Empty when the content hashes were not tracked
+		std::vector<uint64_t> ObservedInputHashes;
+
+		// The wall time and peak resident memory in bytes of the last run
+		// Used to prioritize the longest chains of operations, zero when unknown
+		std::chrono::microseconds EvaluateDuration;
+		uint64_t PeakMemoryUsage;
+
 	public:
 		OperationResult() :
 			WasSuccessfulRun(false),
 			EvaluateTime(std::chrono::time_point<std::chrono::file_clock>::min()),
 			ObservedInput(),
-			ObservedOutput()
+			ObservedOutput(),
+			ObservedInputHashes(),
+			EvaluateDuration(0),
+			PeakMemoryUsage(0)
 		{
 		}
 
@@ -42,19 +54,60 @@ namespace Soup::Core
 			std::chrono::time_point<std::chrono::file_clock> evaluateTime,
 			std::vector<FileId> observedInput,
 			std::vector<FileId> observedOutput) :
+			OperationResult(
+				wasSuccessfulRun,
+				evaluateTime,
+				std::move(observedInput),
+				std::move(observedOutput),
+				{})
+		{
+		}
+
+		OperationResult(
+			bool wasSuccessfulRun,
+			std::chrono::time_point<std::chrono::file_clock> evaluateTime,
+			std::vector<FileId> observedInput,
+			std::vector<FileId> observedOutput,
+			std::vector<uint64_t> observedInputHashes) :
+			OperationResult(
+				wasSuccessfulRun,
+				evaluateTime,
+				std::move(observedInput),
+				std::move(observedOutput),
+				std::move(observedInputHashes),
+				std::chrono::microseconds(0),
+				0)
+		{
+		}
+
+		OperationResult(
+			bool wasSuccessfulRun,
+			std::chrono::time_point<std::chrono::file_clock> evaluateTime,
+			std::vector<FileId> observedInput,
+			std::vector<FileId> observedOutput,
+			std::vector<uint64_t> observedInputHashes,
+			std::chrono::microseconds evaluateDuration,
+			uint64_t peakMemoryUsage) :
 			WasSuccessfulRun(wasSuccessfulRun),
 			EvaluateTime(evaluateTime),
 			ObservedInput(std::move(observedInput)),
-			ObservedOutput(std::move(observedOutput))
+			ObservedOutput(std::move(observedOutput)),
+			ObservedInputHashes(std::move(observedInputHashes)),
+			EvaluateDuration(evaluateDuration),
+			PeakMemoryUsage(peakMemoryUsage)
 		{
 		}
 
+		/// <summary>
+		/// Compare the incremental build state, the run statistics vary between identical runs and are ignored
+		/// </summary>
 		bool operator ==(const OperationResult& rhs) const
 		{
 			return WasSuccessfulRun == rhs.WasSuccessfulRun &&
 				EvaluateTime == rhs.EvaluateTime &&
 				ObservedInput == rhs.ObservedInput &&
-				ObservedOutput == rhs.ObservedOutput;
+				ObservedOutput == rhs.ObservedOutput &&
+				ObservedInputHashes == rhs.ObservedInputHashes;
 		}
 	};
 }
\ No newline at end of file
@@ -0,0 +1,186 @@
+﻿// <copyright file="OperationResultsJournal.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <chrono>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+export module Soup.Core:OperationResultsJournal;
+
+import Opal;
+import :FileSystemState;
+import :OperationInfo;
+import :OperationResult;
+import :OperationResults;
+import :OperationResultsJournalWriter;
+import :OperationResultsManager;
+
+using namespace Opal;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The append only journal of operation results that keeps the progress of an evaluation that is interrupted.
+	/// Each completed operation is appended as a single record on top of the last saved results and
+	/// the full results are only rewritten when the journal grows too large to be worth replaying.
+	/// </summary>
+	export class OperationResultsJournal
+	{
+	private:
+		// Flush the pending records after this many have been appended or this much time has passed
+		static constexpr uint32_t SyncBatchSize = 32;
+		static constexpr std::chrono::milliseconds SyncInterval = std::chrono::milliseconds(1000);
+
+		Path _resultsFile;
+		Path _journalFile;
+		const FileSystemState& _fileSystemState;
+
+		std::shared_ptr<System::IOutputFile> _file;
+		uint32_t _pendingCount;
+		std::chrono::steady_clock::time_point _lastSyncTime;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="OperationResultsJournal"/> class.
+		/// </summary>
+		OperationResultsJournal(
+			Path resultsFile,
+			Path journalFile,
+			const FileSystemState& fileSystemState) :
+			_resultsFile(std::move(resultsFile)),
+			_journalFile(std::move(journalFile)),
+			_fileSystemState(fileSystemState),
+			_file(nullptr),
+			_pendingCount(0),
+			_lastSyncTime()
+		{
+		}
+
+		OperationResultsJournal(const OperationResultsJournal&) = delete;
+		OperationResultsJournal& operator=(const OperationResultsJournal&) = delete;
+
+		/// <summary>
+		/// Close the journal when the scope ends so the records of an evaluation that fails part way are flushed
+		/// </summary>
+		~OperationResultsJournal()
+		{
+			try
+			{
+				Close();
+			}
+			catch (std::exception& ex)
+			{
+				// Do not replace an active exception, the next build replays the records that were written
+				Log::Warning("Failed to close operation results journal: {}", ex.what());
+			}
+		}
+
+		/// <summary>
+		/// Start a new journal session for the loaded results.
+		/// The records that were replayed from the previous journal are carried forward, unless the results must be
+		/// compacted because the operation ids have been remapped or the journal is as large as the full results.
+		/// </summary>
+		void Open(
+			const OperationResults& results,
+			const std::vector<OperationId>& journaledOperations,
+			bool forceCompact)
+		{
+			// Only the latest record for each operation is kept
+			auto retainedOperations = std::set<OperationId>(journaledOperations.begin(), journaledOperations.end());
+			if (forceCompact || RequiresCompaction(retainedOperations.size(), results.GetResults().size()))
+			{
+				Compact(results);
+				return;
+			}
+
+			StartJournal();
+			auto& currentResults = results.GetResults();
+			for (auto operationId : retainedOperations)
+			{
+				auto findResult = currentResults.find(operationId);
+				if (findResult != currentResults.end())
+				{
+					OperationResultsJournalWriter::WriteRecord(
+						_file->GetOutStream(), operationId, findResult->second, _fileSystemState);
+				}
+			}
+
+			Sync();
+		}
+
+		/// <summary>
+		/// Append the result for a single completed operation
+		/// </summary>
+		void Append(OperationId operationId, const OperationResult& result)
+		{
+			if (_file == nullptr)
+				throw std::runtime_error("Operation results journal has not been opened");
+
+			OperationResultsJournalWriter::WriteRecord(_file->GetOutStream(), operationId, result, _fileSystemState);
+			_pendingCount++;
+
+			// Batch the flushes to keep the cost of a large number of small operations low
+			if (_pendingCount >= SyncBatchSize ||
+				std::chrono::steady_clock::now() - _lastSyncTime >= SyncInterval)
+			{
+				Sync();
+			}
+		}
+
+		/// <summary>
+		/// Flush all pending records to the file system
+		/// </summary>
+		void Sync()
+		{
+			if (_file == nullptr)
+				return;
+
+			_file->GetOutStream().flush();
+			_pendingCount = 0;
+			_lastSyncTime = std::chrono::steady_clock::now();
+		}
+
+		/// <summary>
+		/// Flush all pending records and end the journal session
+		/// </summary>
+		void Close()
+		{
+			Sync();
+			_file = nullptr;
+		}
+
+	private:
+		/// <summary>
+		/// Save the full results and restart the journal
+		/// </summary>
+		void Compact(const OperationResults& results)
+		{
+			// Reset the journal before the full results are written so a record from a previous
+			// session can never be replayed on top of results it does not belong to
+			StartJournal();
+			Sync();
+
+			OperationResultsManager::SaveState(_resultsFile, results, _fileSystemState);
+		}
+
+		void StartJournal()
+		{
+			_file = System::IFileSystem::Current().OpenWrite(_journalFile, true);
+			OperationResultsJournalWriter::WriteHeader(_file->GetOutStream());
+			_pendingCount = 0;
+		}
+
+		/// <summary>
+		/// Compact once replaying the journal costs as much as loading the full results
+		/// </summary>
+		static bool RequiresCompaction(size_t journaledCount, size_t resultCount)
+		{
+			return journaledCount * 2 > resultCount;
+		}
+	};
+}
@@ -0,0 +1,248 @@
+﻿// <copyright file="OperationResultsJournalReader.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+export module Soup.Core:OperationResultsJournalReader;
+
+import Opal;
+import :ContentHash;
+import :FileSystemState;
+import :OperationInfo;
+import :OperationResult;
+import :OperationResults;
+
+using namespace Opal;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The operation results journal reader that replays the appended results on top of the last saved state
+	/// </summary>
+	export class OperationResultsJournalReader
+	{
+	private:
+		// Binary Results Journal file format
+		static constexpr uint32_t FileVersion = 2;
+
+		// The previous version without the run statistics that can still be replayed
+		static constexpr uint32_t NoRunStatisticsFileVersion = 1;
+
+		// The time duration that represents how we store the values in the file using 64 bit integer with resolution of 100 nanoseconds
+		// Note: Unix Time, time since 00:00:00 Coordinated Universal Time (UTC), Thursday, 1 January 1970, not counting leap seconds
+		using ContentTimePeriod = std::ratio<1, 10'000'000>;
+		using ContentDuration = std::chrono::duration<long long, ContentTimePeriod>;
+
+	public:
+		/// <summary>
+		/// Replay each complete record into the results and return the operations that were updated in order
+		/// </summary>
+		static std::vector<OperationId> Deserialize(
+			std::istream& stream,
+			OperationResults& results,
+			FileSystemState& fileSystemState)
+		{
+			// Read the entire file for fastest read operation
+			stream.seekg(0, std::ios_base::end);
+			auto size = stream.tellg();
+			stream.seekg(0, std::ios_base::beg);
+
+			auto contentBuffer = std::vector<char>(size);
+			stream.read(contentBuffer.data(), size);
+			auto data = contentBuffer.data();
+			size_t offset = 0;
+
+			return Deserialize(data, size, offset, results, fileSystemState);
+		}
+
+	private:
+		static std::vector<OperationId> Deserialize(
+			char* data,
+			size_t size,
+			size_t& offset,
+			OperationResults& results,
+			FileSystemState& fileSystemState)
+		{
+			// Read the File Header with version
+			auto headerBuffer = std::array<char, 4>();
+			Read(data, size, offset, headerBuffer.data(), 4);
+			if (headerBuffer[0] != 'B' ||
+				headerBuffer[1] != 'R' ||
+				headerBuffer[2] != 'J' ||
+				headerBuffer[3] != '\0')
+			{
+				throw std::runtime_error("Invalid operation results journal file header");
+			}
+
+			auto fileVersion = ReadUInt32(data, size, offset);
+			if (fileVersion != FileVersion && fileVersion != NoRunStatisticsFileVersion)
+			{
+				throw std::runtime_error("Operation results journal file version does not match expected");
+			}
+
+			// The build may have been killed while appending,
+			// stop at the last complete record and ignore a partial write
+			auto operations = std::vector<OperationId>();
+			while (true)
+			{
+				uint32_t payloadSize = 0;
+				uint64_t checksum = 0;
+				if (!TryRead(data, size, offset, 0, reinterpret_cast<char*>(&payloadSize), sizeof(uint32_t)) ||
+					!TryRead(data, size, offset, sizeof(uint32_t) + payloadSize, reinterpret_cast<char*>(&checksum), sizeof(uint64_t)))
+				{
+					break;
+				}
+
+				auto payload = std::string_view(data + offset + sizeof(uint32_t), payloadSize);
+				if (ContentHash::Hash(payload) != checksum)
+				{
+					break;
+				}
+
+				size_t payloadOffset = offset + sizeof(uint32_t);
+				size_t payloadEnd = payloadOffset + payloadSize;
+				auto operationId = ReadOperationResult(data, payloadEnd, payloadOffset, fileVersion, results, fileSystemState);
+				if (payloadOffset != payloadEnd)
+				{
+					throw std::runtime_error("Operation results journal record corrupted - Did not read the entire record");
+				}
+
+				offset = payloadEnd + sizeof(uint64_t);
+				operations.push_back(operationId);
+			}
+
+			return operations;
+		}
+
+		static OperationId ReadOperationResult(
+			char* data,
+			size_t size,
+			size_t& offset,
+			uint32_t fileVersion,
+			OperationResults& results,
+			FileSystemState& fileSystemState)
+		{
+			// Read the operation id
+			auto operationId = ReadUInt32(data, size, offset);
+
+			// Read the value indicating if there was a successful run
+			auto wasSuccessfulRun = ReadUInt32(data, size, offset) != 0;
+
+			// Read the tick offset of the system clock since its epoch
+			auto evaluateTimeTicks = ReadInt64(data, size, offset);
+			auto evaluateTimeDuration = ContentDuration(evaluateTimeTicks);
+
+			// Use system clock with a known epoch
+			auto evaluateTimeSystem = std::chrono::time_point<std::chrono::system_clock>(evaluateTimeDuration);
+			#ifdef _WIN32
+			auto evaluateTimeFile = std::chrono::clock_cast<std::chrono::file_clock>(evaluateTimeSystem);
+			#else
+			auto evaluateTimeFile = std::chrono::file_clock::from_sys(evaluateTimeSystem);
+			#endif
+
+			// Read the run statistics
+			auto evaluateDuration = std::chrono::microseconds(0);
+			uint64_t peakMemoryUsage = 0;
+			if (fileVersion != NoRunStatisticsFileVersion)
+			{
+				evaluateDuration = std::chrono::microseconds(ReadInt64(data, size, offset));
+				peakMemoryUsage = ReadUInt64(data, size, offset);
+			}
+
+			// Read the observed input files
+			auto observedInput = ReadFiles(data, size, offset, fileSystemState);
+
+			// Read the observed input content hashes
+			auto hashCount = ReadUInt32(data, size, offset);
+			auto observedInputHashes = std::vector<uint64_t>(hashCount);
+			for (auto i = 0u; i < hashCount; i++)
+			{
+				observedInputHashes[i] = ReadUInt64(data, size, offset);
+			}
+
+			// Read the observed output files
+			auto observedOutput = ReadFiles(data, size, offset, fileSystemState);
+
+			results.AddOrUpdateOperationResult(
+				operationId,
+				OperationResult(
+					wasSuccessfulRun,
+					evaluateTimeFile,
+					std::move(observedInput),
+					std::move(observedOutput),
+					std::move(observedInputHashes),
+					evaluateDuration,
+					peakMemoryUsage));
+
+			return operationId;
+		}
+
+		static std::vector<FileId> ReadFiles(
+			char* data,
+			size_t size,
+			size_t& offset,
+			FileSystemState& fileSystemState)
+		{
+			auto fileCount = ReadUInt32(data, size, offset);
+			auto result = std::vector<FileId>(fileCount);
+			for (auto i = 0u; i < fileCount; i++)
+			{
+				auto fileLength = ReadUInt32(data, size, offset);
+				auto file = std::string(fileLength, '\0');
+				Read(data, size, offset, file.data(), fileLength);
+
+				result[i] = fileSystemState.ToFileId(Path(std::move(file)));
+			}
+
+			return result;
+		}
+
+		static uint32_t ReadUInt32(char* data, size_t size, size_t& offset)
+		{
+			uint32_t result = 0;
+			Read(data, size, offset, reinterpret_cast<char*>(&result), sizeof(uint32_t));
+
+			return result;
+		}
+
+		static int64_t ReadInt64(char* data, size_t size, size_t& offset)
+		{
+			int64_t result = 0;
+			Read(data, size, offset, reinterpret_cast<char*>(&result), sizeof(int64_t));
+
+			return result;
+		}
+
+		static uint64_t ReadUInt64(char* data, size_t size, size_t& offset)
+		{
+			uint64_t result = 0;
+			Read(data, size, offset, reinterpret_cast<char*>(&result), sizeof(uint64_t));
+
+			return result;
+		}
+
+		static bool TryRead(char* data, size_t size, size_t offset, size_t skip, char* buffer, size_t count)
+		{
+			if (offset + skip + count > size)
+				return false;
+			memcpy(buffer, data + offset + skip, count);
+			return true;
+		}
+
+		static void Read(char* data, size_t size, size_t& offset, char* buffer, size_t count)
+		{
+			if (offset + count > size)
+				throw std::runtime_error("Tried to read past end of data");
+			memcpy(buffer, data + offset, count);
+			offset += count;
+		}
+	};
+}
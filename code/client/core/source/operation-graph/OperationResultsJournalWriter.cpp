@@ -0,0 +1,149 @@
+﻿// <copyright file="OperationResultsJournalWriter.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <vector>
+
+export module Soup.Core:OperationResultsJournalWriter;
+
+import Opal;
+import :ContentHash;
+import :FileSystemState;
+import :OperationInfo;
+import :OperationResult;
+
+using namespace Opal;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The operation results journal writer used to append each result as soon as the operation completes
+	/// </summary>
+	export class OperationResultsJournalWriter
+	{
+	private:
+		// Binary Results Journal file format
+		static constexpr uint32_t FileVersion = 2;
+
+		// The time duration that represents how we store the values in the file using 64 bit integer with resolution of 100 nanoseconds
+		// Note: Unix Time, time since 00:00:00 Coordinated Universal Time (UTC), Thursday, 1 January 1970, not counting leap seconds
+		using ContentTimePeriod = std::ratio<1, 10'000'000>;
+		using ContentDuration = std::chrono::duration<long long, ContentTimePeriod>;
+
+	public:
+		static void WriteHeader(std::ostream& stream)
+		{
+			// Write the File Header with version
+			stream.write("BRJ\0", 4);
+			WriteValue(stream, FileVersion);
+		}
+
+		/// <summary>
+		/// Write a single self contained record, the files are written as full paths so the
+		/// journal does not depend on a shared file table that would need to be rewritten
+		/// </summary>
+		static void WriteRecord(
+			std::ostream& stream,
+			OperationId operationId,
+			const OperationResult& result,
+			const FileSystemState& fileSystemState)
+		{
+			auto payloadStream = std::stringstream();
+			WriteOperationResult(payloadStream, operationId, result, fileSystemState);
+			auto payload = payloadStream.str();
+
+			// Frame the record with the size and checksum to allow a reader to detect a partial write
+			WriteValue(stream, static_cast<uint32_t>(payload.size()));
+			stream.write(payload.data(), payload.size());
+			WriteValue(stream, ContentHash::Hash(payload));
+		}
+
+	private:
+		static void WriteOperationResult(
+			std::ostream& stream,
+			OperationId operationId,
+			const OperationResult& result,
+			const FileSystemState& fileSystemState)
+		{
+			// Write out the operation id
+			WriteValue(stream, operationId);
+
+			// Write out the value indicating if there was a successful run
+			WriteValue(stream, result.WasSuccessfulRun);
+
+			// Use system clock with a known epoch
+			#ifdef _WIN32
+			auto evaluateTimeSystem = std::chrono::clock_cast<std::chrono::system_clock>(result.EvaluateTime);
+			#else
+			auto evaluateTimeSystem = std::chrono::file_clock::to_sys(result.EvaluateTime);
+			#endif
+
+			// Write the tick offset of the system clock since its epoch
+			auto evaluateTimeDuration = std::chrono::duration_cast<ContentDuration>(evaluateTimeSystem.time_since_epoch());
+			int64_t evaluateTimeCount = evaluateTimeDuration.count();
+			WriteValue(stream, evaluateTimeCount);
+
+			// Write out the run statistics
+			int64_t evaluateDurationCount = result.EvaluateDuration.count();
+			WriteValue(stream, evaluateDurationCount);
+			WriteValue(stream, result.PeakMemoryUsage);
+
+			// Write out the observed input files
+			WriteFiles(stream, result.ObservedInput, fileSystemState);
+
+			// Write out the observed input content hashes
+			WriteValue(stream, static_cast<uint32_t>(result.ObservedInputHashes.size()));
+			for (auto value : result.ObservedInputHashes)
+			{
+				WriteValue(stream, value);
+			}
+
+			// Write out the observed output files
+			WriteFiles(stream, result.ObservedOutput, fileSystemState);
+		}
+
+		static void WriteFiles(
+			std::ostream& stream,
+			const std::vector<FileId>& files,
+			const FileSystemState& fileSystemState)
+		{
+			WriteValue(stream, static_cast<uint32_t>(files.size()));
+			for (auto fileId : files)
+			{
+				WriteValue(stream, fileSystemState.GetFilePath(fileId).ToString());
+			}
+		}
+
+		static void WriteValue(std::ostream& stream, uint32_t value)
+		{
+			stream.write(reinterpret_cast<char*>(&value), sizeof(uint32_t));
+		}
+
+		static void WriteValue(std::ostream& stream, int64_t value)
+		{
+			stream.write(reinterpret_cast<char*>(&value), sizeof(int64_t));
+		}
+
+		static void WriteValue(std::ostream& stream, uint64_t value)
+		{
+			stream.write(reinterpret_cast<char*>(&value), sizeof(uint64_t));
+		}
+
+		static void WriteValue(std::ostream& stream, bool value)
+		{
+			uint32_t integerValue = value ? 1u : 0u;
+			stream.write(reinterpret_cast<char*>(&integerValue), sizeof(uint32_t));
+		}
+
+		static void WriteValue(std::ostream& stream, std::string_view value)
+		{
+			WriteValue(stream, static_cast<uint32_t>(value.size()));
+			stream.write(value.data(), value.size());
+		}
+	};
+}
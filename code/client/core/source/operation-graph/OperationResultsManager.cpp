@@ -8,12 +8,15 @@ module;
 #include <memory>
 #include <set>
 #include <stdexcept>
+#include <vector>
 
 export module Soup.Core:OperationResultsManager;
 
 import Opal;
 import :FileSystemState;
+import :OperationInfo;
 import :OperationResults;
+import :OperationResultsJournalReader;
 import :OperationResultsReader;
 import :OperationResultsWriter;
 
@@ -61,6 +64,40 @@ namespace Soup::Core
 			}
 		}
 
+		/// <summary>
+		/// Replay the results that were appended to the journal after the operation state was last saved
+		/// </summary>
+		static bool TryLoadJournal(
+			const Path& operationResultsJournalFile,
+			OperationResults& result,
+			std::vector<OperationId>& journaledOperations,
+			FileSystemState& fileSystemState)
+		{
+			// Open the file to read from
+			std::shared_ptr<System::IInputFile> file;
+			if (!System::IFileSystem::Current().TryOpenRead(operationResultsJournalFile, true, file))
+			{
+				return false;
+			}
+
+			// Read the contents of the journal file
+			try
+			{
+				journaledOperations = OperationResultsJournalReader::Deserialize(file->GetInStream(), result, fileSystemState);
+				return true;
+			}
+			catch(std::runtime_error& ex)
+			{
+				Log::Error(ex.what());
+				return false;
+			}
+			catch(...)
+			{
+				Log::Error("Failed to parse operation results journal");
+				return false;
+			}
+		}
+
 		/// <summary>
 		/// Save the operation state for the provided directory
 		/// </summary>
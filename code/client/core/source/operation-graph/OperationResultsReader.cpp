@@ -29,7 +29,11 @@ namespace Soup::Core
 	{
 	private:
 		// Binary Operation Results file format
-		static constexpr uint32_t FileVersion = 2;
+		static constexpr uint32_t FileVersion = 4;
+
+		// The previous versions without the input content hashes or run statistics that can still be read
+		static constexpr uint32_t NoContentHashFileVersion = 2;
+		static constexpr uint32_t NoRunStatisticsFileVersion = 3;
 
 		// The time duration that represents how we store the values in the file using 64 bit integer with resolution of 100 nanoseconds
 		// Note: Unix Time, time since 00:00:00 Coordinated Universal Time (UTC), Thursday, 1 January 1970, not counting leap seconds
@@ -78,7 +82,9 @@ namespace Soup::Core
 			}
 
 			auto fileVersion = ReadUInt32(data, size, offset);
-			if (fileVersion != FileVersion)
+			if (fileVersion != FileVersion &&
+				fileVersion != NoContentHashFileVersion &&
+				fileVersion != NoRunStatisticsFileVersion)
 			{
 				throw std::runtime_error("Operation results file version does not match expected");
 			}
@@ -124,7 +130,7 @@ namespace Soup::Core
 			auto results = OperationResults();
 			for (auto i = 0u; i < resultCount; i++)
 			{
-				ReadOperationResult(data, size, offset, activeFileIdMap, results);
+				ReadOperationResult(data, size, offset, fileVersion, activeFileIdMap, results);
 			}
 
 			return results;
@@ -134,6 +140,7 @@ namespace Soup::Core
 			char* data,
 			size_t size,
 			size_t& offset,
+			uint32_t fileVersion,
 			const std::unordered_map<FileId, FileId>& activeFileIdMap,
 			OperationResults& results)
 		{
@@ -155,9 +162,23 @@ namespace Soup::Core
 			auto evaluateTimeFile = std::chrono::file_clock::from_sys(evaluateTimeSystem);
 			#endif
 
+			// Read the run statistics
+			auto evaluateDuration = std::chrono::microseconds(0);
+			uint64_t peakMemoryUsage = 0;
+			if (fileVersion != NoContentHashFileVersion && fileVersion != NoRunStatisticsFileVersion)
+			{
+				evaluateDuration = std::chrono::microseconds(ReadInt64(data, size, offset));
+				peakMemoryUsage = ReadUInt64(data, size, offset);
+			}
+
 			// Read the observed input files
 			auto observedInput = ReadFileIdList(data, size, offset, activeFileIdMap);
 
+			// Read the observed input content hashes
+			auto observedInputHashes = std::vector<uint64_t>();
+			if (fileVersion != NoContentHashFileVersion)
+				observedInputHashes = ReadUInt64List(data, size, offset);
+
 			// Read the observed output files
 			auto observedOutput = ReadFileIdList(data, size, offset, activeFileIdMap);
 
@@ -165,7 +186,10 @@ namespace Soup::Core
 				wasSuccessfulRun,
 				evaluateTimeFile,
 				std::move(observedInput),
-				std::move(observedOutput));
+				std::move(observedOutput),
+				std::move(observedInputHashes),
+				evaluateDuration,
+				peakMemoryUsage);
 
 			results.AddOrUpdateOperationResult(operationId, std::move(result));
 		}
@@ -186,6 +210,14 @@ namespace Soup::Core
 			return result;
 		}
 
+		static uint64_t ReadUInt64(char* data, size_t size, size_t& offset)
+		{
+			uint64_t result = 0;
+			Read(data, size, offset, reinterpret_cast<char*>(&result), sizeof(uint64_t));
+
+			return result;
+		}
+
 		static bool ReadBoolean(char* data, size_t size, size_t& offset)
 		{
 			uint32_t result = 0;
@@ -223,6 +255,19 @@ namespace Soup::Core
 			return result;
 		}
 
+		static std::vector<uint64_t> ReadUInt64List(
+			char* data, size_t size, size_t& offset)
+		{
+			auto listLength = ReadUInt32(data, size, offset);
+			auto result = std::vector<uint64_t>(listLength);
+			for (auto i = 0u; i < listLength; i++)
+			{
+				result[i] = ReadUInt64(data, size, offset);
+			}
+
+			return result;
+		}
+
 		static std::vector<OperationId> ReadOperationIdList(
 			char* data, size_t size, size_t& offset)
 		{
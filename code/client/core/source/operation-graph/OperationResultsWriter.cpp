@@ -26,7 +26,7 @@ namespace Soup::Core
 	{
 	private:
 		// Binary Operation results file format
-		static constexpr uint32_t FileVersion = 2;
+		static constexpr uint32_t FileVersion = 4;
 
 		// The time duration that represents how we store the values in the file using 64 bit integer with resolution of 100 nanoseconds
 		// Note: Unix Time, time since 00:00:00 Coordinated Universal Time (UTC), Thursday, 1 January 1970, not counting leap seconds
@@ -85,9 +85,17 @@ namespace Soup::Core
 			int64_t evaluateTimeCount = evaluateTimeDuration.count();
 			WriteValue(stream, evaluateTimeCount);
 
+			// Write out the run statistics
+			int64_t evaluateDurationCount = result.EvaluateDuration.count();
+			WriteValue(stream, evaluateDurationCount);
+			WriteValue(stream, result.PeakMemoryUsage);
+
 			// Write out the observed input files
 			WriteValues(stream, result.ObservedInput);
 
+			// Write out the observed input content hashes
+			WriteValues(stream, result.ObservedInputHashes);
+
 			// Write out the observed output files
 			WriteValues(stream, result.ObservedOutput);
 		}
@@ -102,6 +110,11 @@ namespace Soup::Core
 			stream.write(reinterpret_cast<char*>(&value), sizeof(int64_t));
 		}
 
+		static void WriteValue(std::ostream& stream, uint64_t value)
+		{
+			stream.write(reinterpret_cast<char*>(&value), sizeof(uint64_t));
+		}
+
 		static void WriteValue(std::ostream& stream, bool value)
 		{
 			uint32_t integerValue = value ? 1u : 0u;
@@ -122,5 +135,14 @@ namespace Soup::Core
 				WriteValue(stream, value);
 			}
 		}
+
+		static void WriteValues(std::ostream& stream, const std::vector<uint64_t>& values)
+		{
+			WriteValue(stream, static_cast<uint32_t>(values.size()));
+			for (auto& value : values)
+			{
+				WriteValue(stream, value);
+			}
+		}
 	};
 }
\ No newline at end of file
@@ -5,14 +5,15 @@
 module;
 
 #include <optional>
-#include <regex>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 export module Soup.Core:PackageIdentifier;
 
 import Opal;
 import :PackageName;
+import :PackageReferenceParser;
 
 using namespace Opal;
 
@@ -31,32 +32,25 @@ namespace Soup::Core
 		/// <summary>
 		/// Try parse a package identifier from the provided string
 		/// </summary>
-		static bool TryParse(const std::string& value, PackageIdentifier& result)
+		static bool TryParse(std::string_view value, PackageIdentifier& result)
 		{
-			// Reuse regex between runs
-			static auto nameRegex = std::regex(R"(^(?:\[([\w#+]+)\])?(?:([A-Za-z][\w.]*)\|)?([A-Za-z][\w.]*)$)");
-
 			// Attempt to parse Named package
-			auto nameMatch = std::smatch();
-			if (std::regex_match(value, nameMatch, nameRegex))
+			auto parts = PackageReferenceParts();
+			if (PackageReferenceParser::TryParse(value, parts) && !parts.Version.has_value())
 			{
 				std::optional<std::string> language = std::nullopt;
-				auto languageMatch = nameMatch[1];
-				if (languageMatch.matched)
+				if (parts.Language.has_value())
 				{
-					language = languageMatch.str();
+					language = std::string(parts.Language.value());
 				}
 
 				std::optional<std::string> owner = std::nullopt;
-				auto ownerMatch = nameMatch[2];
-				if (ownerMatch.matched)
+				if (parts.Owner.has_value())
 				{
-					owner = ownerMatch.str();
+					owner = std::string(parts.Owner.value());
 				}
 
-				auto name = nameMatch[3].str();
-
-				result = PackageIdentifier(std::move(language), std::move(owner), std::move(name));
+				result = PackageIdentifier(std::move(language), std::move(owner), std::string(parts.Name));
 				return true;
 			}
 			else
@@ -69,7 +63,7 @@ namespace Soup::Core
 		/// <summary>
 		/// Parse a package identifier from the provided string.
 		/// </summary>
-		static PackageIdentifier Parse(const std::string& value)
+		static PackageIdentifier Parse(std::string_view value)
 		{
 			PackageIdentifier result;
 			if (TryParse(value, result))
@@ -5,13 +5,14 @@
 module;
 
 #include <optional>
-#include <regex>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 export module Soup.Core:PackageName;
 
 import Opal;
+import :PackageReferenceParser;
 
 using namespace Opal;
 
@@ -30,26 +31,22 @@ namespace Soup::Core
 		/// <summary>
 		/// Try parse a package name from the provided string
 		/// </summary>
-		static bool TryParse(const std::string& value, PackageName& result)
+		static bool TryParse(std::string_view value, PackageName& result)
 		{
-			// Reuse regex between runs
-			static auto nameRegex = std::regex(R"(^(?:([A-Za-z][\w.]*)\|)?([A-Za-z][\w.]*)$)");
-
 			// Attempt to parse Named package
-			auto nameMatch = std::smatch();
-			if (std::regex_match(value, nameMatch, nameRegex))
+			auto parts = PackageReferenceParts();
+			if (PackageReferenceParser::TryParse(value, parts) &&
+				!parts.Language.has_value() &&
+				!parts.Version.has_value())
 			{
 				// The package is a valid name
 				std::optional<std::string> owner = std::nullopt;
-				auto ownerMatch = nameMatch[1];
-				if (ownerMatch.matched)
+				if (parts.Owner.has_value())
 				{
-					owner = ownerMatch.str();
+					owner = std::string(parts.Owner.value());
 				}
 
-				auto name = nameMatch[2].str();
-
-				result = PackageName(std::move(owner), std::move(name));
+				result = PackageName(std::move(owner), std::string(parts.Name));
 				return true;
 			}
 			else
@@ -62,7 +59,7 @@ namespace Soup::Core
 		/// <summary>
 		/// Parse a package name from the provided string.
 		/// </summary>
-		static PackageName Parse(const std::string& value)
+		static PackageName Parse(std::string_view value)
 		{
 			PackageName result;
 			if (TryParse(value, result))
@@ -6,15 +6,17 @@ module;
 
 #include <optional>
 #include <format>
-#include <regex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 
 export module Soup.Core:PackageReference;
 
 import Opal;
 import :PackageIdentifier;
+import :PackageReferenceParser;
 
 using namespace Opal;
 
@@ -35,70 +37,38 @@ namespace Soup::Core
 		/// <summary>
 		/// Try parse a package reference from the provided string
 		/// </summary>
-		static bool TryParse(const std::string& value, PackageReference& result)
+		static bool TryParse(std::string_view value, PackageReference& result)
 		{
-			// Reuse regex between runs
-			static auto nameRegex = std::regex(R"(^(?:\[([\w#+]+)\])?(?:([A-Za-z][\w.]*)\|)?([A-Za-z][\w.]*)(?:@(\d+(?:.\d+)?(?:.\d+)?))?$)");
-
-			auto parseValue = value;
-			if (parseValue.starts_with("C++|"))
+			if (value.starts_with("C++|"))
 			{
-				parseValue = std::format("[C++]Soup|{}", parseValue.substr(4));
+				auto parseValue = std::format("[C++]Soup|{}", value.substr(4));
 				Log::Info("Replace C++| -> {}", parseValue);
+				return TryParseNamed(parseValue, result) || TryParsePath(value, result);
 			}
 
-			// Attempt to parse Named reference
-			auto nameMatch = std::smatch();
-			if (std::regex_match(parseValue, nameMatch, nameRegex))
+			// Most recipes reference the same small set of packages, reuse previous results
+			auto& parseCache = GetParseCache();
+			auto findParseResult = parseCache.find(value);
+			if (findParseResult != parseCache.end())
 			{
-				// The package is a published reference
-				std::optional<std::string> language = std::nullopt;
-				auto languageMatch = nameMatch[1];
-				if (languageMatch.matched)
-				{
-					language = languageMatch.str();
-				}
-
-				std::optional<std::string> owner = std::nullopt;
-				auto ownerMatch = nameMatch[2];
-				if (ownerMatch.matched)
-				{
-					owner = ownerMatch.str();
-				}
+				result = findParseResult->second;
+				return true;
+			}
 
-				auto name = nameMatch[3].str();
+			if (!TryParseNamed(value, result) && !TryParsePath(value, result))
+				return false;
 
-				std::optional<SemanticVersion> version = std::nullopt;
-				auto versionMatch = nameMatch[4];
-				if (versionMatch.matched)
-				{
-					version = SemanticVersion::Parse(versionMatch.str());
-				}
+			if (parseCache.size() >= MaxParseCacheSize)
+				parseCache.clear();
 
-				result = PackageReference(std::move(language), std::move(owner), std::move(name), version);
-				return true;
-			}
-			else
-			{
-				try
-				{
-					// Assume that this package is a relative path reference
-					// TODO: Add a try parse Path
-					result = PackageReference(Path(value));
-					return true;
-				}
-				catch (const std::runtime_error&)
-				{
-					result = PackageReference();
-					return false;
-				}
-			}
+			parseCache.emplace(value, result);
+			return true;
 		}
 
 		/// <summary>
 		/// Parse a package reference from the provided string.
 		/// </summary>
-		static PackageReference Parse(const std::string& value)
+		static PackageReference Parse(std::string_view value)
 		{
 			PackageReference result;
 			if (TryParse(value, result))
@@ -111,6 +81,72 @@ namespace Soup::Core
 			}
 		}
 
+	private:
+		static const size_t MaxParseCacheSize = 4096;
+
+		struct ParseCacheHash
+		{
+			using is_transparent = void;
+
+			std::size_t operator()(std::string_view value) const
+			{
+				return std::hash<std::string_view>{}(value);
+			}
+		};
+
+		using ParseCache = std::unordered_map<std::string, PackageReference, ParseCacheHash, std::equal_to<>>;
+
+		static ParseCache& GetParseCache()
+		{
+			thread_local auto parseCache = ParseCache();
+			return parseCache;
+		}
+
+		static bool TryParseNamed(std::string_view value, PackageReference& result)
+		{
+			auto parts = PackageReferenceParts();
+			if (!PackageReferenceParser::TryParse(value, parts))
+				return false;
+
+			// The package is a published reference
+			std::optional<std::string> language = std::nullopt;
+			if (parts.Language.has_value())
+			{
+				language = std::string(parts.Language.value());
+			}
+
+			std::optional<std::string> owner = std::nullopt;
+			if (parts.Owner.has_value())
+			{
+				owner = std::string(parts.Owner.value());
+			}
+
+			std::optional<SemanticVersion> version = std::nullopt;
+			if (parts.Version.has_value())
+			{
+				version = SemanticVersion::Parse(parts.Version.value());
+			}
+
+			result = PackageReference(std::move(language), std::move(owner), std::string(parts.Name), version);
+			return true;
+		}
+
+		static bool TryParsePath(std::string_view value, PackageReference& result)
+		{
+			try
+			{
+				// Assume that this package is a relative path reference
+				// TODO: Add a try parse Path
+				result = PackageReference(Path(std::string(value)));
+				return true;
+			}
+			catch (const std::runtime_error&)
+			{
+				result = PackageReference();
+				return false;
+			}
+		}
+
 	public:
 		/// <summary>
 		/// Initializes a new instance of the <see cref="PackageReference"/> class.
@@ -0,0 +1,155 @@
+﻿// <copyright file="PackageReferenceParser.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <optional>
+#include <string_view>
+
+export module Soup.Core:PackageReferenceParser;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The views into the original string for each segment of a package reference
+	/// </summary>
+	export struct PackageReferenceParts
+	{
+		std::optional<std::string_view> Language;
+		std::optional<std::string_view> Owner;
+		std::string_view Name;
+		std::optional<std::string_view> Version;
+	};
+
+	/// <summary>
+	/// A hand written scanner for the package reference grammar
+	///   [Language]Owner|Name@Version
+	/// where the language, owner and version are all optional.
+	/// Language := [A-Za-z0-9_#+]+
+	/// Owner, Name := [A-Za-z][A-Za-z0-9_.]*
+	/// Version := Digits(.Digits){0,2}
+	/// The results are views into the original value so the parse never allocates.
+	/// </summary>
+	export class PackageReferenceParser
+	{
+	public:
+		/// <summary>
+		/// Try parse the segments of a package reference
+		/// </summary>
+		static bool TryParse(std::string_view value, PackageReferenceParts& result)
+		{
+			result = PackageReferenceParts();
+			size_t offset = 0;
+
+			// Check for an optional language
+			if (offset < value.size() && value[offset] == '[')
+			{
+				auto languageStart = offset + 1;
+				auto languageEnd = languageStart;
+				while (languageEnd < value.size() && IsLanguageCharacter(value[languageEnd]))
+					languageEnd++;
+
+				if (languageEnd == languageStart || languageEnd >= value.size() || value[languageEnd] != ']')
+					return false;
+
+				result.Language = value.substr(languageStart, languageEnd - languageStart);
+				offset = languageEnd + 1;
+			}
+
+			// The first identifier is either the owner or the name
+			std::string_view identifier;
+			if (!TryParseIdentifier(value, offset, identifier))
+				return false;
+
+			if (offset < value.size() && value[offset] == '|')
+			{
+				offset++;
+				result.Owner = identifier;
+				if (!TryParseIdentifier(value, offset, identifier))
+					return false;
+			}
+
+			result.Name = identifier;
+
+			// Check for an optional version
+			if (offset < value.size() && value[offset] == '@')
+			{
+				offset++;
+				auto version = value.substr(offset);
+				if (!IsVersion(version))
+					return false;
+
+				result.Version = version;
+				offset = value.size();
+			}
+
+			return offset == value.size();
+		}
+
+	private:
+		static bool TryParseIdentifier(std::string_view value, size_t& offset, std::string_view& result)
+		{
+			auto start = offset;
+			if (start >= value.size() || !IsLetter(value[start]))
+				return false;
+
+			auto end = start + 1;
+			while (end < value.size() && IsIdentifierCharacter(value[end]))
+				end++;
+
+			result = value.substr(start, end - start);
+			offset = end;
+			return true;
+		}
+
+		static bool IsVersion(std::string_view value)
+		{
+			size_t offset = 0;
+			int segmentCount = 0;
+			while (true)
+			{
+				auto start = offset;
+				while (offset < value.size() && IsDigit(value[offset]))
+					offset++;
+
+				if (offset == start)
+					return false;
+
+				segmentCount++;
+				if (offset == value.size())
+					return true;
+
+				if (value[offset] != '.' || segmentCount == 3)
+					return false;
+
+				offset++;
+			}
+		}
+
+		static bool IsLetter(char value)
+		{
+			return (value >= 'A' && value <= 'Z') || (value >= 'a' && value <= 'z');
+		}
+
+		static bool IsDigit(char value)
+		{
+			return value >= '0' && value <= '9';
+		}
+
+		static bool IsWordCharacter(char value)
+		{
+			return IsLetter(value) || IsDigit(value) || value == '_';
+		}
+
+		static bool IsIdentifierCharacter(char value)
+		{
+			return IsWordCharacter(value) || value == '.';
+		}
+
+		static bool IsLanguageCharacter(char value)
+		{
+			return IsWordCharacter(value) || value == '#' || value == '+';
+		}
+	};
+}
@@ -0,0 +1,223 @@
+﻿// <copyright file="ContentHash.cpp" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+module;
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <stdexcept>
+#include <string_view>
+
+export module Soup.Core:ContentHash;
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// A fast non-cryptographic hash of file contents used to detect when a file has been touched
+	/// without changing. Implements the 64 bit xxHash algorithm (XXH64) with a zero seed.
+	/// </summary>
+	export class ContentHash
+	{
+	private:
+		static constexpr uint64_t Prime1 = 11400714785074694791ull;
+		static constexpr uint64_t Prime2 = 14029467366897019727ull;
+		static constexpr uint64_t Prime3 = 1609587929392839161ull;
+		static constexpr uint64_t Prime4 = 9650029242287828579ull;
+		static constexpr uint64_t Prime5 = 2870177450012600261ull;
+
+		static constexpr size_t StripeSize = 32;
+		static constexpr size_t ReadBufferSize = 64 * 1024;
+
+		std::array<uint64_t, 4> _accumulators;
+		std::array<char, StripeSize> _stripe;
+		size_t _stripeSize;
+		uint64_t _totalSize;
+
+	public:
+		/// <summary>
+		/// Hash a single block of memory
+		/// </summary>
+		static uint64_t Hash(std::string_view data)
+		{
+			auto hash = ContentHash();
+			hash.Update(data.data(), data.size());
+			return hash.Finalize();
+		}
+
+		/// <summary>
+		/// Hash the remaining contents of a stream
+		/// </summary>
+		static uint64_t Hash(std::istream& stream)
+		{
+			auto hash = ContentHash();
+			auto buffer = std::array<char, ReadBufferSize>();
+			while (stream)
+			{
+				stream.read(buffer.data(), buffer.size());
+				hash.Update(buffer.data(), static_cast<size_t>(stream.gcount()));
+			}
+
+			if (stream.bad())
+				throw std::runtime_error("Failed to read stream contents for hash");
+
+			return hash.Finalize();
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="ContentHash"/> class.
+		/// </summary>
+		ContentHash() :
+			_accumulators({ Prime1 + Prime2, Prime2, 0, 0 - Prime1 }),
+			_stripe(),
+			_stripeSize(0),
+			_totalSize(0)
+		{
+		}
+
+		/// <summary>
+		/// Append the next block of data to the hash
+		/// </summary>
+		void Update(const char* data, size_t size)
+		{
+			_totalSize += size;
+
+			// Complete the partially filled stripe
+			if (_stripeSize > 0)
+			{
+				auto count = std::min(size, StripeSize - _stripeSize);
+				std::memcpy(_stripe.data() + _stripeSize, data, count);
+				_stripeSize += count;
+				data += count;
+				size -= count;
+
+				if (_stripeSize < StripeSize)
+					return;
+
+				ConsumeStripe(_stripe.data());
+				_stripeSize = 0;
+			}
+
+			while (size >= StripeSize)
+			{
+				ConsumeStripe(data);
+				data += StripeSize;
+				size -= StripeSize;
+			}
+
+			if (size > 0)
+			{
+				std::memcpy(_stripe.data(), data, size);
+				_stripeSize = size;
+			}
+		}
+
+		/// <summary>
+		/// Calculate the final hash for all data that has been appended
+		/// </summary>
+		uint64_t Finalize() const
+		{
+			uint64_t result;
+			if (_totalSize >= StripeSize)
+			{
+				result = RotateLeft(_accumulators[0], 1) +
+					RotateLeft(_accumulators[1], 7) +
+					RotateLeft(_accumulators[2], 12) +
+					RotateLeft(_accumulators[3], 18);
+				for (auto accumulator : _accumulators)
+					result = MergeRound(result, accumulator);
+			}
+			else
+			{
+				result = _accumulators[2] + Prime5;
+			}
+
+			result += _totalSize;
+
+			// Consume the remaining tail that did not fill a full stripe
+			auto data = _stripe.data();
+			auto size = _stripeSize;
+			while (size >= 8)
+			{
+				result ^= Round(0, Read64(data));
+				result = RotateLeft(result, 27) * Prime1 + Prime4;
+				data += 8;
+				size -= 8;
+			}
+
+			if (size >= 4)
+			{
+				result ^= static_cast<uint64_t>(Read32(data)) * Prime1;
+				result = RotateLeft(result, 23) * Prime2 + Prime3;
+				data += 4;
+				size -= 4;
+			}
+
+			while (size > 0)
+			{
+				result ^= static_cast<uint64_t>(static_cast<uint8_t>(*data)) * Prime5;
+				result = RotateLeft(result, 11) * Prime1;
+				data++;
+				size--;
+			}
+
+			// Avalanche
+			result ^= result >> 33;
+			result *= Prime2;
+			result ^= result >> 29;
+			result *= Prime3;
+			result ^= result >> 32;
+
+			return result;
+		}
+
+	private:
+		void ConsumeStripe(const char* data)
+		{
+			for (auto i = 0u; i < _accumulators.size(); i++)
+			{
+				_accumulators[i] = Round(_accumulators[i], Read64(data + (i * 8)));
+			}
+		}
+
+		static uint64_t Round(uint64_t accumulator, uint64_t input)
+		{
+			accumulator += input * Prime2;
+			accumulator = RotateLeft(accumulator, 31);
+			accumulator *= Prime1;
+			return accumulator;
+		}
+
+		static uint64_t MergeRound(uint64_t accumulator, uint64_t value)
+		{
+			accumulator ^= Round(0, value);
+			accumulator = accumulator * Prime1 + Prime4;
+			return accumulator;
+		}
+
+		static uint64_t RotateLeft(uint64_t value, int count)
+		{
+			return (value << count) | (value >> (64 - count));
+		}
+
+		static uint64_t Read64(const char* data)
+		{
+			// The hash is defined over little endian values
+			uint64_t result = 0;
+			for (auto i = 0; i < 8; i++)
+				result |= static_cast<uint64_t>(static_cast<uint8_t>(data[i])) << (i * 8);
+			return result;
+		}
+
+		static uint32_t Read32(const char* data)
+		{
+			uint32_t result = 0;
+			for (auto i = 0; i < 4; i++)
+				result |= static_cast<uint32_t>(static_cast<uint8_t>(data[i])) << (i * 8);
+			return result;
+		}
+	};
+}
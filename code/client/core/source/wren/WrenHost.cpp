@@ -14,6 +14,7 @@ module;
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 export module Soup.Core:WrenHost;
 
@@ -32,6 +33,7 @@ export namespace Soup::Core
 
 	private:
 		std::map<std::string, Path> _bundles;
+		std::vector<Path> _loadedFiles;
 
 	protected:
 		Path _scriptFile;
@@ -43,6 +45,7 @@ export namespace Soup::Core
 			_scriptFile(std::move(scriptFile)),
 			_bundlesFile(std::move(bundlesFile)),
 			_bundles(),
+			_loadedFiles(),
 			_vm(nullptr)
 		{
 			// Configure the Wren Virtual Machine
@@ -65,6 +68,14 @@ export namespace Soup::Core
 			_vm = nullptr;
 		}
 
+		/// <summary>
+		/// Get the set of files that were read to load the script and all imported modules
+		/// </summary>
+		const std::vector<Path>& GetLoadedFiles() const
+		{
+			return _loadedFiles;
+		}
+
 		void InterpretMain()
 		{
 			// Load the bundles
@@ -90,6 +101,8 @@ export namespace Soup::Core
 
 					_bundles.emplace(bundleName, Path(bundleTable["Root"].AsString()));
 				}
+
+				_loadedFiles.push_back(_bundlesFile.value());
 			}
 
 			// Load the script
@@ -100,6 +113,7 @@ export namespace Soup::Core
 			auto script = std::string(
 				std::istreambuf_iterator<char>(scriptFile),
 				std::istreambuf_iterator<char>());
+			_loadedFiles.push_back(_scriptFile);
 
 			// Interpret the script
 			WrenHelpers::ThrowIfFailed(wrenInterpret(_vm, _scriptFile.ToString().c_str(), script.c_str()));
@@ -213,6 +227,7 @@ export namespace Soup::Core
 						
 					result.onComplete = &FreeSourceOnLoaded;
 					result.source = ReturnRawString(script);
+					_loadedFiles.push_back(Path(moduleName));
 				}
 			}
 
@@ -0,0 +1,281 @@
+// <copyright file="ActionCacheTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "MockActionCacheStore.h"
+
+namespace Soup::Core::UnitTests
+{
+	class ActionCacheTests
+	{
+	public:
+		// [[Fact]]
+		void TryRestore_Empty()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto fileSystemState = FileSystemState();
+			auto store = MockActionCacheStore();
+			auto uut = ActionCache(store, fileSystemState);
+
+			auto command = CommandInfo(
+				Path("C:/Root/"),
+				Path("C:/Compiler.exe"),
+				{ "Input.cpp" });
+			auto operationResult = OperationResult();
+			auto result = uut.TryRestore(command, operationResult);
+
+			Assert::IsFalse(result, "Verify the result is false.");
+			Assert::AreEqual(OperationResult(), operationResult, "Verify the operation result is unchanged.");
+		}
+
+		// [[Fact]]
+		void Store_TryRestore()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Input.cpp"),
+				std::make_shared<MockFile>(std::stringstream("int main() {}")));
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Output.obj"),
+				std::make_shared<MockFile>(std::stringstream("OBJ")));
+
+			auto fileSystemState = FileSystemState();
+			auto inputFile = fileSystemState.ToFileId(Path("C:/Root/Input.cpp"));
+			auto outputFile = fileSystemState.ToFileId(Path("C:/Root/Output.obj"));
+
+			auto store = MockActionCacheStore();
+			auto uut = ActionCache(store, fileSystemState);
+
+			auto command = CommandInfo(
+				Path("C:/Root/"),
+				Path("C:/Compiler.exe"),
+				{ "Input.cpp" });
+			uut.Store(
+				command,
+				OperationResult(
+					true,
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::time_point<std::chrono::system_clock>()),
+					{ inputFile, },
+					{ outputFile, }));
+
+			// Verify the manifest, action and output blob were stored
+			Assert::AreEqual<size_t>(3, store.GetEntries().size(), "Verify the store entries match expected.");
+
+			auto operationResult = OperationResult();
+			auto result = uut.TryRestore(command, operationResult);
+
+			Assert::IsTrue(result, "Verify the result is true.");
+			Assert::AreEqual(
+				OperationResult(
+					true,
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::time_point<std::chrono::system_clock>()),
+					{ inputFile, },
+					{ outputFile, }),
+				operationResult,
+				"Verify the operation result matches expected.");
+
+			// Verify the output was restored
+			auto outputMockFile = fileSystem->GetMockFile(Path("C:/Root/Output.obj"));
+			Assert::AreEqual("OBJ", outputMockFile->Content.str(), "Verify the output content matches expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+		}
+
+		// [[Fact]]
+		void Store_TryRestore_InputContentChanged()
+		{
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Input.cpp"),
+				std::make_shared<MockFile>(std::stringstream("int main() {}")));
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Output.obj"),
+				std::make_shared<MockFile>(std::stringstream("OBJ")));
+
+			auto fileSystemState = FileSystemState();
+			auto inputFile = fileSystemState.ToFileId(Path("C:/Root/Input.cpp"));
+			auto outputFile = fileSystemState.ToFileId(Path("C:/Root/Output.obj"));
+
+			auto store = MockActionCacheStore();
+			auto uut = ActionCache(store, fileSystemState);
+
+			auto command = CommandInfo(
+				Path("C:/Root/"),
+				Path("C:/Compiler.exe"),
+				{ "Input.cpp" });
+			uut.Store(
+				command,
+				OperationResult(
+					true,
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::time_point<std::chrono::system_clock>()),
+					{ inputFile, },
+					{ outputFile, }));
+
+			// Change the input content
+			fileSystem->GetMockFile(Path("C:/Root/Input.cpp"))->Content = std::stringstream("int main() { return 1; }");
+			fileSystemState.InvalidateFileWriteTimes({ inputFile, });
+
+			auto operationResult = OperationResult();
+			auto result = uut.TryRestore(command, operationResult);
+
+			Assert::IsFalse(result, "Verify the result is false.");
+		}
+
+		// [[Fact]]
+		void Store_TryRestore_NewFileIds_SortsObservedFiles()
+		{
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Input1.cpp"),
+				std::make_shared<MockFile>(std::stringstream("int main() {}")));
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Input2.h"),
+				std::make_shared<MockFile>(std::stringstream("#pragma once")));
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Output.obj"),
+				std::make_shared<MockFile>(std::stringstream("OBJ")));
+
+			auto command = CommandInfo(
+				Path("C:/Root/"),
+				Path("C:/Compiler.exe"),
+				{ "Input1.cpp" });
+
+			auto store = MockActionCacheStore();
+
+			{
+				auto fileSystemState = FileSystemState();
+				auto inputFile1 = fileSystemState.ToFileId(Path("C:/Root/Input1.cpp"));
+				auto inputFile2 = fileSystemState.ToFileId(Path("C:/Root/Input2.h"));
+				auto outputFile = fileSystemState.ToFileId(Path("C:/Root/Output.obj"));
+
+				auto uut = ActionCache(store, fileSystemState);
+				uut.Store(
+					command,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::time_point<std::chrono::system_clock>()),
+						{ inputFile1, inputFile2, },
+						{ outputFile, }));
+			}
+
+			// Restore from a new file system state that assigns the file ids in a different order
+			auto fileSystemState = FileSystemState();
+			auto outputFile = fileSystemState.ToFileId(Path("C:/Root/Output.obj"));
+			auto inputFile2 = fileSystemState.ToFileId(Path("C:/Root/Input2.h"));
+			auto inputFile1 = fileSystemState.ToFileId(Path("C:/Root/Input1.cpp"));
+
+			auto uut = ActionCache(store, fileSystemState);
+			auto operationResult = OperationResult();
+			auto result = uut.TryRestore(command, operationResult);
+
+			Assert::IsTrue(result, "Verify the result is true.");
+			Assert::AreEqual(
+				std::vector<FileId>({ inputFile2, inputFile1, }),
+				operationResult.ObservedInput,
+				"Verify the observed input is sorted.");
+			Assert::AreEqual(
+				std::vector<FileId>({ outputFile, }),
+				operationResult.ObservedOutput,
+				"Verify the observed output matches expected.");
+		}
+
+		// [[Fact]]
+		void Store_TryRestore_NewWorkingDirectory()
+		{
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("C:/Root1/Input.cpp"),
+				std::make_shared<MockFile>(std::stringstream("int main() {}")));
+			fileSystem->CreateMockFile(
+				Path("C:/Root1/Output.obj"),
+				std::make_shared<MockFile>(std::stringstream("OBJ")));
+			fileSystem->CreateMockFile(
+				Path("C:/Root2/Input.cpp"),
+				std::make_shared<MockFile>(std::stringstream("int main() {}")));
+
+			auto fileSystemState = FileSystemState();
+			auto store = MockActionCacheStore();
+			auto uut = ActionCache(store, fileSystemState);
+
+			uut.Store(
+				CommandInfo(
+					Path("C:/Root1/"),
+					Path("C:/Compiler.exe"),
+					{ "Input.cpp" }),
+				OperationResult(
+					true,
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::time_point<std::chrono::system_clock>()),
+					{ fileSystemState.ToFileId(Path("C:/Root1/Input.cpp")), },
+					{ fileSystemState.ToFileId(Path("C:/Root1/Output.obj")), }));
+
+			// Restore the same command with the same input content in another location
+			auto operationResult = OperationResult();
+			auto result = uut.TryRestore(
+				CommandInfo(
+					Path("C:/Root2/"),
+					Path("C:/Compiler.exe"),
+					{ "Input.cpp" }),
+				operationResult);
+
+			Assert::IsTrue(result, "Verify the result is true.");
+			Assert::AreEqual(
+				OperationResult(
+					true,
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::time_point<std::chrono::system_clock>()),
+					{ fileSystemState.ToFileId(Path("C:/Root2/Input.cpp")), },
+					{ fileSystemState.ToFileId(Path("C:/Root2/Output.obj")), }),
+				operationResult,
+				"Verify the operation result matches expected.");
+
+			// Verify the output was restored into the new location
+			auto outputMockFile = fileSystem->GetMockFile(Path("C:/Root2/Output.obj"));
+			Assert::AreEqual("OBJ", outputMockFile->Content.str(), "Verify the output content matches expected.");
+		}
+	};
+}
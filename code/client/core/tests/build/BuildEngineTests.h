@@ -176,6 +176,7 @@ namespace Soup::Core::UnitTests
 					"DIAG: Load PackageLock: C:/Users/Me/.soup/locks/Wren/Soup/Cpp/0.8.2/PackageLock.sml",
 					"INFO: Package lock loaded",
 					"DIAG: Load Recipe: C:/BuiltIn/Packages/Soup/Wren/0.4.3/Recipe.sml",
+					"INFO: File system state file does not exist",
 					"DIAG: 0>Package was prebuilt: Soup|Wren",
 					"DIAG: 2>Running Build: [Wren]Soup|Cpp",
 					"INFO: 2>Build 'Soup|Cpp'",
@@ -273,6 +274,7 @@ namespace Soup::Core::UnitTests
 					"TryOpenReadBinary: C:/Users/Me/.soup/packages/Wren/Soup/Cpp/0.8.2/Recipe.sml",
 					"TryOpenReadBinary: C:/Users/Me/.soup/locks/Wren/Soup/Cpp/0.8.2/PackageLock.sml",
 					"TryOpenReadBinary: C:/BuiltIn/Packages/Soup/Wren/0.4.3/Recipe.sml",
+					"TryOpenReadBinary: C:/Users/Me/.soup/FileSystemState.bfs",
 					"TryGetDirectoryFilesLastWriteTime: C:/WorkingDirectory/MyPackage/",
 					"TryGetDirectoryFilesLastWriteTime: C:/Users/Me/.soup/packages/Wren/Soup/Cpp/0.8.2/",
 					"TryGetDirectoryFilesLastWriteTime: C:/BuiltIn/Packages/Soup/Wren/0.4.3/",
@@ -308,6 +310,7 @@ namespace Soup::Core::UnitTests
 					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/J_HqSstV55vlb-x6RWC_hLRFRDU/.soup/Evaluate.bog",
 					"Exists: C:/WorkingDirectory/MyPackage/out/J_HqSstV55vlb-x6RWC_hLRFRDU/temp/",
 					"CreateDirectory: C:/WorkingDirectory/MyPackage/out/J_HqSstV55vlb-x6RWC_hLRFRDU/temp/",
+					"OpenWriteBinary: C:/Users/Me/.soup/FileSystemState.bfs",
 				}),
 				fileSystem->GetRequests(),
 				"Verify file system requests match expected.");
@@ -326,14 +329,10 @@ namespace Soup::Core::UnitTests
 					std::format("CreateMonitorProcess: 1 [C:/Users/Me/.soup/packages/Wren/Soup/Cpp/0.8.2/] C:/testlocation/{0} C:/Users/Me/.soup/packages/Wren/Soup/Cpp/0.8.2/out/tsWW3RZ_9Jb7Xbk2kTzx3n6uQUM/.soup/ Environment [2] 1 0 AllowedRead [7] AllowedWrite [1]", GetGenerateExeName()),
 					"ProcessStart: 1",
 					"WaitForExit: 1",
-					"GetStandardOutput: 1",
-					"GetStandardError: 1",
 					"GetExitCode: 1",
 					std::format("CreateMonitorProcess: 2 [C:/WorkingDirectory/MyPackage/] C:/testlocation/{0} C:/WorkingDirectory/MyPackage/out/J_HqSstV55vlb-x6RWC_hLRFRDU/.soup/ Environment [2] 1 0 AllowedRead [7] AllowedWrite [1]", GetGenerateExeName()),
 					"ProcessStart: 2",
 					"WaitForExit: 2",
-					"GetStandardOutput: 2",
-					"GetStandardError: 2",
 					"GetExitCode: 2",
 				}),
 				monitorProcessManager->GetRequests(),
@@ -1109,6 +1108,7 @@ namespace Soup::Core::UnitTests
 					"DIAG: Load PackageLock: C:/Users/Me/.soup/locks/Wren/Soup/Cpp/0.8.2/PackageLock.sml",
 					"INFO: Package lock loaded",
 					"DIAG: Load Recipe: C:/BuiltIn/Packages/Soup/Wren/0.4.3/Recipe.sml",
+					"INFO: File system state file does not exist",
 					"DIAG: 0>Package was prebuilt: Soup|Wren",
 					"DIAG: 2>Running Build: [Wren]Soup|Cpp",
 					"INFO: 2>Build 'Soup|Cpp'",
@@ -1169,6 +1169,7 @@ namespace Soup::Core::UnitTests
 					"TryOpenReadBinary: C:/Users/Me/.soup/packages/Wren/Soup/Cpp/0.8.2/Recipe.sml",
 					"TryOpenReadBinary: C:/Users/Me/.soup/locks/Wren/Soup/Cpp/0.8.2/PackageLock.sml",
 					"TryOpenReadBinary: C:/BuiltIn/Packages/Soup/Wren/0.4.3/Recipe.sml",
+					"TryOpenReadBinary: C:/Users/Me/.soup/FileSystemState.bfs",
 					"TryGetDirectoryFilesLastWriteTime: C:/WorkingDirectory/MyPackage/",
 					"TryGetDirectoryFilesLastWriteTime: C:/Users/Me/.soup/packages/Wren/Soup/Cpp/0.8.2/",
 					"TryGetDirectoryFilesLastWriteTime: C:/BuiltIn/Packages/Soup/Wren/0.4.3/",
@@ -1197,6 +1198,7 @@ namespace Soup::Core::UnitTests
 					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/J_HqSstV55vlb-x6RWC_hLRFRDU/.soup/GenerateInput.bvt",
 					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/J_HqSstV55vlb-x6RWC_hLRFRDU/.soup/Generate.bor",
 					"Exists: C:/WorkingDirectory/MyPackage/out/J_HqSstV55vlb-x6RWC_hLRFRDU/temp/",
+					"OpenWriteBinary: C:/Users/Me/.soup/FileSystemState.bfs",
 				}),
 				fileSystem->GetRequests(),
 				"Verify file system requests match expected.");
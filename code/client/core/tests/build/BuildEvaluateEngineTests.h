@@ -17,10 +17,10 @@ namespace Soup::Core::UnitTests
 		{
 			auto fileSystemState = FileSystemState();
 			auto uut = BuildEvaluateEngine(
-				false,
-				false,
-				false,
-				fileSystemState);
+				BuildEvaluateOptions(),
+				fileSystemState,
+				nullptr,
+				nullptr);
 		}
 
 		// [[Fact]]
@@ -41,10 +41,10 @@ namespace Soup::Core::UnitTests
 
 			// Setup the input build state
 			auto uut = BuildEvaluateEngine(
-				false,
-				false,
-				false,
-				fileSystemState);
+				BuildEvaluateOptions(),
+				fileSystemState,
+				nullptr,
+				nullptr);
 
 			// Evaluate the build
 			auto operationGraph = OperationGraph();
@@ -53,8 +53,9 @@ namespace Soup::Core::UnitTests
 			auto globalAllowedReadAccess = std::vector<Path>();
 			auto globalAllowedWriteAccess = std::vector<Path>();
 			auto ranOperations = uut.Evaluate(
-				operationGraph,
+				CompactOperationGraph(operationGraph),
 				operationResults,
+				nullptr,
 				temporaryDirectory,
 				globalAllowedReadAccess,
 				globalAllowedWriteAccess);
@@ -121,10 +122,10 @@ namespace Soup::Core::UnitTests
 
 			// Setup the input build state
 			auto uut = BuildEvaluateEngine(
-				false,
-				false,
-				false,
-				fileSystemState);
+				BuildEvaluateOptions(),
+				fileSystemState,
+				nullptr,
+				nullptr);
 
 			// Evaluate the build
 			auto operationGraph = OperationGraph(
@@ -149,8 +150,9 @@ namespace Soup::Core::UnitTests
 			auto globalAllowedReadAccess = std::vector<Path>();
 			auto globalAllowedWriteAccess = std::vector<Path>();
 			auto ranOperations = uut.Evaluate(
-				operationGraph,
+				CompactOperationGraph(operationGraph),
 				operationResults,
+				nullptr,
 				temporaryDirectory,
 				globalAllowedReadAccess,
 				globalAllowedWriteAccess);
@@ -210,8 +212,6 @@ namespace Soup::Core::UnitTests
 					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
 					"ProcessStart: 1",
 					"WaitForExit: 1",
-					"GetStandardOutput: 1",
-					"GetStandardError: 1",
 					"GetExitCode: 1",
 				}),
 				monitorProcessManager->GetRequests(),
@@ -251,10 +251,10 @@ namespace Soup::Core::UnitTests
 
 			// Setup the input build state
 			auto uut = BuildEvaluateEngine(
-				false,
-				false,
-				false,
-				fileSystemState);
+				BuildEvaluateOptions(),
+				fileSystemState,
+				nullptr,
+				nullptr);
 
 			// Evaluate the build
 			auto operationGraph = OperationGraph(
@@ -280,8 +280,9 @@ namespace Soup::Core::UnitTests
 			auto globalAllowedWriteAccess = std::vector<Path>();
 
 			auto ranOperations = uut.Evaluate(
-				operationGraph,
+				CompactOperationGraph(operationGraph),
 				operationResults,
+				nullptr,
 				temporaryDirectory,
 				globalAllowedReadAccess,
 				globalAllowedWriteAccess);
@@ -343,8 +344,6 @@ namespace Soup::Core::UnitTests
 					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
 					"ProcessStart: 1",
 					"WaitForExit: 1",
-					"GetStandardOutput: 1",
-					"GetStandardError: 1",
 					"GetExitCode: 1",
 				}),
 				monitorProcessManager->GetRequests(),
@@ -386,10 +385,10 @@ namespace Soup::Core::UnitTests
 
 			// Setup the input build state
 			auto uut = BuildEvaluateEngine(
-				false,
-				false,
-				false,
-				fileSystemState);
+				BuildEvaluateOptions(),
+				fileSystemState,
+				nullptr,
+				nullptr);
 
 			// Evaluate the build
 			auto operationGraph = OperationGraph(
@@ -415,8 +414,9 @@ namespace Soup::Core::UnitTests
 			auto globalAllowedWriteAccess = std::vector<Path>();
 
 			auto ranOperations = uut.Evaluate(
-				operationGraph,
+				CompactOperationGraph(operationGraph),
 				operationResults,
+				nullptr,
 				temporaryDirectory,
 				globalAllowedReadAccess,
 				globalAllowedWriteAccess);
@@ -478,8 +478,6 @@ namespace Soup::Core::UnitTests
 					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
 					"ProcessStart: 1",
 					"WaitForExit: 1",
-					"GetStandardOutput: 1",
-					"GetStandardError: 1",
 					"GetExitCode: 1",
 				}),
 				monitorProcessManager->GetRequests(),
@@ -521,10 +519,10 @@ namespace Soup::Core::UnitTests
 
 			// Setup the input build state
 			auto uut = BuildEvaluateEngine(
-				false,
-				false,
-				false,
-				fileSystemState);
+				BuildEvaluateOptions(),
+				fileSystemState,
+				nullptr,
+				nullptr);
 
 			// Evaluate the build
 			auto operationGraph = OperationGraph(
@@ -559,8 +557,9 @@ namespace Soup::Core::UnitTests
 			auto globalAllowedReadAccess = std::vector<Path>();
 			auto globalAllowedWriteAccess = std::vector<Path>();
 			auto ranOperations = uut.Evaluate(
-				operationGraph,
+				CompactOperationGraph(operationGraph),
 				operationResults,
+				nullptr,
 				temporaryDirectory,
 				globalAllowedReadAccess,
 				globalAllowedWriteAccess);
@@ -621,8 +620,6 @@ namespace Soup::Core::UnitTests
 					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
 					"ProcessStart: 1",
 					"WaitForExit: 1",
-					"GetStandardOutput: 1",
-					"GetStandardError: 1",
 					"GetExitCode: 1",
 				}),
 				monitorProcessManager->GetRequests(),
@@ -669,10 +666,10 @@ namespace Soup::Core::UnitTests
 
 			// Create the build state
 			auto uut = BuildEvaluateEngine(
-				false,
-				false,
-				false,
-				fileSystemState);
+				BuildEvaluateOptions(),
+				fileSystemState,
+				nullptr,
+				nullptr);
 
 			// Evaluate the build
 			auto operationGraph = OperationGraph(
@@ -706,8 +703,9 @@ namespace Soup::Core::UnitTests
 			auto globalAllowedReadAccess = std::vector<Path>();
 			auto globalAllowedWriteAccess = std::vector<Path>();
 			auto ranOperations = uut.Evaluate(
-				operationGraph,
+				CompactOperationGraph(operationGraph),
 				operationResults,
+				nullptr,
 				temporaryDirectory,
 				globalAllowedReadAccess,
 				globalAllowedWriteAccess);
@@ -766,8 +764,6 @@ namespace Soup::Core::UnitTests
 					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
 					"ProcessStart: 1",
 					"WaitForExit: 1",
-					"GetStandardOutput: 1",
-					"GetStandardError: 1",
 					"GetExitCode: 1",
 				}),
 				monitorProcessManager->GetRequests(),
@@ -816,10 +812,10 @@ namespace Soup::Core::UnitTests
 
 			// Setup the input build state
 			auto uut = BuildEvaluateEngine(
-				false,
-				false,
-				false,
-				fileSystemState);
+				BuildEvaluateOptions(),
+				fileSystemState,
+				nullptr,
+				nullptr);
 
 			// Evaluate the build
 			auto operationGraph = OperationGraph(
@@ -853,8 +849,9 @@ namespace Soup::Core::UnitTests
 			auto globalAllowedReadAccess = std::vector<Path>();
 			auto globalAllowedWriteAccess = std::vector<Path>();
 			auto ranOperations = uut.Evaluate(
-				operationGraph,
+				CompactOperationGraph(operationGraph),
 				operationResults,
+				nullptr,
 				temporaryDirectory,
 				globalAllowedReadAccess,
 				globalAllowedWriteAccess);
@@ -913,8 +910,6 @@ namespace Soup::Core::UnitTests
 					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
 					"ProcessStart: 1",
 					"WaitForExit: 1",
-					"GetStandardOutput: 1",
-					"GetStandardError: 1",
 					"GetExitCode: 1",
 				}),
 				monitorProcessManager->GetRequests(),
@@ -963,10 +958,10 @@ namespace Soup::Core::UnitTests
 
 			// Setup the input build state
 			auto uut = BuildEvaluateEngine(
-				false,
-				false,
-				false,
-				fileSystemState);
+				BuildEvaluateOptions(),
+				fileSystemState,
+				nullptr,
+				nullptr);
 
 			// Evaluate the build
 			auto operationGraph = OperationGraph(
@@ -1000,8 +995,9 @@ namespace Soup::Core::UnitTests
 			auto globalAllowedReadAccess = std::vector<Path>();
 			auto globalAllowedWriteAccess = std::vector<Path>();
 			auto ranOperations = uut.Evaluate(
-				operationGraph,
+				CompactOperationGraph(operationGraph),
 				operationResults,
+				nullptr,
 				temporaryDirectory,
 				globalAllowedReadAccess,
 				globalAllowedWriteAccess);
@@ -1061,8 +1057,6 @@ namespace Soup::Core::UnitTests
 					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
 					"ProcessStart: 1",
 					"WaitForExit: 1",
-					"GetStandardOutput: 1",
-					"GetStandardError: 1",
 					"GetExitCode: 1",
 				}),
 				monitorProcessManager->GetRequests(),
@@ -1107,10 +1101,10 @@ namespace Soup::Core::UnitTests
 
 			// Create the initial build state
 			auto uut = BuildEvaluateEngine(
-				false,
-				false,
-				false,
-				fileSystemState);
+				BuildEvaluateOptions(),
+				fileSystemState,
+				nullptr,
+				nullptr);
 
 			// Evaluate the build
 			auto operationGraph = OperationGraph(
@@ -1144,8 +1138,9 @@ namespace Soup::Core::UnitTests
 			auto globalAllowedReadAccess = std::vector<Path>();
 			auto globalAllowedWriteAccess = std::vector<Path>();
 			auto ranOperations = uut.Evaluate(
-				operationGraph,
+				CompactOperationGraph(operationGraph),
 				operationResults,
+				nullptr,
 				temporaryDirectory,
 				globalAllowedReadAccess,
 				globalAllowedWriteAccess);
@@ -1188,6 +1183,688 @@ namespace Soup::Core::UnitTests
 				"Verify file system requests match expected.");
 		}
 
+		// [[Fact]]
+		void Execute_TwoOperations_MultipleJobs_RunsChildAfterParent()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState();
+
+			// Register the test process manager
+			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
+			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
+
+			// Setup the input build state
+			auto options = BuildEvaluateOptions();
+			options.MaxJobs = 4;
+			auto uut = BuildEvaluateEngine(
+				options,
+				fileSystemState,
+				nullptr,
+				nullptr);
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph(
+				{ 1, },
+				{
+					OperationInfo(
+						1,
+						"TestCommand: 1",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command1.exe"),
+							{ "Arguments" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ 2 },
+						1),
+					OperationInfo(
+						2,
+						"TestCommand: 2",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command2.exe"),
+							{ "Arguments" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ },
+						1),
+				});
+			auto operationResults = OperationResults();
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+			auto ranOperations = uut.Evaluate(
+				CompactOperationGraph(operationGraph),
+				operationResults,
+				nullptr,
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess);
+
+			Assert::IsTrue(ranOperations, "Verify ran operations");
+
+			// Verify operation results
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>(
+				{
+					{
+						1,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ },
+							{ })
+					},
+					{
+						2,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ },
+							{ })
+					},
+				}),
+				operationResults.GetResults(),
+				"Verify operation results match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build evaluation start",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Operation has no successful previous invocation",
+					"HIGH: TestCommand: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command1.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Operation has no successful previous invocation",
+					"HIGH: TestCommand: 2",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command2.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"DIAG: Build evaluation end",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify expected system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"GetCurrentTime",
+					"GetCurrentTime",
+				}),
+				system->GetRequests(),
+				"Verify system requests match expected.");
+
+			// Verify expected process requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"ProcessStart: 1",
+					"WaitForExit: 1",
+					"GetExitCode: 1",
+					"CreateMonitorProcess: 2 [C:/TestWorkingDirectory/] ./Command2.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"ProcessStart: 2",
+					"WaitForExit: 2",
+					"GetExitCode: 2",
+				}),
+				monitorProcessManager->GetRequests(),
+				"Verify monitor process manager requests match expected.");
+		}
+
+		// [[Fact]]
+		void Execute_TwoOperations_RunsLongestCriticalPathFirst()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState();
+
+			// Register the test process manager
+			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
+			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
+
+			// Setup the input build state
+			auto uut = BuildEvaluateEngine(
+				BuildEvaluateOptions(),
+				fileSystemState,
+				nullptr,
+				nullptr);
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph(
+				{ 1, 2, },
+				{
+					OperationInfo(
+						1,
+						"TestCommand: 1",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command1.exe"),
+							{ "Arguments" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ },
+						1),
+					OperationInfo(
+						2,
+						"TestCommand: 2",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command2.exe"),
+							{ "Arguments" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ },
+						1),
+				});
+
+			// The second operation took longer the last time it was run
+			auto operationResults = OperationResults({
+				{
+					1,
+					OperationResult(
+						false,
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::time_point<std::chrono::system_clock>()),
+						{ },
+						{ },
+						{ },
+						std::chrono::microseconds(1000),
+						0)
+				},
+				{
+					2,
+					OperationResult(
+						false,
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::time_point<std::chrono::system_clock>()),
+						{ },
+						{ },
+						{ },
+						std::chrono::microseconds(10000),
+						0)
+				},
+			});
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+			auto ranOperations = uut.Evaluate(
+				CompactOperationGraph(operationGraph),
+				operationResults,
+				nullptr,
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess);
+
+			Assert::IsTrue(ranOperations, "Verify ran operations");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build evaluation start",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Operation has no successful previous invocation",
+					"HIGH: TestCommand: 2",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command2.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Operation has no successful previous invocation",
+					"HIGH: TestCommand: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command1.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"DIAG: Build evaluation end",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify expected process requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command2.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"ProcessStart: 1",
+					"WaitForExit: 1",
+					"GetExitCode: 1",
+					"CreateMonitorProcess: 2 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"ProcessStart: 2",
+					"WaitForExit: 2",
+					"GetExitCode: 2",
+				}),
+				monitorProcessManager->GetRequests(),
+				"Verify monitor process manager requests match expected.");
+		}
+
+		// [[Fact]]
+		void Execute_OneOperation_WriteFile_KeepsPreviousRunStatistics()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState();
+
+			// Register the test process manager
+			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
+			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
+
+			// Setup the input build state
+			auto uut = BuildEvaluateEngine(
+				BuildEvaluateOptions(),
+				fileSystemState,
+				nullptr,
+				nullptr);
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph(
+				{ 1, },
+				{
+					OperationInfo(
+						1,
+						"WriteFile: 1",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./writefile.exe"),
+							{ "./OutputFile.out", "Content" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ },
+						1),
+				});
+
+			// The statistics from the last run are used to schedule future builds
+			auto operationResults = OperationResults({
+				{
+					1,
+					OperationResult(
+						false,
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::time_point<std::chrono::system_clock>()),
+						{ },
+						{ },
+						{ },
+						std::chrono::microseconds(1000),
+						2048)
+				},
+			});
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+			auto ranOperations = uut.Evaluate(
+				CompactOperationGraph(operationGraph),
+				operationResults,
+				nullptr,
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess);
+
+			Assert::IsTrue(ranOperations, "Verify ran operations");
+
+			// Verify operation results
+			auto outputFile = fileSystemState.ToFileId(Path("C:/TestWorkingDirectory/OutputFile.out"));
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>(
+				{
+					{
+						1,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ },
+							{ outputFile, },
+							{ },
+							std::chrono::microseconds(1000),
+							2048)
+					},
+				}),
+				operationResults.GetResults(),
+				"Verify operation results match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build evaluation start",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Operation has no successful previous invocation",
+					"HIGH: WriteFile: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./writefile.exe ./OutputFile.out Content",
+					"INFO: Execute InProcess WriteFile",
+					"INFO: WritFile: ./OutputFile.out",
+					"DIAG: Build evaluation end",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify no process was run
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				monitorProcessManager->GetRequests(),
+				"Verify monitor process manager requests match expected.");
+		}
+
+		// [[Fact]]
+		void Execute_TwoOperations_ResourcePool_WaitsForActiveOperation()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState();
+
+			// Register the test process manager
+			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
+			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
+
+			// Setup the input build state with a single link operation allowed at a time
+			auto options = BuildEvaluateOptions();
+			options.MaxJobs = 4;
+			options.ResourcePoolLimits = std::map<std::string, uint32_t>({
+				{ "Link", 1 },
+			});
+			auto uut = BuildEvaluateEngine(
+				options,
+				fileSystemState,
+				nullptr,
+				nullptr);
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph(
+				{ 1, 2, },
+				{
+					OperationInfo(
+						1,
+						"TestCommand: 1",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command1.exe"),
+							{ "Arguments" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ },
+						1,
+						"Link",
+						1),
+					OperationInfo(
+						2,
+						"TestCommand: 2",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command2.exe"),
+							{ "Arguments" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ },
+						1,
+						"Link",
+						1),
+				});
+			auto operationResults = OperationResults();
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+			auto ranOperations = uut.Evaluate(
+				CompactOperationGraph(operationGraph),
+				operationResults,
+				nullptr,
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess);
+
+			Assert::IsTrue(ranOperations, "Verify ran operations");
+
+			// Verify expected logs
+			// Note: The resources are reserved when a worker takes the first operation, the second operation is only
+			// held back by the owner when that happens before it is checked, otherwise it waits in the worker pool
+			auto messages = testListener->GetMessages();
+			std::erase(messages, std::string("DIAG: Waiting for resources"));
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build evaluation start",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Operation has no successful previous invocation",
+					"HIGH: TestCommand: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command1.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Operation has no successful previous invocation",
+					"HIGH: TestCommand: 2",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command2.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"DIAG: Build evaluation end",
+				}),
+				messages,
+				"Verify log messages match expected.");
+
+			// Verify the second operation is only started once the first has exited
+			auto requests = monitorProcessManager->GetRequests();
+			auto firstExit = std::find(requests.begin(), requests.end(), "WaitForExit: 1");
+			auto secondStart = std::find(requests.begin(), requests.end(), "ProcessStart: 2");
+			Assert::IsTrue(
+				secondStart != requests.end() && firstExit < secondStart,
+				"Verify the second operation started after the first exited.");
+
+			// The second process may be created before the first is started
+			std::sort(requests.begin(), requests.end());
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"CreateMonitorProcess: 2 [C:/TestWorkingDirectory/] ./Command2.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"GetExitCode: 1",
+					"GetExitCode: 2",
+					"ProcessStart: 1",
+					"ProcessStart: 2",
+					"WaitForExit: 1",
+					"WaitForExit: 2",
+				}),
+				requests,
+				"Verify monitor process manager requests match expected.");
+		}
+
+		// [[Fact]]
+		void Execute_TwoOperations_MemoryBudget_UnmeasuredOperation_WaitsForActiveOperation()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState();
+
+			// Register the test process manager
+			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
+			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
+
+			// Setup the input build state with a memory budget that is shared by four jobs
+			auto options = BuildEvaluateOptions();
+			options.MaxJobs = 4;
+			options.MemoryBudget = 1000;
+			auto uut = BuildEvaluateEngine(
+				options,
+				fileSystemState,
+				nullptr,
+				nullptr);
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph(
+				{ 1, 2, },
+				{
+					OperationInfo(
+						1,
+						"TestCommand: 1",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command1.exe"),
+							{ "Arguments" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ },
+						1),
+					OperationInfo(
+						2,
+						"TestCommand: 2",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command2.exe"),
+							{ "Arguments" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ },
+						1),
+				});
+
+			// The second operation has no memory measurement and is assumed to use a share of the budget for one job
+			auto operationResults = OperationResults({
+				{
+					1,
+					OperationResult(
+						false,
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::time_point<std::chrono::system_clock>()),
+						{ },
+						{ },
+						{ },
+						std::chrono::microseconds(10000),
+						900)
+				},
+				{
+					2,
+					OperationResult(
+						false,
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::time_point<std::chrono::system_clock>()),
+						{ },
+						{ },
+						{ },
+						std::chrono::microseconds(1000),
+						0)
+				},
+			});
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+			auto ranOperations = uut.Evaluate(
+				CompactOperationGraph(operationGraph),
+				operationResults,
+				nullptr,
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess);
+
+			Assert::IsTrue(ranOperations, "Verify ran operations");
+
+			// Verify expected logs
+			// Note: The resources are reserved when a worker takes the first operation, the second operation is only
+			// held back by the owner when that happens before it is checked, otherwise it waits in the worker pool
+			auto messages = testListener->GetMessages();
+			std::erase(messages, std::string("DIAG: Waiting for resources"));
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build evaluation start",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Operation has no successful previous invocation",
+					"HIGH: TestCommand: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command1.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Operation has no successful previous invocation",
+					"HIGH: TestCommand: 2",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command2.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"DIAG: Build evaluation end",
+				}),
+				messages,
+				"Verify log messages match expected.");
+
+			// Verify the second operation is only started once the first has exited
+			auto requests = monitorProcessManager->GetRequests();
+			auto firstExit = std::find(requests.begin(), requests.end(), "WaitForExit: 1");
+			auto secondStart = std::find(requests.begin(), requests.end(), "ProcessStart: 2");
+			Assert::IsTrue(
+				secondStart != requests.end() && firstExit < secondStart,
+				"Verify the second operation started after the first exited.");
+
+			// The second process may be created before the first is started
+			std::sort(requests.begin(), requests.end());
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"CreateMonitorProcess: 2 [C:/TestWorkingDirectory/] ./Command2.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"GetExitCode: 1",
+					"GetExitCode: 2",
+					"ProcessStart: 1",
+					"ProcessStart: 2",
+					"WaitForExit: 1",
+					"WaitForExit: 2",
+				}),
+				requests,
+				"Verify monitor process manager requests match expected.");
+		}
+
 		// [[Fact]]
 		void Execute_TwoOperations_DuplicateOutputFile_Fails()
 		{
@@ -1221,10 +1898,10 @@ namespace Soup::Core::UnitTests
 
 			// Setup the input build state
 			auto uut = BuildEvaluateEngine(
-				false,
-				false,
-				false,
-				fileSystemState);
+				BuildEvaluateOptions(),
+				fileSystemState,
+				nullptr,
+				nullptr);
 
 			// Evaluate the build
 			auto operationGraph = OperationGraph(
@@ -1265,8 +1942,9 @@ namespace Soup::Core::UnitTests
 			auto exception = Assert::Throws<std::runtime_error>([&]()
 			{
 				auto ranOperations = uut.Evaluate(
-					operationGraph,
+					CompactOperationGraph(operationGraph),
 					operationResults,
+					nullptr,
 					temporaryDirectory,
 					globalAllowedReadAccess,
 					globalAllowedWriteAccess);
@@ -1318,8 +1996,6 @@ namespace Soup::Core::UnitTests
 					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
 					"ProcessStart: 1",
 					"WaitForExit: 1",
-					"GetStandardOutput: 1",
-					"GetStandardError: 1",
 					"GetExitCode: 1",
 				}),
 				monitorProcessManager->GetRequests(),
@@ -1359,10 +2035,10 @@ namespace Soup::Core::UnitTests
 
 			// Setup the input build state
 			auto uut = BuildEvaluateEngine(
-				false,
-				false,
-				false,
-				fileSystemState);
+				BuildEvaluateOptions(),
+				fileSystemState,
+				nullptr,
+				nullptr);
 
 			// Evaluate the build
 			auto operationGraph = OperationGraph(
@@ -1403,8 +2079,9 @@ namespace Soup::Core::UnitTests
 			auto exception = Assert::Throws<std::runtime_error>([&]()
 			{
 				auto ranOperations = uut.Evaluate(
-					operationGraph,
+					CompactOperationGraph(operationGraph),
 					operationResults,
+					nullptr,
 					temporaryDirectory,
 					globalAllowedReadAccess,
 					globalAllowedWriteAccess);
@@ -1456,8 +2133,6 @@ namespace Soup::Core::UnitTests
 					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
 					"ProcessStart: 1",
 					"WaitForExit: 1",
-					"GetStandardOutput: 1",
-					"GetStandardError: 1",
 					"GetExitCode: 1",
 				}),
 				monitorProcessManager->GetRequests(),
@@ -1497,10 +2172,10 @@ namespace Soup::Core::UnitTests
 
 			// Setup the input build state
 			auto uut = BuildEvaluateEngine(
-				false,
-				false,
-				false,
-				fileSystemState);
+				BuildEvaluateOptions(),
+				fileSystemState,
+				nullptr,
+				nullptr);
 
 			// Evaluate the build
 			auto operationGraph = OperationGraph(
@@ -1541,8 +2216,9 @@ namespace Soup::Core::UnitTests
 			auto exception = Assert::Throws<std::runtime_error>([&]()
 			{
 				auto ranOperations = uut.Evaluate(
-					operationGraph,
+					CompactOperationGraph(operationGraph),
 					operationResults,
+					nullptr,
 					temporaryDirectory,
 					globalAllowedReadAccess,
 					globalAllowedWriteAccess);
@@ -1595,8 +2271,6 @@ namespace Soup::Core::UnitTests
 					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
 					"ProcessStart: 1",
 					"WaitForExit: 1",
-					"GetStandardOutput: 1",
-					"GetStandardError: 1",
 					"GetExitCode: 1",
 				}),
 				monitorProcessManager->GetRequests(),
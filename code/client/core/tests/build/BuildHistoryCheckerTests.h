@@ -407,5 +407,143 @@ namespace Soup::Core::UnitTests
 				testListener->GetMessages(),
 				"Verify log messages match expected.");
 		}
+
+		// [[Fact]]
+		void IsOutdated_ContentHash_InputAltered_ContentUnchanged()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Input.cpp"),
+				std::make_shared<MockFile>(std::stringstream("abc")));
+
+			// Create the file state
+			auto outputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 12min);
+			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 13min);
+
+			// Initialize the file system state
+			auto fileSystemState = FileSystemState(
+				3,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/Root/Output.bin") },
+					{ 2, Path("C:/Root/Input.cpp") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 1, outputTime },
+					{ 2, inputTime },
+				}));
+
+			// Setup the input parameters, the input content was "abc" during the last run
+			auto targetFiles = std::vector<FileId>({
+				1,
+			});
+			auto inputFiles = std::vector<FileId>({
+				2,
+			});
+			auto inputFileHashes = std::vector<uint64_t>({
+				0x44BC2CF5AD770999,
+			});
+
+			// Perform the check
+			auto uut = BuildHistoryChecker(fileSystemState);
+			bool result = uut.IsOutdated(targetFiles, inputFiles, inputFileHashes);
+
+			// Verify the results
+			Assert::IsFalse(result, "Verify the result is false.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"TryOpenReadBinary: C:/Root/Input.cpp",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Input altered after target with unchanged content [C:/Root/Input.cpp]",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+		}
+
+		// [[Fact]]
+		void IsOutdated_ContentHash_InputAltered_ContentChanged()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Input.cpp"),
+				std::make_shared<MockFile>(std::stringstream("abcd")));
+
+			// Create the file state
+			auto outputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 12min);
+			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 13min);
+
+			// Initialize the file system state
+			auto fileSystemState = FileSystemState(
+				3,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/Root/Output.bin") },
+					{ 2, Path("C:/Root/Input.cpp") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 1, outputTime },
+					{ 2, inputTime },
+				}));
+
+			// Setup the input parameters, the input content was "abc" during the last run
+			auto targetFiles = std::vector<FileId>({
+				1,
+			});
+			auto inputFiles = std::vector<FileId>({
+				2,
+			});
+			auto inputFileHashes = std::vector<uint64_t>({
+				0x44BC2CF5AD770999,
+			});
+
+			// Perform the check
+			auto uut = BuildHistoryChecker(fileSystemState);
+			bool result = uut.IsOutdated(targetFiles, inputFiles, inputFileHashes);
+
+			// Verify the results
+			Assert::IsTrue(result, "Verify the result is true.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"TryOpenReadBinary: C:/Root/Input.cpp",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"INFO: Input content altered after target [C:/Root/Input.cpp]",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+		}
 	};
 }
@@ -4,6 +4,7 @@
 
 #pragma once
 #include "MockEvaluateEngine.h"
+#include "MockGenerateEngine.h"
 
 namespace Soup::Core::UnitTests
 {
@@ -22,6 +23,7 @@ namespace Soup::Core::UnitTests
 			auto fileSystemState = FileSystemState();
 			auto knownLanguages = std::map<std::string, KnownLanguage>();
 			auto locationManager = RecipeBuildLocationManager(knownLanguages);
+			auto stateLock = BuildStateLock();
 			auto uut = BuildRunner(
 				arguments,
 				userDataPath,
@@ -30,7 +32,8 @@ namespace Soup::Core::UnitTests
 				packageProvider,
 				evaluateEngine,
 				fileSystemState,
-				locationManager);
+				locationManager,
+				stateLock);
 		}
 
 		// [[Fact]]
@@ -120,6 +123,7 @@ namespace Soup::Core::UnitTests
 			auto evaluateEngine = MockEvaluateEngine();
 			auto knownLanguages = std::map<std::string, KnownLanguage>();
 			auto locationManager = RecipeBuildLocationManager(knownLanguages);
+			auto stateLock = BuildStateLock();
 			auto uut = BuildRunner(
 				arguments,
 				userDataPath,
@@ -128,7 +132,8 @@ namespace Soup::Core::UnitTests
 				packageProvider,
 				evaluateEngine,
 				fileSystemState,
-				locationManager);
+				locationManager,
+				stateLock);
 			uut.Execute();
 
 			// Verify expected logs
@@ -154,7 +159,6 @@ namespace Soup::Core::UnitTests
 					"INFO: 1>Loading new Evaluate Operation Graph",
 					"DIAG: 1>Map previous operation graph observed results",
 					"INFO: 1>Create Directory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
-					"INFO: 1>Saving updated build state",
 					"INFO: 1>Done",
 				}),
 				testListener->GetMessages(),
@@ -168,6 +172,7 @@ namespace Soup::Core::UnitTests
 					"TryGetDirectoryFilesLastWriteTime: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/",
 					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
 					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
+					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.brj",
 					"Exists: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
 					"CreateDirectory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
 					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt",
@@ -177,6 +182,7 @@ namespace Soup::Core::UnitTests
 					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
 					"Exists: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"CreateDirectory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.brj",
 					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
 				}),
 				fileSystem->GetRequests(),
@@ -301,51 +307,42 @@ namespace Soup::Core::UnitTests
 		}
 
 		// [[Fact]]
-		void Execute_BuildDependency()
+		void Execute_InProcessGenerate()
 		{
 			// Register the test listener
 			auto testListener = std::make_shared<TestTraceListener>();
 			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
 
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
 			// Register the test file system
 			auto fileSystem = std::make_shared<MockFileSystem>();
 			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
 			auto fileSystemState = FileSystemState(
 				0,
-				{},
+				std::unordered_map<FileId, Path>({
+				}),
 				TestHelpers::BuildDirectoryLookup({
-					Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/Recipe.sml"),
 					Path("C:/WorkingDirectory/MyPackage/Recipe.sml"),
 				}),
-				{});
-
-			fileSystem->CreateMockDirectory(
-				Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/"),
-				std::make_shared<MockDirectory>(std::vector<Path>({})));
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+				}));
 
 			fileSystem->CreateMockDirectory(
 				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/"),
 				std::make_shared<MockDirectory>(std::vector<Path>({})));
 
-			auto myProjectOperationGraph = OperationGraph(
+			auto operationGraph = OperationGraph(
 				std::vector<OperationId>(),
 				std::vector<OperationInfo>());
-			auto myProjectOperationGraphFiles = std::set<FileId>();
-			auto myProjectOperationGraphContent = std::stringstream();
-			OperationGraphWriter::Serialize(myProjectOperationGraph, myProjectOperationGraphFiles, fileSystemState, myProjectOperationGraphContent);
+			auto operationGraphFiles = std::set<FileId>();
+			auto operationGraphContent = std::stringstream();
+			OperationGraphWriter::Serialize(operationGraph, operationGraphFiles, fileSystemState, operationGraphContent);
 			fileSystem->CreateMockFile(
 				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog"),
-				std::make_shared<MockFile>(std::move(myProjectOperationGraphContent)));
-
-			auto testBuildOperationGraph = OperationGraph(
-				std::vector<OperationId>(),
-				std::vector<OperationInfo>());
-			auto testBuildOperationGraphFiles = std::set<FileId>();
-			auto testBuildOperationGraphContent = std::stringstream();
-			OperationGraphWriter::Serialize(testBuildOperationGraph, testBuildOperationGraphFiles, fileSystemState,  testBuildOperationGraphContent);
-			fileSystem->CreateMockFile(
-				Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bog"),
-				std::make_shared<MockFile>(std::move(testBuildOperationGraphContent)));
+				std::make_shared<MockFile>(std::move(operationGraphContent)));
 
 			// Register the test process manager
 			auto processManager = std::make_shared<MockProcessManager>();
@@ -365,23 +362,6 @@ namespace Soup::Core::UnitTests
 					{
 						{ "Name", "MyPackage" },
 						{ "Language", "C++|1" },
-						{ "Version", "1.0.0" },
-						{
-							"Dependencies",
-							RecipeTable(
-							{
-								{ "Build", RecipeList({ "User1|TestBuild@1.2.3" }) },
-							})
-						},
-					}))
-				},
-				{
-					"C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/Recipe.sml",
-					Recipe(RecipeTable(
-					{
-						{ "Name", "TestBuild" },
-						{ "Language", "C#|1" },
-						{ "Version", "1.2.3" },
 					}))
 				},
 			});
@@ -399,16 +379,6 @@ namespace Soup::Core::UnitTests
 								{ "ArgumentValue", Value(true) },
 							}))
 					},
-					{
-						2,
-						PackageGraph(
-							2,
-							2,
-							ValueTable(
-							{
-								{ "HostValue", Value(true) },
-							}))
-					},
 				}),
 				PackageLookupMap(
 				{
@@ -421,34 +391,14 @@ namespace Soup::Core::UnitTests
 							Path("C:/WorkingDirectory/MyPackage/"),
 							Path(),
 							&recipeCache.GetRecipe(Path("C:/WorkingDirectory/MyPackage/Recipe.sml")),
-							PackageChildrenMap({
-								{
-									"Build",
-									{
-										PackageChildInfo(
-											PackageReference(std::nullopt, "User1", "TestBuild", SemanticVersion(1, 2, 3)),
-											true,
-											-1,
-											2),
-									}
-								},
-							}))
-					},
-					{
-						2,
-						PackageInfo(
-							2,
-							PackageName("User1", "TestBuild"),
-							false,
-							Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/"),
-							Path(),
-							&recipeCache.GetRecipe(Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/Recipe.sml")),
 							PackageChildrenMap())
 					},
 				}));
 			auto evaluateEngine = MockEvaluateEngine();
+			auto generateEngine = MockGenerateEngine();
 			auto knownLanguages = std::map<std::string, KnownLanguage>();
 			auto locationManager = RecipeBuildLocationManager(knownLanguages);
+			auto stateLock = BuildStateLock();
 			auto uut = BuildRunner(
 				arguments,
 				userDataPath,
@@ -456,35 +406,15 @@ namespace Soup::Core::UnitTests
 				recipeCache,
 				packageProvider,
 				evaluateEngine,
+				&generateEngine,
 				fileSystemState,
-				locationManager);
+				locationManager,
+				stateLock);
 			uut.Execute();
 
 			// Verify expected logs
 			Assert::AreEqual(
 				std::vector<std::string>({
-					"DIAG: 2>Running Build: [C#]User1|TestBuild",
-					"INFO: 2>Build 'User1|TestBuild'",
-					"INFO: 2>Checking for existing Evaluate Operation Graph",
-					"DIAG: 2>C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bog",
-					"INFO: 2>Previous graph found",
-					"INFO: 2>Checking for existing Evaluate Operation Results",
-					"DIAG: 2>C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bor",
-					"INFO: 2>Operation results file does not exist",
-					"INFO: 2>No previous results found",
-					"INFO: 2>Create Directory: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/",
-					"INFO: 2>Check outdated generate input file: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/GenerateInput.bvt",
-					"INFO: 2>Value Table file does not exist",
-					"INFO: 2>Save Generate Input file",
-					"INFO: 2>Checking for existing Generate Operation Results",
-					"DIAG: 2>C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Generate.bor",
-					"INFO: 2>Operation results file does not exist",
-					"INFO: 2>No previous results found",
-					"INFO: 2>Loading new Evaluate Operation Graph",
-					"DIAG: 2>Map previous operation graph observed results",
-					"INFO: 2>Create Directory: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
-					"INFO: 2>Saving updated build state",
-					"INFO: 2>Done",
 					"DIAG: 1>Running Build: [C++]MyPackage",
 					"INFO: 1>Build 'MyPackage'",
 					"INFO: 1>Checking for existing Evaluate Operation Graph",
@@ -502,10 +432,12 @@ namespace Soup::Core::UnitTests
 					"DIAG: 1>C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor",
 					"INFO: 1>Operation results file does not exist",
 					"INFO: 1>No previous results found",
+					"INFO: 1>Operation has no successful previous invocation",
+					"HIGH: 1>Generate: [C++]MyPackage",
+					"DIAG: 1>Execute InProcess Generate: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
 					"INFO: 1>Loading new Evaluate Operation Graph",
 					"DIAG: 1>Map previous operation graph observed results",
 					"INFO: 1>Create Directory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
-					"INFO: 1>Saving updated build state",
 					"INFO: 1>Done",
 				}),
 				testListener->GetMessages(),
@@ -514,31 +446,12 @@ namespace Soup::Core::UnitTests
 			// Verify expected file system requests
 			Assert::AreEqual(
 				std::vector<std::string>({
-					"Exists: C:/Users/Me/.soup/packages/C#/TestBuild/RootRecipe.sml",
-					"Exists: C:/Users/Me/.soup/packages/C#/RootRecipe.sml",
-					"Exists: C:/Users/Me/.soup/packages/RootRecipe.sml",
-					"Exists: C:/Users/Me/.soup/RootRecipe.sml",
-					"Exists: C:/Users/Me/RootRecipe.sml",
-					"Exists: C:/Users/RootRecipe.sml",
-					"Exists: C:/RootRecipe.sml",
-					"TryGetDirectoryFilesLastWriteTime: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bog",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bor",
-					"Exists: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/",
-					"CreateDirectory: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/GenerateInput.bvt",
-					"OpenWriteBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/GenerateInput.bvt",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Generate.bor",
-					"OpenWriteBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Generate.bor",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bog",
-					"Exists: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
-					"CreateDirectory: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
-					"OpenWriteBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bor",
 					"Exists: C:/WorkingDirectory/RootRecipe.sml",
 					"Exists: C:/RootRecipe.sml",
 					"TryGetDirectoryFilesLastWriteTime: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/",
 					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
 					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
+					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.brj",
 					"Exists: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
 					"CreateDirectory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
 					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt",
@@ -548,6 +461,7 @@ namespace Soup::Core::UnitTests
 					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
 					"Exists: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"CreateDirectory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.brj",
 					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
 				}),
 				fileSystem->GetRequests(),
@@ -557,25 +471,36 @@ namespace Soup::Core::UnitTests
 			Assert::AreEqual(
 				std::vector<std::string>({
 					"GetCurrentProcessFileName",
-					"GetCurrentProcessFileName",
 				}),
 				processManager->GetRequests(),
 				"Verify process manager requests match expected.");
 
-			// Verify expected evaluate requests
+			// Verify expected system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"GetCurrentTime",
+				}),
+				system->GetRequests(),
+				"Verify system requests match expected.");
+
+			// Verify the generate phase is run in-process and only the evaluate phase uses the evaluate engine
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"Generate: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
+				}),
+				generateEngine.GetRequests(),
+				"Verify generate requests match expected.");
+
 			Assert::AreEqual(
 				std::vector<std::string>({
-					"Evaluate: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
-					"Evaluate: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
-					"Evaluate: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"Evaluate: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 				}),
 				evaluateEngine.GetRequests(),
 				"Verify evaluate requests match expected.");
 
 			// Verify files
-			auto testBuildGenerateInputMockFile = fileSystem->GetMockFile(
-				Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/GenerateInput.bvt"));
+			auto myPackageGenerateInputMockFile = fileSystem->GetMockFile(
+				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt"));
 			Assert::AreEqual(
 				ValueTable(
 				{
@@ -587,23 +512,23 @@ namespace Soup::Core::UnitTests
 						"EvaluateMacros",
 						ValueTable(
 						{
-							{ "/(PACKAGE_User1|TestBuild)/", std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/") },
-							{ "/(TARGET_User1|TestBuild)/", std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/") },
+							{ "/(PACKAGE_MyPackage)/", std::string("C:/WorkingDirectory/MyPackage/") },
+							{ "/(TARGET_MyPackage)/", std::string("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
 						})
 					},
 					{
 						"EvaluateReadAccess",
 						ValueList(
 						{
-							std::string("/(PACKAGE_User1|TestBuild)/"),
-							std::string("/(TARGET_User1|TestBuild)/"),
+							std::string("/(PACKAGE_MyPackage)/"),
+							std::string("/(TARGET_MyPackage)/"),
 						})
 					},
 					{
 						"EvaluateWriteAccess",
 						ValueList(
 						{
-							std::string("/(TARGET_User1|TestBuild)/"),
+							std::string("/(TARGET_MyPackage)/"),
 						})
 					},
 					{
@@ -623,8 +548,8 @@ namespace Soup::Core::UnitTests
 								ValueTable(
 								{
 									{ "HostPlatform", std::string("TestPlatform") },
-									{ "PackageDirectory", std::string("/(PACKAGE_User1|TestBuild)/") },
-									{ "TargetDirectory", std::string("/(TARGET_User1|TestBuild)/") },
+									{ "PackageDirectory", std::string("/(PACKAGE_MyPackage)/") },
+									{ "TargetDirectory", std::string("/(TARGET_MyPackage)/") },
 								})
 							},
 							{ "Dependencies", ValueTable() },
@@ -638,26 +563,26 @@ namespace Soup::Core::UnitTests
 								"Parameters",
 								ValueTable(
 								{
-									{ "HostValue", true },
+									{ "ArgumentValue", true },
 								})
 							},
 						})
 					},
 					{
 						"PackageRoot",
-						std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/")
+						std::string("C:/WorkingDirectory/MyPackage/")
 					},
 					{
 						"UserDataPath",
 						std::string("C:/Users/Me/.soup/")
 					},
 				}),
-				ValueTableReader::Deserialize(testBuildGenerateInputMockFile->Content),
+				ValueTableReader::Deserialize(myPackageGenerateInputMockFile->Content),
 				"Verify file content match expected.");
 
-			auto testBuildGenerateResultsMockFile = fileSystem->GetMockFile(
-				Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Generate.bor"));
-			auto testBuildGenerateResults = OperationResultsReader::Deserialize(testBuildGenerateResultsMockFile->Content, fileSystemState);
+			auto myPackageGenerateResultsMockFile = fileSystem->GetMockFile(
+				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor"));
+			auto myPackageGenerateResults = OperationResultsReader::Deserialize(myPackageGenerateResultsMockFile->Content, fileSystemState);
 
 			Assert::AreEqual(
 				OperationResults({
@@ -666,270 +591,96 @@ namespace Soup::Core::UnitTests
 						OperationResult(
 							true,
 							GetEpochTime(),
-							{},
-							{})
+							{ 1, },
+							{ 2, })
 					},
 				}),
-				testBuildGenerateResults,
-				"Verify test build generate results content match expected.");
+				myPackageGenerateResults,
+				"Verify generate results content match expected.");
+		}
 
-			auto myPackageGenerateInputMockFile = fileSystem->GetMockFile(
-				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt"));
-			Assert::AreEqual(
-				ValueTable(
+		// [[Fact]]
+		void Execute_BuildDependency()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState(
+				0,
+				{},
+				TestHelpers::BuildDirectoryLookup({
+					Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/Recipe.sml"),
+					Path("C:/WorkingDirectory/MyPackage/Recipe.sml"),
+				}),
+				{});
+
+			fileSystem->CreateMockDirectory(
+				Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/"),
+				std::make_shared<MockDirectory>(std::vector<Path>({})));
+
+			fileSystem->CreateMockDirectory(
+				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/"),
+				std::make_shared<MockDirectory>(std::vector<Path>({})));
+
+			auto myProjectOperationGraph = OperationGraph(
+				std::vector<OperationId>(),
+				std::vector<OperationInfo>());
+			auto myProjectOperationGraphFiles = std::set<FileId>();
+			auto myProjectOperationGraphContent = std::stringstream();
+			OperationGraphWriter::Serialize(myProjectOperationGraph, myProjectOperationGraphFiles, fileSystemState, myProjectOperationGraphContent);
+			fileSystem->CreateMockFile(
+				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog"),
+				std::make_shared<MockFile>(std::move(myProjectOperationGraphContent)));
+
+			auto testBuildOperationGraph = OperationGraph(
+				std::vector<OperationId>(),
+				std::vector<OperationInfo>());
+			auto testBuildOperationGraphFiles = std::set<FileId>();
+			auto testBuildOperationGraphContent = std::stringstream();
+			OperationGraphWriter::Serialize(testBuildOperationGraph, testBuildOperationGraphFiles, fileSystemState,  testBuildOperationGraphContent);
+			fileSystem->CreateMockFile(
+				Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bog"),
+				std::make_shared<MockFile>(std::move(testBuildOperationGraphContent)));
+
+			// Register the test process manager
+			auto processManager = std::make_shared<MockProcessManager>();
+			auto scopedProcessManager = ScopedProcessManagerRegister(processManager);
+
+			auto arguments = RecipeBuildArguments();
+			arguments.HostPlatform = "TestPlatform";
+			arguments.WorkingDirectory = Path("C:/WorkingDirectory/MyPackage/");
+			auto userDataPath = Path("C:/Users/Me/.soup/");
+			auto systemReadAccess = std::vector<Path>({
+				Path("C:/FakeSystem/"),
+			});
+			auto recipeCache = RecipeCache({
 				{
+					"C:/WorkingDirectory/MyPackage/Recipe.sml",
+					Recipe(RecipeTable(
 					{
-						"Dependencies",
-						ValueTable(
+						{ "Name", "MyPackage" },
+						{ "Language", "C++|1" },
+						{ "Version", "1.0.0" },
 						{
+							"Dependencies",
+							RecipeTable(
 							{
-								"Build",
-								ValueTable(
-								{
-									{
-										"User1|TestBuild",
-										ValueTable(
-										{
-											{ "SoupTargetDirectory", std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/") },
-										})
-									},
-								})
-							},
-						})
-					},
-					{
-						"EvaluateMacros",
-						ValueTable(
-						{
-							{ "/(PACKAGE_MyPackage)/", std::string("C:/WorkingDirectory/MyPackage/") },
-							{ "/(TARGET_MyPackage)/", std::string("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
-						})
-					},
-					{
-						"EvaluateReadAccess",
-						ValueList(
-						{
-							std::string("/(PACKAGE_MyPackage)/"),
-							std::string("/(TARGET_MyPackage)/"),
-						})
-					},
-					{
-						"EvaluateWriteAccess",
-						ValueList(
-						{
-							std::string("/(TARGET_MyPackage)/"),
-						})
-					},
-					{
-						"GenerateMacros",
-						ValueTable(
-						{
-							{ "/(BUILD_TARGET_User1|TestBuild)/", std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/") },
-						})
-					},
-					{
-						"GenerateSubGraphMacros",
-						ValueTable(
-						{
-							{ "/(TARGET_User1|TestBuild)/", std::string("/(BUILD_TARGET_User1|TestBuild)/") },
-						})
-					},
-					{
-						"GlobalState",
-						ValueTable(
-						{
-							{
-								"Context",
-								ValueTable(
-								{
-									{ "HostPlatform", std::string("TestPlatform") },
-									{ "PackageDirectory", std::string("/(PACKAGE_MyPackage)/") },
-									{ "TargetDirectory", std::string("/(TARGET_MyPackage)/") },
-								})
-							},
-							{
-								"Dependencies",
-								ValueTable(
-								{
-									{
-										"Build",
-										ValueTable(
-										{
-											{
-												"User1|TestBuild",
-												ValueTable(
-												{
-													{
-														"Context",
-														ValueTable(
-														{
-															{ "Reference", std::string("User1|TestBuild@1.2.3") },
-															{ "TargetDirectory", std::string("/(TARGET_User1|TestBuild)/") },
-														})
-													},
-												})
-											},
-										})
-									},
-								})
-							},
-							{
-								"FileSystem",
-								ValueList({
-									std::string("Recipe.sml"),
-								})
-							},
-							{
-								"Parameters",
-								ValueTable(
-								{
-									{ "ArgumentValue", true },
-								})
-							},
-						})
-					},
-					{
-						"PackageRoot",
-						std::string("C:/WorkingDirectory/MyPackage/")
-					},
-					{
-						"UserDataPath",
-						std::string("C:/Users/Me/.soup/")
-					},
-				}),
-				ValueTableReader::Deserialize(myPackageGenerateInputMockFile->Content),
-				"Verify file content match expected.");
-
-			auto myPackageGenerateResultsMockFile = fileSystem->GetMockFile(
-				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor"));
-			auto myPackageGenerateResults = OperationResultsReader::Deserialize(myPackageGenerateResultsMockFile->Content, fileSystemState);
-
-			Assert::AreEqual(
-				OperationResults({
-					{
-						1,
-						OperationResult(
-							true,
-							GetEpochTime(),
-							{},
-							{})
-					},
-				}),
-				myPackageGenerateResults,
-				"Verify my package generate results content match expected.");
-		}
-
-		// [[Fact]]
-		void Execute_TriangleDependency_NoRebuild()
-		{
-			// Register the test listener
-			auto testListener = std::make_shared<TestTraceListener>();
-			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
-
-			// Register the test file system
-			auto fileSystem = std::make_shared<MockFileSystem>();
-			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
-			auto fileSystemState = FileSystemState(
-				0,
-				{},
-				TestHelpers::BuildDirectoryLookup({
-					Path("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/Recipe.sml"),
-					Path("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/Recipe.sml"),
-					Path("C:/WorkingDirectory/MyPackage/Recipe.sml"),
-				}),
-				{});
-
-			fileSystem->CreateMockDirectory(
-				Path("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/"),
-				std::make_shared<MockDirectory>(std::vector<Path>({})));
-
-			fileSystem->CreateMockDirectory(
-				Path("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/"),
-				std::make_shared<MockDirectory>(std::vector<Path>({})));
-
-			fileSystem->CreateMockDirectory(
-				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/"),
-				std::make_shared<MockDirectory>(std::vector<Path>({})));
-
-			auto myProjectOperationGraph = OperationGraph(
-				std::vector<OperationId>(),
-				std::vector<OperationInfo>());
-			auto myProjectOperationGraphFiles = std::set<FileId>();
-			auto myProjectOperationGraphContent = std::stringstream();
-			OperationGraphWriter::Serialize(myProjectOperationGraph, myProjectOperationGraphFiles, fileSystemState, myProjectOperationGraphContent);
-			fileSystem->CreateMockFile(
-				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog"),
-				std::make_shared<MockFile>(std::move(myProjectOperationGraphContent)));
-			auto packageAOperationGraph = OperationGraph(
-				std::vector<OperationId>(),
-				std::vector<OperationInfo>());
-			auto packageAOperationGraphFiles = std::set<FileId>();
-			auto packageAOperationGraphContent = std::stringstream();
-			OperationGraphWriter::Serialize(packageAOperationGraph, packageAOperationGraphFiles, fileSystemState, packageAOperationGraphContent);
-			fileSystem->CreateMockFile(
-				Path("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog"),
-				std::make_shared<MockFile>(std::move(packageAOperationGraphContent)));
-			auto packageBOperationGraph = OperationGraph(
-				std::vector<OperationId>(),
-				std::vector<OperationInfo>());
-			auto packageBOperationGraphFiles = std::set<FileId>();
-			auto packageBOperationGraphContent = std::stringstream();
-			OperationGraphWriter::Serialize(packageBOperationGraph, packageBOperationGraphFiles, fileSystemState, packageBOperationGraphContent);
-			fileSystem->CreateMockFile(
-				Path("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog"),
-				std::make_shared<MockFile>(std::move(packageBOperationGraphContent)));
-
-			// Register the test process manager
-			auto processManager = std::make_shared<MockProcessManager>();
-			auto scopedProcessManager = ScopedProcessManagerRegister(processManager);
-
-			auto arguments = RecipeBuildArguments();
-			arguments.HostPlatform = "TestPlatform";
-			arguments.WorkingDirectory = Path("C:/WorkingDirectory/MyPackage/");
-			auto userDataPath = Path("C:/Users/Me/.soup/");
-			auto systemReadAccess = std::vector<Path>({
-				Path("C:/FakeSystem/"),
-			});
-			auto recipeCache = RecipeCache({
-				{
-					"C:/WorkingDirectory/MyPackage/Recipe.sml",
-					Recipe(RecipeTable(
-					{
-						{ "Name", "MyPackage" },
-						{ "Language", "C++|1" },
-						{ "Version", "1.0.0" },
-						{
-							"Dependencies",
-							RecipeTable(
-							{
-								{ "Runtime", RecipeList({ "User1|PackageA@1.2.3", "User1|PackageB@1.1.1" }) },
+								{ "Build", RecipeList({ "User1|TestBuild@1.2.3" }) },
 							})
 						},
 					}))
 				},
 				{
-					"C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/Recipe.sml",
+					"C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/Recipe.sml",
 					Recipe(RecipeTable(
 					{
-						{ "Name", "PackageA" },
-						{ "Language", "C++|1" },
+						{ "Name", "TestBuild" },
+						{ "Language", "C#|1" },
 						{ "Version", "1.2.3" },
-						{
-							"Dependencies",
-							RecipeTable(
-							{
-								{ "Runtime", RecipeList({ "User1|PackageB@1.1.1" }) },
-							})
-						},
-					}))
-				},
-				{
-					"C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/Recipe.sml",
-					Recipe(RecipeTable(
-					{
-						{ "Name", "PackageB" },
-						{ "Language", "C++|1" },
-						{ "Version", "1.1.1" },
 					}))
 				},
 			});
@@ -947,6 +698,16 @@ namespace Soup::Core::UnitTests
 								{ "ArgumentValue", Value(true) },
 							}))
 					},
+					{
+						2,
+						PackageGraph(
+							2,
+							2,
+							ValueTable(
+							{
+								{ "HostValue", Value(true) },
+							}))
+					},
 				}),
 				PackageLookupMap(
 				{
@@ -961,10 +722,13 @@ namespace Soup::Core::UnitTests
 							&recipeCache.GetRecipe(Path("C:/WorkingDirectory/MyPackage/Recipe.sml")),
 							PackageChildrenMap({
 								{
-									"Runtime",
+									"Build",
 									{
-										PackageChildInfo(PackageReference(std::nullopt, "User1", "PackageA", SemanticVersion(1, 2, 3)), false, 2, -1),
-										PackageChildInfo(PackageReference(std::nullopt, "User1", "PackageB", SemanticVersion(1, 1, 1)), false, 3, -1),
+										PackageChildInfo(
+											PackageReference(std::nullopt, "User1", "TestBuild", SemanticVersion(1, 2, 3)),
+											true,
+											-1,
+											2),
 									}
 								},
 							}))
@@ -973,35 +737,18 @@ namespace Soup::Core::UnitTests
 						2,
 						PackageInfo(
 							2,
-							PackageName("User1", "PackageA"),
+							PackageName("User1", "TestBuild"),
 							false,
-							Path("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/"),
+							Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/"),
 							Path(),
-							&recipeCache.GetRecipe(Path("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/Recipe.sml")),
-							PackageChildrenMap({
-								{
-									"Runtime",
-									{
-										PackageChildInfo(PackageReference(std::nullopt, "User1", "PackageB", SemanticVersion(1, 1, 1)), false, 3, -1),
-									}
-								},
-							}))
-					},
-					{
-						3,
-						PackageInfo(
-							3,
-							PackageName("User1", "PackageB"),
-							false,
-							Path("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/"),
-							Path(),
-							&recipeCache.GetRecipe(Path("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/Recipe.sml")),
+							&recipeCache.GetRecipe(Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/Recipe.sml")),
 							PackageChildrenMap())
 					},
 				}));
 			auto evaluateEngine = MockEvaluateEngine();
 			auto knownLanguages = std::map<std::string, KnownLanguage>();
 			auto locationManager = RecipeBuildLocationManager(knownLanguages);
+			auto stateLock = BuildStateLock();
 			auto uut = BuildRunner(
 				arguments,
 				userDataPath,
@@ -1010,58 +757,34 @@ namespace Soup::Core::UnitTests
 				packageProvider,
 				evaluateEngine,
 				fileSystemState,
-				locationManager);
+				locationManager,
+				stateLock);
 			uut.Execute();
 
 			// Verify expected logs
 			Assert::AreEqual(
 				std::vector<std::string>({
-					"DIAG: 3>Running Build: [C++]User1|PackageB",
-					"INFO: 3>Build 'User1|PackageB'",
-					"INFO: 3>Checking for existing Evaluate Operation Graph",
-					"DIAG: 3>C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
-					"INFO: 3>Previous graph found",
-					"INFO: 3>Checking for existing Evaluate Operation Results",
-					"DIAG: 3>C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
-					"INFO: 3>Operation results file does not exist",
-					"INFO: 3>No previous results found",
-					"INFO: 3>Create Directory: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
-					"INFO: 3>Check outdated generate input file: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt",
-					"INFO: 3>Value Table file does not exist",
-					"INFO: 3>Save Generate Input file",
-					"INFO: 3>Checking for existing Generate Operation Results",
-					"DIAG: 3>C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor",
-					"INFO: 3>Operation results file does not exist",
-					"INFO: 3>No previous results found",
-					"INFO: 3>Loading new Evaluate Operation Graph",
-					"DIAG: 3>Map previous operation graph observed results",
-					"INFO: 3>Create Directory: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
-					"INFO: 3>Saving updated build state",
-					"INFO: 3>Done",
-					"DIAG: 2>Running Build: [C++]User1|PackageA",
-					"INFO: 2>Build 'User1|PackageA'",
+					"DIAG: 2>Running Build: [C#]User1|TestBuild",
+					"INFO: 2>Build 'User1|TestBuild'",
 					"INFO: 2>Checking for existing Evaluate Operation Graph",
-					"DIAG: 2>C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
+					"DIAG: 2>C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bog",
 					"INFO: 2>Previous graph found",
 					"INFO: 2>Checking for existing Evaluate Operation Results",
-					"DIAG: 2>C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
+					"DIAG: 2>C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bor",
 					"INFO: 2>Operation results file does not exist",
 					"INFO: 2>No previous results found",
-					"INFO: 2>Create Directory: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
-					"INFO: 2>Check outdated generate input file: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt",
+					"INFO: 2>Create Directory: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/",
+					"INFO: 2>Check outdated generate input file: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/GenerateInput.bvt",
 					"INFO: 2>Value Table file does not exist",
 					"INFO: 2>Save Generate Input file",
 					"INFO: 2>Checking for existing Generate Operation Results",
-					"DIAG: 2>C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor",
+					"DIAG: 2>C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Generate.bor",
 					"INFO: 2>Operation results file does not exist",
 					"INFO: 2>No previous results found",
 					"INFO: 2>Loading new Evaluate Operation Graph",
 					"DIAG: 2>Map previous operation graph observed results",
-					"INFO: 2>Create Directory: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
-					"INFO: 2>Saving updated build state",
+					"INFO: 2>Create Directory: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
 					"INFO: 2>Done",
-					"DIAG: 3>Running Build: [C++]User1|PackageB",
-					"DIAG: 3>Recipe already built: [C++]User1|PackageB",
 					"DIAG: 1>Running Build: [C++]MyPackage",
 					"INFO: 1>Build 'MyPackage'",
 					"INFO: 1>Checking for existing Evaluate Operation Graph",
@@ -1082,7 +805,6 @@ namespace Soup::Core::UnitTests
 					"INFO: 1>Loading new Evaluate Operation Graph",
 					"DIAG: 1>Map previous operation graph observed results",
 					"INFO: 1>Create Directory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
-					"INFO: 1>Saving updated build state",
 					"INFO: 1>Done",
 				}),
 				testListener->GetMessages(),
@@ -1091,53 +813,34 @@ namespace Soup::Core::UnitTests
 			// Verify expected file system requests
 			Assert::AreEqual(
 				std::vector<std::string>({
-					"Exists: C:/Users/Me/.soup/packages/C++/User1/PackageB/RootRecipe.sml",
-					"Exists: C:/Users/Me/.soup/packages/C++/User1/RootRecipe.sml",
-					"Exists: C:/Users/Me/.soup/packages/C++/RootRecipe.sml",
-					"Exists: C:/Users/Me/.soup/packages/RootRecipe.sml",
-					"Exists: C:/Users/Me/.soup/RootRecipe.sml",
-					"Exists: C:/Users/Me/RootRecipe.sml",
-					"Exists: C:/Users/RootRecipe.sml",
-					"Exists: C:/RootRecipe.sml",
-					"TryGetDirectoryFilesLastWriteTime: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
-					"Exists: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
-					"CreateDirectory: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt",
-					"OpenWriteBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor",
-					"OpenWriteBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
-					"Exists: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
-					"CreateDirectory: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
-					"OpenWriteBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
-					"Exists: C:/Users/Me/.soup/packages/C++/User1/PackageA/RootRecipe.sml",
-					"Exists: C:/Users/Me/.soup/packages/C++/User1/RootRecipe.sml",
-					"Exists: C:/Users/Me/.soup/packages/C++/RootRecipe.sml",
+					"Exists: C:/Users/Me/.soup/packages/C#/TestBuild/RootRecipe.sml",
+					"Exists: C:/Users/Me/.soup/packages/C#/RootRecipe.sml",
 					"Exists: C:/Users/Me/.soup/packages/RootRecipe.sml",
 					"Exists: C:/Users/Me/.soup/RootRecipe.sml",
 					"Exists: C:/Users/Me/RootRecipe.sml",
 					"Exists: C:/Users/RootRecipe.sml",
 					"Exists: C:/RootRecipe.sml",
-					"TryGetDirectoryFilesLastWriteTime: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
-					"Exists: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
-					"CreateDirectory: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt",
-					"OpenWriteBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor",
-					"OpenWriteBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
-					"Exists: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
-					"CreateDirectory: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
-					"OpenWriteBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
+					"TryGetDirectoryFilesLastWriteTime: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bog",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bor",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.brj",
+					"Exists: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/",
+					"CreateDirectory: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/GenerateInput.bvt",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/GenerateInput.bvt",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Generate.bor",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Generate.bor",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bog",
+					"Exists: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
+					"CreateDirectory: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.brj",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bor",
 					"Exists: C:/WorkingDirectory/RootRecipe.sml",
 					"Exists: C:/RootRecipe.sml",
 					"TryGetDirectoryFilesLastWriteTime: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/",
 					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
 					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
+					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.brj",
 					"Exists: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
 					"CreateDirectory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
 					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt",
@@ -1147,6 +850,7 @@ namespace Soup::Core::UnitTests
 					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
 					"Exists: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"CreateDirectory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.brj",
 					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
 				}),
 				fileSystem->GetRequests(),
@@ -1157,7 +861,6 @@ namespace Soup::Core::UnitTests
 				std::vector<std::string>({
 					"GetCurrentProcessFileName",
 					"GetCurrentProcessFileName",
-					"GetCurrentProcessFileName",
 				}),
 				processManager->GetRequests(),
 				"Verify process manager requests match expected.");
@@ -1165,10 +868,8 @@ namespace Soup::Core::UnitTests
 			// Verify expected evaluate requests
 			Assert::AreEqual(
 				std::vector<std::string>({
-					"Evaluate: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
-					"Evaluate: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
-					"Evaluate: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
-					"Evaluate: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"Evaluate: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
+					"Evaluate: C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
 					"Evaluate: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"Evaluate: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 				}),
@@ -1176,61 +877,41 @@ namespace Soup::Core::UnitTests
 				"Verify evaluate requests match expected.");
 
 			// Verify files
-			auto packageAGenerateInputMockFile = fileSystem->GetMockFile(
-				Path("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt"));
+			auto testBuildGenerateInputMockFile = fileSystem->GetMockFile(
+				Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/GenerateInput.bvt"));
 			Assert::AreEqual(
 				ValueTable(
 				{
 					{
 						"Dependencies",
-						ValueTable(
-						{
-							{
-								"Runtime",
-								ValueTable(
-								{
-									{
-										"User1|PackageB",
-										ValueTable(
-										{
-											{ "SoupTargetDirectory", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/") },
-										})
-									},
-								})
-							},
-						})
+						ValueTable()
 					},
 					{
 						"EvaluateMacros",
 						ValueTable(
 						{
-							{ "/(PACKAGE_User1|PackageA)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/") },
-							{ "/(TARGET_User1|PackageA)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
-							{ "/(TARGET_User1|PackageB)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
+							{ "/(PACKAGE_User1|TestBuild)/", std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/") },
+							{ "/(TARGET_User1|TestBuild)/", std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/") },
 						})
 					},
 					{
 						"EvaluateReadAccess",
 						ValueList(
 						{
-							std::string("/(PACKAGE_User1|PackageA)/"),
-							std::string("/(TARGET_User1|PackageA)/"),
-							std::string("/(TARGET_User1|PackageB)/"),
+							std::string("/(PACKAGE_User1|TestBuild)/"),
+							std::string("/(TARGET_User1|TestBuild)/"),
 						})
 					},
 					{
 						"EvaluateWriteAccess",
 						ValueList(
 						{
-							std::string("/(TARGET_User1|PackageA)/"),
+							std::string("/(TARGET_User1|TestBuild)/"),
 						})
 					},
 					{
 						"GenerateMacros",
-						ValueTable(
-						{
-							{ "/(TARGET_User1|PackageB)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
-						})
+						ValueTable()
 					},
 					{
 						"GenerateSubGraphMacros",
@@ -1245,36 +926,11 @@ namespace Soup::Core::UnitTests
 								ValueTable(
 								{
 									{ "HostPlatform", std::string("TestPlatform") },
-									{ "PackageDirectory", std::string("/(PACKAGE_User1|PackageA)/") },
-									{ "TargetDirectory", std::string("/(TARGET_User1|PackageA)/") },
-								})
-							},
-							{
-								"Dependencies",
-								ValueTable(
-								{
-									{
-										"Runtime",
-										ValueTable(
-										{
-											{
-												"User1|PackageB",
-												ValueTable(
-												{
-													{
-														"Context",
-														ValueTable(
-														{
-															{ "Reference", std::string("User1|PackageB@1.1.1") },
-															{ "TargetDirectory", std::string("/(TARGET_User1|PackageB)/") },
-														})
-													},
-												})
-											},
-										})
-									},
+									{ "PackageDirectory", std::string("/(PACKAGE_User1|TestBuild)/") },
+									{ "TargetDirectory", std::string("/(TARGET_User1|TestBuild)/") },
 								})
 							},
+							{ "Dependencies", ValueTable() },
 							{
 								"FileSystem",
 								ValueList({
@@ -1285,26 +941,26 @@ namespace Soup::Core::UnitTests
 								"Parameters",
 								ValueTable(
 								{
-									{ "ArgumentValue", true },
+									{ "HostValue", true },
 								})
 							},
 						})
 					},
 					{
 						"PackageRoot",
-						std::string("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/")
+						std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/")
 					},
 					{
 						"UserDataPath",
 						std::string("C:/Users/Me/.soup/")
 					},
 				}),
-				ValueTableReader::Deserialize(packageAGenerateInputMockFile->Content),
+				ValueTableReader::Deserialize(testBuildGenerateInputMockFile->Content),
 				"Verify file content match expected.");
 
-			auto packageAGenerateResultsMockFile = fileSystem->GetMockFile(
-				Path("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor"));
-			auto packageAGenerateResults = OperationResultsReader::Deserialize(packageAGenerateResultsMockFile->Content, fileSystemState);
+			auto testBuildGenerateResultsMockFile = fileSystem->GetMockFile(
+				Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Generate.bor"));
+			auto testBuildGenerateResults = OperationResultsReader::Deserialize(testBuildGenerateResultsMockFile->Content, fileSystemState);
 
 			Assert::AreEqual(
 				OperationResults({
@@ -1317,48 +973,69 @@ namespace Soup::Core::UnitTests
 							{})
 					},
 				}),
-				packageAGenerateResults,
-				"Verify package A generate results content match expected.");
+				testBuildGenerateResults,
+				"Verify test build generate results content match expected.");
 
-			auto packageBGenerateInputMockFile = fileSystem->GetMockFile(
-				Path("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt"));
+			auto myPackageGenerateInputMockFile = fileSystem->GetMockFile(
+				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt"));
 			Assert::AreEqual(
 				ValueTable(
 				{
 					{
 						"Dependencies",
-						ValueTable()
+						ValueTable(
+						{
+							{
+								"Build",
+								ValueTable(
+								{
+									{
+										"User1|TestBuild",
+										ValueTable(
+										{
+											{ "SoupTargetDirectory", std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/") },
+										})
+									},
+								})
+							},
+						})
 					},
 					{
 						"EvaluateMacros",
 						ValueTable(
 						{
-							{ "/(PACKAGE_User1|PackageB)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/") },
-							{ "/(TARGET_User1|PackageB)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
+							{ "/(PACKAGE_MyPackage)/", std::string("C:/WorkingDirectory/MyPackage/") },
+							{ "/(TARGET_MyPackage)/", std::string("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
 						})
 					},
 					{
 						"EvaluateReadAccess",
 						ValueList(
 						{
-							std::string("/(PACKAGE_User1|PackageB)/"),
-							std::string("/(TARGET_User1|PackageB)/"),
+							std::string("/(PACKAGE_MyPackage)/"),
+							std::string("/(TARGET_MyPackage)/"),
 						})
 					},
 					{
 						"EvaluateWriteAccess",
 						ValueList(
 						{
-							std::string("/(TARGET_User1|PackageB)/"),
+							std::string("/(TARGET_MyPackage)/"),
 						})
 					},
 					{
 						"GenerateMacros",
-						ValueTable()
+						ValueTable(
+						{
+							{ "/(BUILD_TARGET_User1|TestBuild)/", std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.2.3/out/zDqRc65c9x3jySpevCCCyZ15fGs/") },
+						})
 					},
 					{
 						"GenerateSubGraphMacros",
-						ValueTable()
+						ValueTable(
+						{
+							{ "/(TARGET_User1|TestBuild)/", std::string("/(BUILD_TARGET_User1|TestBuild)/") },
+						})
 					},
 					{
 						"GlobalState",
@@ -1369,171 +1046,28 @@ namespace Soup::Core::UnitTests
 								ValueTable(
 								{
 									{ "HostPlatform", std::string("TestPlatform") },
-									{ "PackageDirectory", std::string("/(PACKAGE_User1|PackageB)/") },
-									{ "TargetDirectory", std::string("/(TARGET_User1|PackageB)/") },
-								})
-							},
-							{ "Dependencies", ValueTable() },
-							{
-								"FileSystem",
-								ValueList({
-									std::string("Recipe.sml"),
+									{ "PackageDirectory", std::string("/(PACKAGE_MyPackage)/") },
+									{ "TargetDirectory", std::string("/(TARGET_MyPackage)/") },
 								})
 							},
 							{
-								"Parameters",
-								ValueTable(
-								{
-									{ "ArgumentValue", true },
-								})
-							},
-						})
-					},
-					{
-						"PackageRoot",
-						std::string("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/")
-					},
-					{
-						"UserDataPath",
-						std::string("C:/Users/Me/.soup/")
-					},
-				}),
-				ValueTableReader::Deserialize(packageBGenerateInputMockFile->Content),
-				"Verify file content match expected.");
-
-			auto packageBGenerateResultsMockFile = fileSystem->GetMockFile(
-				Path("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor"));
-			auto packageBGenerateResults = OperationResultsReader::Deserialize(packageBGenerateResultsMockFile->Content, fileSystemState);
-
-			Assert::AreEqual(
-				OperationResults({
-					{
-						1,
-						OperationResult(
-							true,
-							GetEpochTime(),
-							{},
-							{})
-					},
-				}),
-				packageBGenerateResults,
-				"Verify package B generate results content match expected.");
-
-			auto myPackageGenerateInputMockFile = fileSystem->GetMockFile(
-				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt"));
-			Assert::AreEqual(
-				ValueTable(
-				{
-					{
-						"Dependencies",
-						ValueTable(
-						{
-							{
-								"Runtime",
-								ValueTable(
-								{
-									{
-										"User1|PackageA",
-										ValueTable(
-										{
-											{ "SoupTargetDirectory", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/") },
-										})
-									},
-									{
-										"User1|PackageB",
-										ValueTable(
-										{
-											{ "SoupTargetDirectory", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/") },
-										})
-									},
-								})
-							},
-						})
-					},
-					{
-						"EvaluateMacros",
-						ValueTable(
-						{
-							{ "/(PACKAGE_MyPackage)/", std::string("C:/WorkingDirectory/MyPackage/") },
-							{ "/(TARGET_MyPackage)/", std::string("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
-							{ "/(TARGET_User1|PackageA)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
-							{ "/(TARGET_User1|PackageB)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
-						})
-					},
-					{
-						"EvaluateReadAccess",
-						ValueList(
-						{
-							std::string("/(PACKAGE_MyPackage)/"),
-							std::string("/(TARGET_MyPackage)/"),
-							std::string("/(TARGET_User1|PackageA)/"),
-							std::string("/(TARGET_User1|PackageB)/"),
-						})
-					},
-					{
-						"EvaluateWriteAccess",
-						ValueList(
-						{
-							std::string("/(TARGET_MyPackage)/"),
-						})
-					},
-					{
-						"GenerateMacros",
-						ValueTable(
-						{
-							{ "/(TARGET_User1|PackageA)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
-							{ "/(TARGET_User1|PackageB)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
-						})
-					},
-					{
-						"GenerateSubGraphMacros",
-						ValueTable()
-					},
-					{
-						"GlobalState",
-						ValueTable(
-						{
-							{
-								"Context",
-								ValueTable(
-								{
-									{ "HostPlatform", std::string("TestPlatform") },
-									{ "PackageDirectory", std::string("/(PACKAGE_MyPackage)/") },
-									{ "TargetDirectory", std::string("/(TARGET_MyPackage)/") },
-								})
-							},
-							{
-								"Dependencies",
+								"Dependencies",
 								ValueTable(
 								{
 									{
-										"Runtime",
+										"Build",
 										ValueTable(
 										{
 											{
-												"User1|PackageA",
-												ValueTable(
-												{
-													{
-														"Context",
-														ValueTable(
-														{
-															{ "Reference", std::string("User1|PackageA@1.2.3") },
-															{ "TargetDirectory", std::string("/(TARGET_User1|PackageA)/") },
-														})
-													},
-												})
-											},
-											{
-												"User1|PackageB",
+												"User1|TestBuild",
 												ValueTable(
 												{
 													{
 														"Context",
 														ValueTable(
 														{
-															{ "Reference", std::string("User1|PackageB@1.1.1") },
-															{ "TargetDirectory", std::string("/(TARGET_User1|PackageB)/") },
+															{ "Reference", std::string("User1|TestBuild@1.2.3") },
+															{ "TargetDirectory", std::string("/(TARGET_User1|TestBuild)/") },
 														})
 													},
 												})
@@ -1589,7 +1123,7 @@ namespace Soup::Core::UnitTests
 		}
 
 		// [[Fact]]
-		void Execute_PackageLock_OverrideBuildDependency()
+		void Execute_TriangleDependency_NoRebuild()
 		{
 			// Register the test listener
 			auto testListener = std::make_shared<TestTraceListener>();
@@ -1602,46 +1136,23 @@ namespace Soup::Core::UnitTests
 				0,
 				{},
 				TestHelpers::BuildDirectoryLookup({
-					Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/Recipe.sml"),
+					Path("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/Recipe.sml"),
+					Path("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/Recipe.sml"),
 					Path("C:/WorkingDirectory/MyPackage/Recipe.sml"),
 				}),
 				{});
 
 			fileSystem->CreateMockDirectory(
-				Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/"),
+				Path("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/"),
 				std::make_shared<MockDirectory>(std::vector<Path>({})));
 
 			fileSystem->CreateMockDirectory(
-				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/"),
+				Path("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/"),
 				std::make_shared<MockDirectory>(std::vector<Path>({})));
 
-			// Create the package lock
-			fileSystem->CreateMockFile(
-				Path("C:/WorkingDirectory/MyPackage/PackageLock.sml"),
-				std::make_shared<MockFile>(std::stringstream(R"(
-					Version: 5
-					Closures: {
-						Root: {
-							"C#": {
-								"User1|TestBuild": { Version: "1.3.0", Build: "Build1" }
-							}
-							"C++": {
-								MyPackage: { Version: "../MyPackage/", Build: "Build0" }
-							}
-						}
-						Build0: {
-							"C#": {
-								"User1|Cpp": { Version: "1.0.2" }
-								"User1|TestBuild": { Version: "1.3.0" }
-							}
-						}
-						Build1: {
-							"C#": {
-								"User1|Soup.CSharp": { Version: "1.0.1" }
-							}
-						}
-					}
-				)")));
+			fileSystem->CreateMockDirectory(
+				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/"),
+				std::make_shared<MockDirectory>(std::vector<Path>({})));
 
 			auto myProjectOperationGraph = OperationGraph(
 				std::vector<OperationId>(),
@@ -1652,16 +1163,24 @@ namespace Soup::Core::UnitTests
 			fileSystem->CreateMockFile(
 				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog"),
 				std::make_shared<MockFile>(std::move(myProjectOperationGraphContent)));
-
-			auto testBuildOperationGraph = OperationGraph(
+			auto packageAOperationGraph = OperationGraph(
 				std::vector<OperationId>(),
 				std::vector<OperationInfo>());
-			auto testBuildOperationGraphFiles = std::set<FileId>();
-			auto testBuildOperationGraphContent = std::stringstream();
-			OperationGraphWriter::Serialize(testBuildOperationGraph, testBuildOperationGraphFiles, fileSystemState, testBuildOperationGraphContent);
+			auto packageAOperationGraphFiles = std::set<FileId>();
+			auto packageAOperationGraphContent = std::stringstream();
+			OperationGraphWriter::Serialize(packageAOperationGraph, packageAOperationGraphFiles, fileSystemState, packageAOperationGraphContent);
 			fileSystem->CreateMockFile(
-				Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bog"),
-				std::make_shared<MockFile>(std::move(testBuildOperationGraphContent)));
+				Path("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog"),
+				std::make_shared<MockFile>(std::move(packageAOperationGraphContent)));
+			auto packageBOperationGraph = OperationGraph(
+				std::vector<OperationId>(),
+				std::vector<OperationInfo>());
+			auto packageBOperationGraphFiles = std::set<FileId>();
+			auto packageBOperationGraphContent = std::stringstream();
+			OperationGraphWriter::Serialize(packageBOperationGraph, packageBOperationGraphFiles, fileSystemState, packageBOperationGraphContent);
+			fileSystem->CreateMockFile(
+				Path("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog"),
+				std::make_shared<MockFile>(std::move(packageBOperationGraphContent)));
 
 			// Register the test process manager
 			auto processManager = std::make_shared<MockProcessManager>();
@@ -1686,18 +1205,34 @@ namespace Soup::Core::UnitTests
 							"Dependencies",
 							RecipeTable(
 							{
-								{ "Build", RecipeList({ "User1|TestBuild@1.2.3" }) },
+								{ "Runtime", RecipeList({ "User1|PackageA@1.2.3", "User1|PackageB@1.1.1" }) },
 							})
 						},
 					}))
 				},
 				{
-					"C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/Recipe.sml",
+					"C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/Recipe.sml",
 					Recipe(RecipeTable(
 					{
-						{ "Name", "TestBuild" },
-						{ "Language", "C#|1" },
-						{ "Version", "1.3.0" },
+						{ "Name", "PackageA" },
+						{ "Language", "C++|1" },
+						{ "Version", "1.2.3" },
+						{
+							"Dependencies",
+							RecipeTable(
+							{
+								{ "Runtime", RecipeList({ "User1|PackageB@1.1.1" }) },
+							})
+						},
+					}))
+				},
+				{
+					"C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/Recipe.sml",
+					Recipe(RecipeTable(
+					{
+						{ "Name", "PackageB" },
+						{ "Language", "C++|1" },
+						{ "Version", "1.1.1" },
 					}))
 				},
 			});
@@ -1715,16 +1250,6 @@ namespace Soup::Core::UnitTests
 								{ "ArgumentValue", Value(true) },
 							}))
 					},
-					{
-						2,
-						PackageGraph(
-							2,
-							2,
-							ValueTable(
-							{
-								{ "HostValue", Value(true) },
-							}))
-					},
 				}),
 				PackageLookupMap(
 				{
@@ -1739,9 +1264,10 @@ namespace Soup::Core::UnitTests
 							&recipeCache.GetRecipe(Path("C:/WorkingDirectory/MyPackage/Recipe.sml")),
 							PackageChildrenMap({
 								{
-									"Build",
+									"Runtime",
 									{
-										PackageChildInfo(PackageReference(std::nullopt, "User1", "TestBuild", SemanticVersion(1, 2, 3)), true, -1, 2),
+										PackageChildInfo(PackageReference(std::nullopt, "User1", "PackageA", SemanticVersion(1, 2, 3)), false, 2, -1),
+										PackageChildInfo(PackageReference(std::nullopt, "User1", "PackageB", SemanticVersion(1, 1, 1)), false, 3, -1),
 									}
 								},
 							}))
@@ -1750,17 +1276,36 @@ namespace Soup::Core::UnitTests
 						2,
 						PackageInfo(
 							2,
-							PackageName("User1", "TestBuild"),
+							PackageName("User1", "PackageA"),
 							false,
-							Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/"),
+							Path("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/"),
 							Path(),
-							&recipeCache.GetRecipe(Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/Recipe.sml")),
-							PackageChildrenMap())
-					},
-				}));
-			auto evaluateEngine = MockEvaluateEngine();
-			auto knownLanguages = std::map<std::string, KnownLanguage>();
-			auto locationManager = RecipeBuildLocationManager(knownLanguages);
+							&recipeCache.GetRecipe(Path("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/Recipe.sml")),
+							PackageChildrenMap({
+								{
+									"Runtime",
+									{
+										PackageChildInfo(PackageReference(std::nullopt, "User1", "PackageB", SemanticVersion(1, 1, 1)), false, 3, -1),
+									}
+								},
+							}))
+					},
+					{
+						3,
+						PackageInfo(
+							3,
+							PackageName("User1", "PackageB"),
+							false,
+							Path("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/"),
+							Path(),
+							&recipeCache.GetRecipe(Path("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/Recipe.sml")),
+							PackageChildrenMap())
+					},
+				}));
+			auto evaluateEngine = MockEvaluateEngine();
+			auto knownLanguages = std::map<std::string, KnownLanguage>();
+			auto locationManager = RecipeBuildLocationManager(knownLanguages);
+			auto stateLock = BuildStateLock();
 			auto uut = BuildRunner(
 				arguments,
 				userDataPath,
@@ -1769,33 +1314,54 @@ namespace Soup::Core::UnitTests
 				packageProvider,
 				evaluateEngine,
 				fileSystemState,
-				locationManager);
+				locationManager,
+				stateLock);
 			uut.Execute();
 
 			// Verify expected logs
 			Assert::AreEqual(
 				std::vector<std::string>({
-					"DIAG: 2>Running Build: [C#]User1|TestBuild",
-					"INFO: 2>Build 'User1|TestBuild'",
+					"DIAG: 3>Running Build: [C++]User1|PackageB",
+					"INFO: 3>Build 'User1|PackageB'",
+					"INFO: 3>Checking for existing Evaluate Operation Graph",
+					"DIAG: 3>C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
+					"INFO: 3>Previous graph found",
+					"INFO: 3>Checking for existing Evaluate Operation Results",
+					"DIAG: 3>C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
+					"INFO: 3>Operation results file does not exist",
+					"INFO: 3>No previous results found",
+					"INFO: 3>Create Directory: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
+					"INFO: 3>Check outdated generate input file: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt",
+					"INFO: 3>Value Table file does not exist",
+					"INFO: 3>Save Generate Input file",
+					"INFO: 3>Checking for existing Generate Operation Results",
+					"DIAG: 3>C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor",
+					"INFO: 3>Operation results file does not exist",
+					"INFO: 3>No previous results found",
+					"INFO: 3>Loading new Evaluate Operation Graph",
+					"DIAG: 3>Map previous operation graph observed results",
+					"INFO: 3>Create Directory: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"INFO: 3>Done",
+					"DIAG: 2>Running Build: [C++]User1|PackageA",
+					"INFO: 2>Build 'User1|PackageA'",
 					"INFO: 2>Checking for existing Evaluate Operation Graph",
-					"DIAG: 2>C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bog",
+					"DIAG: 2>C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
 					"INFO: 2>Previous graph found",
 					"INFO: 2>Checking for existing Evaluate Operation Results",
-					"DIAG: 2>C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bor",
+					"DIAG: 2>C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
 					"INFO: 2>Operation results file does not exist",
 					"INFO: 2>No previous results found",
-					"INFO: 2>Create Directory: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/",
-					"INFO: 2>Check outdated generate input file: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/GenerateInput.bvt",
+					"INFO: 2>Create Directory: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
+					"INFO: 2>Check outdated generate input file: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt",
 					"INFO: 2>Value Table file does not exist",
 					"INFO: 2>Save Generate Input file",
 					"INFO: 2>Checking for existing Generate Operation Results",
-					"DIAG: 2>C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Generate.bor",
+					"DIAG: 2>C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor",
 					"INFO: 2>Operation results file does not exist",
 					"INFO: 2>No previous results found",
 					"INFO: 2>Loading new Evaluate Operation Graph",
 					"DIAG: 2>Map previous operation graph observed results",
-					"INFO: 2>Create Directory: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
-					"INFO: 2>Saving updated build state",
+					"INFO: 2>Create Directory: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"INFO: 2>Done",
 					"DIAG: 1>Running Build: [C++]MyPackage",
 					"INFO: 1>Build 'MyPackage'",
@@ -1817,7 +1383,6 @@ namespace Soup::Core::UnitTests
 					"INFO: 1>Loading new Evaluate Operation Graph",
 					"DIAG: 1>Map previous operation graph observed results",
 					"INFO: 1>Create Directory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
-					"INFO: 1>Saving updated build state",
 					"INFO: 1>Done",
 				}),
 				testListener->GetMessages(),
@@ -1826,31 +1391,58 @@ namespace Soup::Core::UnitTests
 			// Verify expected file system requests
 			Assert::AreEqual(
 				std::vector<std::string>({
-					"Exists: C:/Users/Me/.soup/packages/C#/TestBuild/RootRecipe.sml",
-					"Exists: C:/Users/Me/.soup/packages/C#/RootRecipe.sml",
+					"Exists: C:/Users/Me/.soup/packages/C++/User1/PackageB/RootRecipe.sml",
+					"Exists: C:/Users/Me/.soup/packages/C++/User1/RootRecipe.sml",
+					"Exists: C:/Users/Me/.soup/packages/C++/RootRecipe.sml",
 					"Exists: C:/Users/Me/.soup/packages/RootRecipe.sml",
 					"Exists: C:/Users/Me/.soup/RootRecipe.sml",
 					"Exists: C:/Users/Me/RootRecipe.sml",
 					"Exists: C:/Users/RootRecipe.sml",
 					"Exists: C:/RootRecipe.sml",
-					"TryGetDirectoryFilesLastWriteTime: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bog",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bor",
-					"Exists: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/",
-					"CreateDirectory: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/GenerateInput.bvt",
-					"OpenWriteBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/GenerateInput.bvt",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Generate.bor",
-					"OpenWriteBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Generate.bor",
-					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bog",
-					"Exists: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
-					"CreateDirectory: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
-					"OpenWriteBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bor",
+					"TryGetDirectoryFilesLastWriteTime: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.brj",
+					"Exists: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
+					"CreateDirectory: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
+					"Exists: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"CreateDirectory: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.brj",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
+					"Exists: C:/Users/Me/.soup/packages/C++/User1/PackageA/RootRecipe.sml",
+					"Exists: C:/Users/Me/.soup/packages/C++/User1/RootRecipe.sml",
+					"Exists: C:/Users/Me/.soup/packages/C++/RootRecipe.sml",
+					"Exists: C:/Users/Me/.soup/packages/RootRecipe.sml",
+					"Exists: C:/Users/Me/.soup/RootRecipe.sml",
+					"Exists: C:/Users/Me/RootRecipe.sml",
+					"Exists: C:/Users/RootRecipe.sml",
+					"Exists: C:/RootRecipe.sml",
+					"TryGetDirectoryFilesLastWriteTime: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.brj",
+					"Exists: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
+					"CreateDirectory: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
+					"Exists: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"CreateDirectory: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.brj",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
 					"Exists: C:/WorkingDirectory/RootRecipe.sml",
 					"Exists: C:/RootRecipe.sml",
 					"TryGetDirectoryFilesLastWriteTime: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/",
 					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
 					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
+					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.brj",
 					"Exists: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
 					"CreateDirectory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
 					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt",
@@ -1860,6 +1452,7 @@ namespace Soup::Core::UnitTests
 					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
 					"Exists: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"CreateDirectory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.brj",
 					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
 				}),
 				fileSystem->GetRequests(),
@@ -1870,6 +1463,7 @@ namespace Soup::Core::UnitTests
 				std::vector<std::string>({
 					"GetCurrentProcessFileName",
 					"GetCurrentProcessFileName",
+					"GetCurrentProcessFileName",
 				}),
 				processManager->GetRequests(),
 				"Verify process manager requests match expected.");
@@ -1877,8 +1471,10 @@ namespace Soup::Core::UnitTests
 			// Verify expected evaluate requests
 			Assert::AreEqual(
 				std::vector<std::string>({
-					"Evaluate: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
-					"Evaluate: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
+					"Evaluate: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"Evaluate: C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"Evaluate: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"Evaluate: C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"Evaluate: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 					"Evaluate: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
 				}),
@@ -1886,41 +1482,61 @@ namespace Soup::Core::UnitTests
 				"Verify evaluate requests match expected.");
 
 			// Verify files
-			auto testBuildGenerateInputMockFile = fileSystem->GetMockFile(
-				Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/GenerateInput.bvt"));
+			auto packageAGenerateInputMockFile = fileSystem->GetMockFile(
+				Path("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt"));
 			Assert::AreEqual(
 				ValueTable(
 				{
 					{
 						"Dependencies",
-						ValueTable()
+						ValueTable(
+						{
+							{
+								"Runtime",
+								ValueTable(
+								{
+									{
+										"User1|PackageB",
+										ValueTable(
+										{
+											{ "SoupTargetDirectory", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/") },
+										})
+									},
+								})
+							},
+						})
 					},
 					{
 						"EvaluateMacros",
 						ValueTable(
 						{
-							{ "/(PACKAGE_User1|TestBuild)/", std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/") },
-							{ "/(TARGET_User1|TestBuild)/", std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/") },
+							{ "/(PACKAGE_User1|PackageA)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/") },
+							{ "/(TARGET_User1|PackageA)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
+							{ "/(TARGET_User1|PackageB)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
 						})
 					},
 					{
 						"EvaluateReadAccess",
 						ValueList(
 						{
-							std::string("/(PACKAGE_User1|TestBuild)/"),
-							std::string("/(TARGET_User1|TestBuild)/"),
+							std::string("/(PACKAGE_User1|PackageA)/"),
+							std::string("/(TARGET_User1|PackageA)/"),
+							std::string("/(TARGET_User1|PackageB)/"),
 						})
 					},
 					{
 						"EvaluateWriteAccess",
 						ValueList(
 						{
-							std::string("/(TARGET_User1|TestBuild)/"),
+							std::string("/(TARGET_User1|PackageA)/"),
 						})
 					},
 					{
 						"GenerateMacros",
-						ValueTable()
+						ValueTable(
+						{
+							{ "/(TARGET_User1|PackageB)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
+						})
 					},
 					{
 						"GenerateSubGraphMacros",
@@ -1935,11 +1551,36 @@ namespace Soup::Core::UnitTests
 								ValueTable(
 								{
 									{ "HostPlatform", std::string("TestPlatform") },
-									{ "PackageDirectory", std::string("/(PACKAGE_User1|TestBuild)/") },
-									{ "TargetDirectory", std::string("/(TARGET_User1|TestBuild)/") },
+									{ "PackageDirectory", std::string("/(PACKAGE_User1|PackageA)/") },
+									{ "TargetDirectory", std::string("/(TARGET_User1|PackageA)/") },
+								})
+							},
+							{
+								"Dependencies",
+								ValueTable(
+								{
+									{
+										"Runtime",
+										ValueTable(
+										{
+											{
+												"User1|PackageB",
+												ValueTable(
+												{
+													{
+														"Context",
+														ValueTable(
+														{
+															{ "Reference", std::string("User1|PackageB@1.1.1") },
+															{ "TargetDirectory", std::string("/(TARGET_User1|PackageB)/") },
+														})
+													},
+												})
+											},
+										})
+									},
 								})
 							},
-							{ "Dependencies", ValueTable() },
 							{
 								"FileSystem",
 								ValueList({
@@ -1950,26 +1591,26 @@ namespace Soup::Core::UnitTests
 								"Parameters",
 								ValueTable(
 								{
-									{ "HostValue", true },
+									{ "ArgumentValue", true },
 								})
 							},
 						})
 					},
 					{
 						"PackageRoot",
-						std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/")
+						std::string("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/")
 					},
 					{
 						"UserDataPath",
 						std::string("C:/Users/Me/.soup/")
 					},
 				}),
-				ValueTableReader::Deserialize(testBuildGenerateInputMockFile->Content),
+				ValueTableReader::Deserialize(packageAGenerateInputMockFile->Content),
 				"Verify file content match expected.");
 
-			auto testBuildGenerateResultsMockFile = fileSystem->GetMockFile(
-				Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Generate.bor"));
-			auto testBuildGenerateResults = OperationResultsReader::Deserialize(testBuildGenerateResultsMockFile->Content, fileSystemState);
+			auto packageAGenerateResultsMockFile = fileSystem->GetMockFile(
+				Path("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor"));
+			auto packageAGenerateResults = OperationResultsReader::Deserialize(packageAGenerateResultsMockFile->Content, fileSystemState);
 
 			Assert::AreEqual(
 				OperationResults({
@@ -1982,69 +1623,48 @@ namespace Soup::Core::UnitTests
 							{})
 					},
 				}),
-				testBuildGenerateResults,
-				"Verify test build generate results content match expected.");
+				packageAGenerateResults,
+				"Verify package A generate results content match expected.");
 
-			auto myPackageGenerateInputMockFile = fileSystem->GetMockFile(
-				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt"));
+			auto packageBGenerateInputMockFile = fileSystem->GetMockFile(
+				Path("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt"));
 			Assert::AreEqual(
 				ValueTable(
 				{
 					{
 						"Dependencies",
-						ValueTable(
-						{
-							{
-								"Build",
-								ValueTable(
-								{
-									{
-										"User1|TestBuild",
-										ValueTable(
-										{
-											{ "SoupTargetDirectory", std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/") },
-										})
-									},
-								})
-							},
-						})
+						ValueTable()
 					},
 					{
 						"EvaluateMacros",
 						ValueTable(
 						{
-							{ "/(PACKAGE_MyPackage)/", std::string("C:/WorkingDirectory/MyPackage/") },
-							{ "/(TARGET_MyPackage)/", std::string("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
+							{ "/(PACKAGE_User1|PackageB)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/") },
+							{ "/(TARGET_User1|PackageB)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
 						})
 					},
 					{
 						"EvaluateReadAccess",
 						ValueList(
 						{
-							std::string("/(PACKAGE_MyPackage)/"),
-							std::string("/(TARGET_MyPackage)/"),
+							std::string("/(PACKAGE_User1|PackageB)/"),
+							std::string("/(TARGET_User1|PackageB)/"),
 						})
 					},
 					{
 						"EvaluateWriteAccess",
 						ValueList(
 						{
-							std::string("/(TARGET_MyPackage)/"),
+							std::string("/(TARGET_User1|PackageB)/"),
 						})
 					},
 					{
 						"GenerateMacros",
-						ValueTable(
-						{
-							{ "/(BUILD_TARGET_User1|TestBuild)/", std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/") },
-						})
+						ValueTable()
 					},
 					{
 						"GenerateSubGraphMacros",
-						ValueTable(
-						{
-							{ "/(TARGET_User1|TestBuild)/", std::string("/(BUILD_TARGET_User1|TestBuild)/") },
-						})
+						ValueTable()
 					},
 					{
 						"GlobalState",
@@ -2055,28 +1675,171 @@ namespace Soup::Core::UnitTests
 								ValueTable(
 								{
 									{ "HostPlatform", std::string("TestPlatform") },
-									{ "PackageDirectory", std::string("/(PACKAGE_MyPackage)/") },
-									{ "TargetDirectory", std::string("/(TARGET_MyPackage)/") },
+									{ "PackageDirectory", std::string("/(PACKAGE_User1|PackageB)/") },
+									{ "TargetDirectory", std::string("/(TARGET_User1|PackageB)/") },
 								})
 							},
+							{ "Dependencies", ValueTable() },
 							{
-								"Dependencies",
-								ValueTable(
-								{
-									{
-										"Build",
+								"FileSystem",
+								ValueList({
+									std::string("Recipe.sml"),
+								})
+							},
+							{
+								"Parameters",
+								ValueTable(
+								{
+									{ "ArgumentValue", true },
+								})
+							},
+						})
+					},
+					{
+						"PackageRoot",
+						std::string("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/")
+					},
+					{
+						"UserDataPath",
+						std::string("C:/Users/Me/.soup/")
+					},
+				}),
+				ValueTableReader::Deserialize(packageBGenerateInputMockFile->Content),
+				"Verify file content match expected.");
+
+			auto packageBGenerateResultsMockFile = fileSystem->GetMockFile(
+				Path("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor"));
+			auto packageBGenerateResults = OperationResultsReader::Deserialize(packageBGenerateResultsMockFile->Content, fileSystemState);
+
+			Assert::AreEqual(
+				OperationResults({
+					{
+						1,
+						OperationResult(
+							true,
+							GetEpochTime(),
+							{},
+							{})
+					},
+				}),
+				packageBGenerateResults,
+				"Verify package B generate results content match expected.");
+
+			auto myPackageGenerateInputMockFile = fileSystem->GetMockFile(
+				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt"));
+			Assert::AreEqual(
+				ValueTable(
+				{
+					{
+						"Dependencies",
+						ValueTable(
+						{
+							{
+								"Runtime",
+								ValueTable(
+								{
+									{
+										"User1|PackageA",
+										ValueTable(
+										{
+											{ "SoupTargetDirectory", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/") },
+										})
+									},
+									{
+										"User1|PackageB",
+										ValueTable(
+										{
+											{ "SoupTargetDirectory", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/") },
+										})
+									},
+								})
+							},
+						})
+					},
+					{
+						"EvaluateMacros",
+						ValueTable(
+						{
+							{ "/(PACKAGE_MyPackage)/", std::string("C:/WorkingDirectory/MyPackage/") },
+							{ "/(TARGET_MyPackage)/", std::string("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
+							{ "/(TARGET_User1|PackageA)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
+							{ "/(TARGET_User1|PackageB)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
+						})
+					},
+					{
+						"EvaluateReadAccess",
+						ValueList(
+						{
+							std::string("/(PACKAGE_MyPackage)/"),
+							std::string("/(TARGET_MyPackage)/"),
+							std::string("/(TARGET_User1|PackageA)/"),
+							std::string("/(TARGET_User1|PackageB)/"),
+						})
+					},
+					{
+						"EvaluateWriteAccess",
+						ValueList(
+						{
+							std::string("/(TARGET_MyPackage)/"),
+						})
+					},
+					{
+						"GenerateMacros",
+						ValueTable(
+						{
+							{ "/(TARGET_User1|PackageA)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageA/1.2.3/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
+							{ "/(TARGET_User1|PackageB)/", std::string("C:/Users/Me/.soup/packages/C++/User1/PackageB/1.1.1/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
+						})
+					},
+					{
+						"GenerateSubGraphMacros",
+						ValueTable()
+					},
+					{
+						"GlobalState",
+						ValueTable(
+						{
+							{
+								"Context",
+								ValueTable(
+								{
+									{ "HostPlatform", std::string("TestPlatform") },
+									{ "PackageDirectory", std::string("/(PACKAGE_MyPackage)/") },
+									{ "TargetDirectory", std::string("/(TARGET_MyPackage)/") },
+								})
+							},
+							{
+								"Dependencies",
+								ValueTable(
+								{
+									{
+										"Runtime",
 										ValueTable(
 										{
 											{
-												"User1|TestBuild",
+												"User1|PackageA",
 												ValueTable(
 												{
 													{
 														"Context",
 														ValueTable(
 														{
-															{ "Reference", std::string("User1|TestBuild@1.2.3") },
-															{ "TargetDirectory", std::string("/(TARGET_User1|TestBuild)/") },
+															{ "Reference", std::string("User1|PackageA@1.2.3") },
+															{ "TargetDirectory", std::string("/(TARGET_User1|PackageA)/") },
+														})
+													},
+												})
+											},
+											{
+												"User1|PackageB",
+												ValueTable(
+												{
+													{
+														"Context",
+														ValueTable(
+														{
+															{ "Reference", std::string("User1|PackageB@1.1.1") },
+															{ "TargetDirectory", std::string("/(TARGET_User1|PackageB)/") },
 														})
 													},
 												})
@@ -2131,11 +1894,976 @@ namespace Soup::Core::UnitTests
 				"Verify my package generate results content match expected.");
 		}
 
-	private:
-		static std::chrono::time_point<std::chrono::file_clock> GetEpochTime()
+		// [[Fact]]
+		void Execute_PackageLock_OverrideBuildDependency()
 		{
-			return std::chrono::clock_cast<std::chrono::file_clock>(
-				std::chrono::time_point<std::chrono::system_clock>());
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState(
+				0,
+				{},
+				TestHelpers::BuildDirectoryLookup({
+					Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/Recipe.sml"),
+					Path("C:/WorkingDirectory/MyPackage/Recipe.sml"),
+				}),
+				{});
+
+			fileSystem->CreateMockDirectory(
+				Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/"),
+				std::make_shared<MockDirectory>(std::vector<Path>({})));
+
+			fileSystem->CreateMockDirectory(
+				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/"),
+				std::make_shared<MockDirectory>(std::vector<Path>({})));
+
+			// Create the package lock
+			fileSystem->CreateMockFile(
+				Path("C:/WorkingDirectory/MyPackage/PackageLock.sml"),
+				std::make_shared<MockFile>(std::stringstream(R"(
+					Version: 5
+					Closures: {
+						Root: {
+							"C#": {
+								"User1|TestBuild": { Version: "1.3.0", Build: "Build1" }
+							}
+							"C++": {
+								MyPackage: { Version: "../MyPackage/", Build: "Build0" }
+							}
+						}
+						Build0: {
+							"C#": {
+								"User1|Cpp": { Version: "1.0.2" }
+								"User1|TestBuild": { Version: "1.3.0" }
+							}
+						}
+						Build1: {
+							"C#": {
+								"User1|Soup.CSharp": { Version: "1.0.1" }
+							}
+						}
+					}
+				)")));
+
+			auto myProjectOperationGraph = OperationGraph(
+				std::vector<OperationId>(),
+				std::vector<OperationInfo>());
+			auto myProjectOperationGraphFiles = std::set<FileId>();
+			auto myProjectOperationGraphContent = std::stringstream();
+			OperationGraphWriter::Serialize(myProjectOperationGraph, myProjectOperationGraphFiles, fileSystemState, myProjectOperationGraphContent);
+			fileSystem->CreateMockFile(
+				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog"),
+				std::make_shared<MockFile>(std::move(myProjectOperationGraphContent)));
+
+			auto testBuildOperationGraph = OperationGraph(
+				std::vector<OperationId>(),
+				std::vector<OperationInfo>());
+			auto testBuildOperationGraphFiles = std::set<FileId>();
+			auto testBuildOperationGraphContent = std::stringstream();
+			OperationGraphWriter::Serialize(testBuildOperationGraph, testBuildOperationGraphFiles, fileSystemState, testBuildOperationGraphContent);
+			fileSystem->CreateMockFile(
+				Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bog"),
+				std::make_shared<MockFile>(std::move(testBuildOperationGraphContent)));
+
+			// Register the test process manager
+			auto processManager = std::make_shared<MockProcessManager>();
+			auto scopedProcessManager = ScopedProcessManagerRegister(processManager);
+
+			auto arguments = RecipeBuildArguments();
+			arguments.HostPlatform = "TestPlatform";
+			arguments.WorkingDirectory = Path("C:/WorkingDirectory/MyPackage/");
+			auto userDataPath = Path("C:/Users/Me/.soup/");
+			auto systemReadAccess = std::vector<Path>({
+				Path("C:/FakeSystem/"),
+			});
+			auto recipeCache = RecipeCache({
+				{
+					"C:/WorkingDirectory/MyPackage/Recipe.sml",
+					Recipe(RecipeTable(
+					{
+						{ "Name", "MyPackage" },
+						{ "Language", "C++|1" },
+						{ "Version", "1.0.0" },
+						{
+							"Dependencies",
+							RecipeTable(
+							{
+								{ "Build", RecipeList({ "User1|TestBuild@1.2.3" }) },
+							})
+						},
+					}))
+				},
+				{
+					"C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/Recipe.sml",
+					Recipe(RecipeTable(
+					{
+						{ "Name", "TestBuild" },
+						{ "Language", "C#|1" },
+						{ "Version", "1.3.0" },
+					}))
+				},
+			});
+			auto packageProvider = PackageProvider(
+				1,
+				PackageGraphLookupMap(
+				{
+					{
+						1,
+						PackageGraph(
+							1,
+							1,
+							ValueTable(
+							{
+								{ "ArgumentValue", Value(true) },
+							}))
+					},
+					{
+						2,
+						PackageGraph(
+							2,
+							2,
+							ValueTable(
+							{
+								{ "HostValue", Value(true) },
+							}))
+					},
+				}),
+				PackageLookupMap(
+				{
+					{
+						1,
+						PackageInfo(
+							1,
+							PackageName(std::nullopt, "MyPackage"),
+							false,
+							Path("C:/WorkingDirectory/MyPackage/"),
+							Path(),
+							&recipeCache.GetRecipe(Path("C:/WorkingDirectory/MyPackage/Recipe.sml")),
+							PackageChildrenMap({
+								{
+									"Build",
+									{
+										PackageChildInfo(PackageReference(std::nullopt, "User1", "TestBuild", SemanticVersion(1, 2, 3)), true, -1, 2),
+									}
+								},
+							}))
+					},
+					{
+						2,
+						PackageInfo(
+							2,
+							PackageName("User1", "TestBuild"),
+							false,
+							Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/"),
+							Path(),
+							&recipeCache.GetRecipe(Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/Recipe.sml")),
+							PackageChildrenMap())
+					},
+				}));
+			auto evaluateEngine = MockEvaluateEngine();
+			auto knownLanguages = std::map<std::string, KnownLanguage>();
+			auto locationManager = RecipeBuildLocationManager(knownLanguages);
+			auto stateLock = BuildStateLock();
+			auto uut = BuildRunner(
+				arguments,
+				userDataPath,
+				systemReadAccess,
+				recipeCache,
+				packageProvider,
+				evaluateEngine,
+				fileSystemState,
+				locationManager,
+				stateLock);
+			uut.Execute();
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: 2>Running Build: [C#]User1|TestBuild",
+					"INFO: 2>Build 'User1|TestBuild'",
+					"INFO: 2>Checking for existing Evaluate Operation Graph",
+					"DIAG: 2>C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bog",
+					"INFO: 2>Previous graph found",
+					"INFO: 2>Checking for existing Evaluate Operation Results",
+					"DIAG: 2>C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bor",
+					"INFO: 2>Operation results file does not exist",
+					"INFO: 2>No previous results found",
+					"INFO: 2>Create Directory: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/",
+					"INFO: 2>Check outdated generate input file: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/GenerateInput.bvt",
+					"INFO: 2>Value Table file does not exist",
+					"INFO: 2>Save Generate Input file",
+					"INFO: 2>Checking for existing Generate Operation Results",
+					"DIAG: 2>C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Generate.bor",
+					"INFO: 2>Operation results file does not exist",
+					"INFO: 2>No previous results found",
+					"INFO: 2>Loading new Evaluate Operation Graph",
+					"DIAG: 2>Map previous operation graph observed results",
+					"INFO: 2>Create Directory: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
+					"INFO: 2>Done",
+					"DIAG: 1>Running Build: [C++]MyPackage",
+					"INFO: 1>Build 'MyPackage'",
+					"INFO: 1>Checking for existing Evaluate Operation Graph",
+					"DIAG: 1>C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
+					"INFO: 1>Previous graph found",
+					"INFO: 1>Checking for existing Evaluate Operation Results",
+					"DIAG: 1>C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
+					"INFO: 1>Operation results file does not exist",
+					"INFO: 1>No previous results found",
+					"INFO: 1>Create Directory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
+					"INFO: 1>Check outdated generate input file: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt",
+					"INFO: 1>Value Table file does not exist",
+					"INFO: 1>Save Generate Input file",
+					"INFO: 1>Checking for existing Generate Operation Results",
+					"DIAG: 1>C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor",
+					"INFO: 1>Operation results file does not exist",
+					"INFO: 1>No previous results found",
+					"INFO: 1>Loading new Evaluate Operation Graph",
+					"DIAG: 1>Map previous operation graph observed results",
+					"INFO: 1>Create Directory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"INFO: 1>Done",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"Exists: C:/Users/Me/.soup/packages/C#/TestBuild/RootRecipe.sml",
+					"Exists: C:/Users/Me/.soup/packages/C#/RootRecipe.sml",
+					"Exists: C:/Users/Me/.soup/packages/RootRecipe.sml",
+					"Exists: C:/Users/Me/.soup/RootRecipe.sml",
+					"Exists: C:/Users/Me/RootRecipe.sml",
+					"Exists: C:/Users/RootRecipe.sml",
+					"Exists: C:/RootRecipe.sml",
+					"TryGetDirectoryFilesLastWriteTime: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bog",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bor",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.brj",
+					"Exists: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/",
+					"CreateDirectory: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/GenerateInput.bvt",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/GenerateInput.bvt",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Generate.bor",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Generate.bor",
+					"TryOpenReadBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bog",
+					"Exists: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
+					"CreateDirectory: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.brj",
+					"OpenWriteBinary: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Evaluate.bor",
+					"Exists: C:/WorkingDirectory/RootRecipe.sml",
+					"Exists: C:/RootRecipe.sml",
+					"TryGetDirectoryFilesLastWriteTime: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/",
+					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
+					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
+					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.brj",
+					"Exists: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
+					"CreateDirectory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/",
+					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt",
+					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt",
+					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor",
+					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor",
+					"TryOpenReadBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bog",
+					"Exists: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"CreateDirectory: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.brj",
+					"OpenWriteBinary: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Evaluate.bor",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			// Verify expected process requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"GetCurrentProcessFileName",
+					"GetCurrentProcessFileName",
+				}),
+				processManager->GetRequests(),
+				"Verify process manager requests match expected.");
+
+			// Verify expected evaluate requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"Evaluate: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
+					"Evaluate: C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/temp/",
+					"Evaluate: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+					"Evaluate: C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/",
+				}),
+				evaluateEngine.GetRequests(),
+				"Verify evaluate requests match expected.");
+
+			// Verify files
+			auto testBuildGenerateInputMockFile = fileSystem->GetMockFile(
+				Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/GenerateInput.bvt"));
+			Assert::AreEqual(
+				ValueTable(
+				{
+					{
+						"Dependencies",
+						ValueTable()
+					},
+					{
+						"EvaluateMacros",
+						ValueTable(
+						{
+							{ "/(PACKAGE_User1|TestBuild)/", std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/") },
+							{ "/(TARGET_User1|TestBuild)/", std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/") },
+						})
+					},
+					{
+						"EvaluateReadAccess",
+						ValueList(
+						{
+							std::string("/(PACKAGE_User1|TestBuild)/"),
+							std::string("/(TARGET_User1|TestBuild)/"),
+						})
+					},
+					{
+						"EvaluateWriteAccess",
+						ValueList(
+						{
+							std::string("/(TARGET_User1|TestBuild)/"),
+						})
+					},
+					{
+						"GenerateMacros",
+						ValueTable()
+					},
+					{
+						"GenerateSubGraphMacros",
+						ValueTable()
+					},
+					{
+						"GlobalState",
+						ValueTable(
+						{
+							{
+								"Context",
+								ValueTable(
+								{
+									{ "HostPlatform", std::string("TestPlatform") },
+									{ "PackageDirectory", std::string("/(PACKAGE_User1|TestBuild)/") },
+									{ "TargetDirectory", std::string("/(TARGET_User1|TestBuild)/") },
+								})
+							},
+							{ "Dependencies", ValueTable() },
+							{
+								"FileSystem",
+								ValueList({
+									std::string("Recipe.sml"),
+								})
+							},
+							{
+								"Parameters",
+								ValueTable(
+								{
+									{ "HostValue", true },
+								})
+							},
+						})
+					},
+					{
+						"PackageRoot",
+						std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/")
+					},
+					{
+						"UserDataPath",
+						std::string("C:/Users/Me/.soup/")
+					},
+				}),
+				ValueTableReader::Deserialize(testBuildGenerateInputMockFile->Content),
+				"Verify file content match expected.");
+
+			auto testBuildGenerateResultsMockFile = fileSystem->GetMockFile(
+				Path("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/Generate.bor"));
+			auto testBuildGenerateResults = OperationResultsReader::Deserialize(testBuildGenerateResultsMockFile->Content, fileSystemState);
+
+			Assert::AreEqual(
+				OperationResults({
+					{
+						1,
+						OperationResult(
+							true,
+							GetEpochTime(),
+							{},
+							{})
+					},
+				}),
+				testBuildGenerateResults,
+				"Verify test build generate results content match expected.");
+
+			auto myPackageGenerateInputMockFile = fileSystem->GetMockFile(
+				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/GenerateInput.bvt"));
+			Assert::AreEqual(
+				ValueTable(
+				{
+					{
+						"Dependencies",
+						ValueTable(
+						{
+							{
+								"Build",
+								ValueTable(
+								{
+									{
+										"User1|TestBuild",
+										ValueTable(
+										{
+											{ "SoupTargetDirectory", std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/.soup/") },
+										})
+									},
+								})
+							},
+						})
+					},
+					{
+						"EvaluateMacros",
+						ValueTable(
+						{
+							{ "/(PACKAGE_MyPackage)/", std::string("C:/WorkingDirectory/MyPackage/") },
+							{ "/(TARGET_MyPackage)/", std::string("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/") },
+						})
+					},
+					{
+						"EvaluateReadAccess",
+						ValueList(
+						{
+							std::string("/(PACKAGE_MyPackage)/"),
+							std::string("/(TARGET_MyPackage)/"),
+						})
+					},
+					{
+						"EvaluateWriteAccess",
+						ValueList(
+						{
+							std::string("/(TARGET_MyPackage)/"),
+						})
+					},
+					{
+						"GenerateMacros",
+						ValueTable(
+						{
+							{ "/(BUILD_TARGET_User1|TestBuild)/", std::string("C:/Users/Me/.soup/packages/C#/TestBuild/1.3.0/out/zDqRc65c9x3jySpevCCCyZ15fGs/") },
+						})
+					},
+					{
+						"GenerateSubGraphMacros",
+						ValueTable(
+						{
+							{ "/(TARGET_User1|TestBuild)/", std::string("/(BUILD_TARGET_User1|TestBuild)/") },
+						})
+					},
+					{
+						"GlobalState",
+						ValueTable(
+						{
+							{
+								"Context",
+								ValueTable(
+								{
+									{ "HostPlatform", std::string("TestPlatform") },
+									{ "PackageDirectory", std::string("/(PACKAGE_MyPackage)/") },
+									{ "TargetDirectory", std::string("/(TARGET_MyPackage)/") },
+								})
+							},
+							{
+								"Dependencies",
+								ValueTable(
+								{
+									{
+										"Build",
+										ValueTable(
+										{
+											{
+												"User1|TestBuild",
+												ValueTable(
+												{
+													{
+														"Context",
+														ValueTable(
+														{
+															{ "Reference", std::string("User1|TestBuild@1.2.3") },
+															{ "TargetDirectory", std::string("/(TARGET_User1|TestBuild)/") },
+														})
+													},
+												})
+											},
+										})
+									},
+								})
+							},
+							{
+								"FileSystem",
+								ValueList({
+									std::string("Recipe.sml"),
+								})
+							},
+							{
+								"Parameters",
+								ValueTable(
+								{
+									{ "ArgumentValue", true },
+								})
+							},
+						})
+					},
+					{
+						"PackageRoot",
+						std::string("C:/WorkingDirectory/MyPackage/")
+					},
+					{
+						"UserDataPath",
+						std::string("C:/Users/Me/.soup/")
+					},
+				}),
+				ValueTableReader::Deserialize(myPackageGenerateInputMockFile->Content),
+				"Verify file content match expected.");
+
+			auto myPackageGenerateResultsMockFile = fileSystem->GetMockFile(
+				Path("C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/.soup/Generate.bor"));
+			auto myPackageGenerateResults = OperationResultsReader::Deserialize(myPackageGenerateResultsMockFile->Content, fileSystemState);
+
+			Assert::AreEqual(
+				OperationResults({
+					{
+						1,
+						OperationResult(
+							true,
+							GetEpochTime(),
+							{},
+							{})
+					},
+				}),
+				myPackageGenerateResults,
+				"Verify my package generate results content match expected.");
+		}
+
+		// [[Fact]]
+		void Execute_MultipleJobs_DiamondDependency()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState(
+				0,
+				{},
+				TestHelpers::BuildDirectoryLookup({
+					Path("C:/WorkingDirectory/MyPackage/Recipe.sml"),
+					Path("C:/WorkingDirectory/PackageA/Recipe.sml"),
+					Path("C:/WorkingDirectory/PackageB/Recipe.sml"),
+					Path("C:/WorkingDirectory/PackageC/Recipe.sml"),
+				}),
+				{});
+
+			for (auto packageName : { "MyPackage", "PackageA", "PackageB", "PackageC" })
+			{
+				auto targetDirectory = Path(std::format("C:/WorkingDirectory/{}/out/zxAcy-Et010fdZUKLgFemwwWuC8/", packageName));
+				fileSystem->CreateMockDirectory(
+					targetDirectory,
+					std::make_shared<MockDirectory>(std::vector<Path>({})));
+
+				auto operationGraph = OperationGraph(
+					std::vector<OperationId>(),
+					std::vector<OperationInfo>());
+				auto operationGraphFiles = std::set<FileId>();
+				auto operationGraphContent = std::stringstream();
+				OperationGraphWriter::Serialize(operationGraph, operationGraphFiles, fileSystemState, operationGraphContent);
+				fileSystem->CreateMockFile(
+					targetDirectory + Path("./.soup/Evaluate.bog"),
+					std::make_shared<MockFile>(std::move(operationGraphContent)));
+			}
+
+			// Register the test process manager
+			auto processManager = std::make_shared<MockProcessManager>();
+			auto scopedProcessManager = ScopedProcessManagerRegister(processManager);
+
+			auto arguments = RecipeBuildArguments();
+			arguments.HostPlatform = "TestPlatform";
+			arguments.WorkingDirectory = Path("C:/WorkingDirectory/MyPackage/");
+			arguments.MaxJobs = 4;
+			auto userDataPath = Path("C:/Users/Me/.soup/");
+			auto systemReadAccess = std::vector<Path>({
+				Path("C:/FakeSystem/"),
+			});
+			auto recipeCache = RecipeCache({
+				{
+					"C:/WorkingDirectory/MyPackage/Recipe.sml",
+					Recipe(RecipeTable(
+					{
+						{ "Name", "MyPackage" },
+						{ "Language", "C++|1" },
+						{ "Version", "1.0.0" },
+						{
+							"Dependencies",
+							RecipeTable(
+							{
+								{ "Runtime", RecipeList({ "../PackageA/", "../PackageB/" }) },
+							})
+						},
+					}))
+				},
+				{
+					"C:/WorkingDirectory/PackageA/Recipe.sml",
+					Recipe(RecipeTable(
+					{
+						{ "Name", "PackageA" },
+						{ "Language", "C++|1" },
+						{ "Version", "1.0.0" },
+						{
+							"Dependencies",
+							RecipeTable(
+							{
+								{ "Runtime", RecipeList({ "../PackageC/" }) },
+							})
+						},
+					}))
+				},
+				{
+					"C:/WorkingDirectory/PackageB/Recipe.sml",
+					Recipe(RecipeTable(
+					{
+						{ "Name", "PackageB" },
+						{ "Language", "C++|1" },
+						{ "Version", "1.0.0" },
+						{
+							"Dependencies",
+							RecipeTable(
+							{
+								{ "Runtime", RecipeList({ "../PackageC/" }) },
+							})
+						},
+					}))
+				},
+				{
+					"C:/WorkingDirectory/PackageC/Recipe.sml",
+					Recipe(RecipeTable(
+					{
+						{ "Name", "PackageC" },
+						{ "Language", "C++|1" },
+						{ "Version", "1.0.0" },
+					}))
+				},
+			});
+			auto packageProvider = PackageProvider(
+				1,
+				PackageGraphLookupMap(
+				{
+					{
+						1,
+						PackageGraph(
+							1,
+							1,
+							ValueTable(
+							{
+								{ "ArgumentValue", Value(true) },
+							}))
+					},
+				}),
+				PackageLookupMap(
+				{
+					{
+						1,
+						PackageInfo(
+							1,
+							PackageName(std::nullopt, "MyPackage"),
+							false,
+							Path("C:/WorkingDirectory/MyPackage/"),
+							Path(),
+							&recipeCache.GetRecipe(Path("C:/WorkingDirectory/MyPackage/Recipe.sml")),
+							PackageChildrenMap({
+								{
+									"Runtime",
+									{
+										PackageChildInfo(PackageReference(Path("../PackageA/")), false, 2, -1),
+										PackageChildInfo(PackageReference(Path("../PackageB/")), false, 3, -1),
+									}
+								},
+							}))
+					},
+					{
+						2,
+						PackageInfo(
+							2,
+							PackageName(std::nullopt, "PackageA"),
+							false,
+							Path("C:/WorkingDirectory/PackageA/"),
+							Path(),
+							&recipeCache.GetRecipe(Path("C:/WorkingDirectory/PackageA/Recipe.sml")),
+							PackageChildrenMap({
+								{
+									"Runtime",
+									{
+										PackageChildInfo(PackageReference(Path("../PackageC/")), false, 4, -1),
+									}
+								},
+							}))
+					},
+					{
+						3,
+						PackageInfo(
+							3,
+							PackageName(std::nullopt, "PackageB"),
+							false,
+							Path("C:/WorkingDirectory/PackageB/"),
+							Path(),
+							&recipeCache.GetRecipe(Path("C:/WorkingDirectory/PackageB/Recipe.sml")),
+							PackageChildrenMap({
+								{
+									"Runtime",
+									{
+										PackageChildInfo(PackageReference(Path("../PackageC/")), false, 4, -1),
+									}
+								},
+							}))
+					},
+					{
+						4,
+						PackageInfo(
+							4,
+							PackageName(std::nullopt, "PackageC"),
+							false,
+							Path("C:/WorkingDirectory/PackageC/"),
+							Path(),
+							&recipeCache.GetRecipe(Path("C:/WorkingDirectory/PackageC/Recipe.sml")),
+							PackageChildrenMap())
+					},
+				}));
+			auto evaluateEngine = MockEvaluateEngine();
+			auto knownLanguages = std::map<std::string, KnownLanguage>();
+			auto locationManager = RecipeBuildLocationManager(knownLanguages);
+			auto stateLock = BuildStateLock();
+			auto uut = BuildRunner(
+				arguments,
+				userDataPath,
+				systemReadAccess,
+				recipeCache,
+				packageProvider,
+				evaluateEngine,
+				fileSystemState,
+				locationManager,
+				stateLock);
+			uut.Execute();
+
+			// Verify each package ran its generate and evaluate phase once, after all of its dependencies
+			auto& requests = evaluateEngine.GetRequests();
+			Assert::AreEqual<size_t>(8, requests.size(), "Verify evaluate request count.");
+			auto myPackageRequests = GetEvaluateRequestIndices(requests, "C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/");
+			auto packageARequests = GetEvaluateRequestIndices(requests, "C:/WorkingDirectory/PackageA/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/");
+			auto packageBRequests = GetEvaluateRequestIndices(requests, "C:/WorkingDirectory/PackageB/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/");
+			auto packageCRequests = GetEvaluateRequestIndices(requests, "C:/WorkingDirectory/PackageC/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/");
+			Assert::AreEqual<size_t>(2, myPackageRequests.size(), "Verify MyPackage built once.");
+			Assert::AreEqual<size_t>(2, packageARequests.size(), "Verify PackageA built once.");
+			Assert::AreEqual<size_t>(2, packageBRequests.size(), "Verify PackageB built once.");
+			Assert::AreEqual<size_t>(2, packageCRequests.size(), "Verify PackageC built once.");
+			Assert::IsTrue(packageCRequests.back() < packageARequests.front(), "Verify PackageC built before PackageA.");
+			Assert::IsTrue(packageCRequests.back() < packageBRequests.front(), "Verify PackageC built before PackageB.");
+			Assert::IsTrue(packageARequests.back() < myPackageRequests.front(), "Verify PackageA built before MyPackage.");
+			Assert::IsTrue(packageBRequests.back() < myPackageRequests.front(), "Verify PackageB built before MyPackage.");
+		}
+
+		// [[Fact]]
+		void Execute_MultipleJobs_FailureWithSiblingInFlight()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState(
+				0,
+				{},
+				TestHelpers::BuildDirectoryLookup({
+					Path("C:/WorkingDirectory/MyPackage/Recipe.sml"),
+					Path("C:/WorkingDirectory/PackageA/Recipe.sml"),
+					Path("C:/WorkingDirectory/PackageB/Recipe.sml"),
+				}),
+				{});
+
+			for (auto packageName : { "MyPackage", "PackageA", "PackageB" })
+			{
+				auto targetDirectory = Path(std::format("C:/WorkingDirectory/{}/out/zxAcy-Et010fdZUKLgFemwwWuC8/", packageName));
+				fileSystem->CreateMockDirectory(
+					targetDirectory,
+					std::make_shared<MockDirectory>(std::vector<Path>({})));
+
+				auto operationGraph = OperationGraph(
+					std::vector<OperationId>(),
+					std::vector<OperationInfo>());
+				auto operationGraphFiles = std::set<FileId>();
+				auto operationGraphContent = std::stringstream();
+				OperationGraphWriter::Serialize(operationGraph, operationGraphFiles, fileSystemState, operationGraphContent);
+				fileSystem->CreateMockFile(
+					targetDirectory + Path("./.soup/Evaluate.bog"),
+					std::make_shared<MockFile>(std::move(operationGraphContent)));
+			}
+
+			// Register the test process manager
+			auto processManager = std::make_shared<MockProcessManager>();
+			auto scopedProcessManager = ScopedProcessManagerRegister(processManager);
+
+			auto arguments = RecipeBuildArguments();
+			arguments.HostPlatform = "TestPlatform";
+			arguments.WorkingDirectory = Path("C:/WorkingDirectory/MyPackage/");
+			arguments.MaxJobs = 2;
+			auto userDataPath = Path("C:/Users/Me/.soup/");
+			auto systemReadAccess = std::vector<Path>({
+				Path("C:/FakeSystem/"),
+			});
+			auto recipeCache = RecipeCache({
+				{
+					"C:/WorkingDirectory/MyPackage/Recipe.sml",
+					Recipe(RecipeTable(
+					{
+						{ "Name", "MyPackage" },
+						{ "Language", "C++|1" },
+						{ "Version", "1.0.0" },
+						{
+							"Dependencies",
+							RecipeTable(
+							{
+								{ "Runtime", RecipeList({ "../PackageA/", "../PackageB/" }) },
+							})
+						},
+					}))
+				},
+				{
+					"C:/WorkingDirectory/PackageA/Recipe.sml",
+					Recipe(RecipeTable(
+					{
+						{ "Name", "PackageA" },
+						{ "Language", "C++|1" },
+						{ "Version", "1.0.0" },
+					}))
+				},
+				{
+					"C:/WorkingDirectory/PackageB/Recipe.sml",
+					Recipe(RecipeTable(
+					{
+						{ "Name", "PackageB" },
+						{ "Language", "C++|1" },
+						{ "Version", "1.0.0" },
+					}))
+				},
+			});
+			auto packageProvider = PackageProvider(
+				1,
+				PackageGraphLookupMap(
+				{
+					{
+						1,
+						PackageGraph(
+							1,
+							1,
+							ValueTable(
+							{
+								{ "ArgumentValue", Value(true) },
+							}))
+					},
+				}),
+				PackageLookupMap(
+				{
+					{
+						1,
+						PackageInfo(
+							1,
+							PackageName(std::nullopt, "MyPackage"),
+							false,
+							Path("C:/WorkingDirectory/MyPackage/"),
+							Path(),
+							&recipeCache.GetRecipe(Path("C:/WorkingDirectory/MyPackage/Recipe.sml")),
+							PackageChildrenMap({
+								{
+									"Runtime",
+									{
+										PackageChildInfo(PackageReference(Path("../PackageA/")), false, 2, -1),
+										PackageChildInfo(PackageReference(Path("../PackageB/")), false, 3, -1),
+									}
+								},
+							}))
+					},
+					{
+						2,
+						PackageInfo(
+							2,
+							PackageName(std::nullopt, "PackageA"),
+							false,
+							Path("C:/WorkingDirectory/PackageA/"),
+							Path(),
+							&recipeCache.GetRecipe(Path("C:/WorkingDirectory/PackageA/Recipe.sml")),
+							PackageChildrenMap())
+					},
+					{
+						3,
+						PackageInfo(
+							3,
+							PackageName(std::nullopt, "PackageB"),
+							false,
+							Path("C:/WorkingDirectory/PackageB/"),
+							Path(),
+							&recipeCache.GetRecipe(Path("C:/WorkingDirectory/PackageB/Recipe.sml")),
+							PackageChildrenMap())
+					},
+				}));
+			auto evaluateEngine = MockEvaluateEngine();
+			evaluateEngine.FailEvaluate(Path("C:/WorkingDirectory/PackageA/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/"));
+			auto knownLanguages = std::map<std::string, KnownLanguage>();
+			auto locationManager = RecipeBuildLocationManager(knownLanguages);
+			auto stateLock = BuildStateLock();
+			auto uut = BuildRunner(
+				arguments,
+				userDataPath,
+				systemReadAccess,
+				recipeCache,
+				packageProvider,
+				evaluateEngine,
+				fileSystemState,
+				locationManager,
+				stateLock);
+
+			// Both dependencies start together, the sibling finishes and the failure is reported
+			auto exception = Assert::Throws<BuildFailedException>([&uut]()
+			{
+				uut.Execute();
+			});
+
+			auto& requests = evaluateEngine.GetRequests();
+			auto myPackageRequests = GetEvaluateRequestIndices(requests, "C:/WorkingDirectory/MyPackage/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/");
+			auto packageARequests = GetEvaluateRequestIndices(requests, "C:/WorkingDirectory/PackageA/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/");
+			auto packageBRequests = GetEvaluateRequestIndices(requests, "C:/WorkingDirectory/PackageB/out/zxAcy-Et010fdZUKLgFemwwWuC8/temp/");
+			Assert::AreEqual<size_t>(0, myPackageRequests.size(), "Verify MyPackage was not built.");
+			Assert::AreEqual<size_t>(1, packageARequests.size(), "Verify PackageA failed in generate.");
+			Assert::AreEqual<size_t>(2, packageBRequests.size(), "Verify PackageB completed.");
+		}
+
+	private:
+		static std::chrono::time_point<std::chrono::file_clock> GetEpochTime()
+		{
+			return std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::time_point<std::chrono::system_clock>());
+		}
+
+		static std::vector<size_t> GetEvaluateRequestIndices(
+			const std::vector<std::string>& requests,
+			std::string_view temporaryDirectory)
+		{
+			auto result = std::vector<size_t>();
+			auto request = std::format("Evaluate: {}", temporaryDirectory);
+			for (size_t i = 0; i < requests.size(); i++)
+			{
+				if (requests[i] == request)
+					result.push_back(i);
+			}
+
+			return result;
 		}
 	};
 }
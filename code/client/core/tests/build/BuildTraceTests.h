@@ -0,0 +1,76 @@
+// <copyright file="BuildTraceTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class BuildTraceTests
+	{
+	public:
+		// [[Fact]]
+		void SpanDisabled()
+		{
+			auto trace = std::make_shared<BuildTrace>();
+
+			{
+				auto span = BuildTraceSpan("Build", "Package");
+			}
+
+			Assert::AreEqual<size_t>(0, trace->GetEvents().size(), "Verify no events were recorded.");
+		}
+
+		// [[Fact]]
+		void SpanRecordsEvent()
+		{
+			auto trace = std::make_shared<BuildTrace>();
+			BuildTrace::Register(trace);
+
+			{
+				auto span = BuildTraceSpan("StartMonitor", "Monitor", "TestCommand: 1");
+			}
+
+			BuildTrace::Register(nullptr);
+
+			auto events = trace->GetEvents();
+			Assert::AreEqual<size_t>(1, events.size(), "Verify one event was recorded.");
+			Assert::AreEqual<std::string>("StartMonitor", events[0].Name, "Verify name matches expected.");
+			Assert::AreEqual<std::string>("Monitor", events[0].Category, "Verify category matches expected.");
+			Assert::AreEqual<std::string>("TestCommand: 1", events[0].Detail, "Verify detail matches expected.");
+			Assert::AreEqual<uint32_t>(1, events[0].ThreadId, "Verify thread id matches expected.");
+		}
+
+		// [[Fact]]
+		void Save()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto uut = BuildTrace();
+			uut.AddEvent("Package1", "Package", "", 10, 200);
+			uut.AddEvent("Compile \"Main.cpp\"", "Operation", "C:\\Root\\", 20, 50);
+			uut.Save(Path("C:/Root/trace.json"));
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"OpenWriteBinary: C:/Root/trace.json",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			// Verify the file content
+			auto mockFile = fileSystem->GetMockFile(Path("C:/Root/trace.json"));
+			Assert::AreEqual(
+				std::string(
+					"{\"traceEvents\":[\n"
+					"{\"name\":\"Package1\",\"cat\":\"Package\",\"ph\":\"X\",\"ts\":10,\"dur\":200,\"pid\":1,\"tid\":1},\n"
+					"{\"name\":\"Compile \\\"Main.cpp\\\"\",\"cat\":\"Operation\",\"ph\":\"X\",\"ts\":20,\"dur\":50,\"pid\":1,\"tid\":1,\"args\":{\"detail\":\"C:\\\\Root\\\\\"}}\n"
+					"],\"displayTimeUnit\":\"ms\"}\n"),
+				mockFile->Content.str(),
+				"Verify file content match expected.");
+		}
+	};
+}
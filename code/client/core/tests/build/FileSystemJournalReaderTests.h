@@ -0,0 +1,85 @@
+// <copyright file="FileSystemJournalReaderTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class FileSystemJournalReaderTests
+	{
+	public:
+		// [[Fact]]
+		void Deserialize_InvalidFileHeaderThrows()
+		{
+			auto binaryFileContent = std::vector<char>(
+			{
+				'B', 'F', 'J', '2',
+			});
+			auto content = std::stringstream(std::string(binaryFileContent.data(), binaryFileContent.size()));
+
+			auto exception = Assert::Throws<std::runtime_error>([&content]() {
+				auto actual = FileSystemJournalReader::Deserialize(content);
+			});
+
+			Assert::AreEqual("Invalid file system journal file header", exception.what(), "Verify Exception message");
+		}
+
+		// [[Fact]]
+		void Deserialize_IgnoresPartialRecord()
+		{
+			auto binaryFileContent = std::vector<char>(
+			{
+				'B', 'F', 'J', '\0', 0x02, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+				'C', ':', '/', 'R', 'o', 'o', 't', '/',
+				0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+				'C', ':', '/',
+			});
+			auto content = std::stringstream(std::string(binaryFileContent.data(), binaryFileContent.size()));
+
+			auto actual = FileSystemJournalReader::Deserialize(content);
+
+			Assert::AreEqual<int64_t>(5, actual.SessionId, "Verify session id matches expected.");
+			Assert::AreEqual<uint32_t>(7, actual.ProcessId, "Verify process id matches expected.");
+			Assert::AreEqual(
+				std::vector<FileSystemJournalRecord>({
+					{ FileSystemJournalRecordType::Watch, Path("C:/Root/"), 52 },
+				}),
+				actual.Records,
+				"Verify records match expected.");
+			Assert::AreEqual<uint64_t>(52, actual.Size, "Verify size matches expected.");
+			Assert::AreEqual<uint64_t>(0, actual.CompactedOffset, "Verify compacted offset matches expected.");
+		}
+
+		// [[Fact]]
+		void Deserialize_Compacted()
+		{
+			auto binaryFileContent = std::vector<char>(
+			{
+				'B', 'F', 'J', '\0', 0x02, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+				0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+				'C', ':', '/', 'R', 'o', 'o', 't', '/',
+				0x02, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
+				'C', ':', '/', 'R', 'o', 'o', 't', '/', 'A', '/',
+			});
+			auto content = std::stringstream(std::string(binaryFileContent.data(), binaryFileContent.size()));
+
+			auto actual = FileSystemJournalReader::Deserialize(content);
+
+			Assert::AreEqual(
+				std::vector<FileSystemJournalRecord>({
+					{ FileSystemJournalRecordType::Watch, Path("C:/Root/"), 152 },
+					{ FileSystemJournalRecordType::Change, Path("C:/Root/A/"), 170 },
+				}),
+				actual.Records,
+				"Verify records match expected.");
+			Assert::AreEqual<uint64_t>(170, actual.Size, "Verify size matches expected.");
+			Assert::AreEqual<uint64_t>(152, actual.CompactedOffset, "Verify compacted offset matches expected.");
+		}
+	};
+}
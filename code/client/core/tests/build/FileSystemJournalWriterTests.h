@@ -0,0 +1,57 @@
+// <copyright file="FileSystemJournalWriterTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class FileSystemJournalWriterTests
+	{
+	public:
+		// [[Fact]]
+		void WriteCompacted_KeepsOffsets()
+		{
+			auto content = std::stringstream();
+			FileSystemJournalWriter::WriteHeader(content, 5, 7);
+			FileSystemJournalWriter::WriteRecord(content, FileSystemJournalRecordType::Watch, Path("C:/Root/"));
+			FileSystemJournalWriter::WriteRecord(content, FileSystemJournalRecordType::Change, Path("C:/Root/A.txt"));
+			FileSystemJournalWriter::WriteRecord(content, FileSystemJournalRecordType::Change, Path("C:/Root/B.txt"));
+			auto journal = FileSystemJournalReader::Deserialize(content);
+
+			auto compactedContent = std::stringstream();
+			FileSystemJournalWriter::WriteCompacted(compactedContent, journal, 73);
+
+			auto actual = FileSystemJournalReader::Deserialize(compactedContent);
+
+			Assert::AreEqual<int64_t>(5, actual.SessionId, "Verify session id matches expected.");
+			Assert::AreEqual<uint32_t>(7, actual.ProcessId, "Verify process id matches expected.");
+			Assert::AreEqual(
+				std::vector<FileSystemJournalRecord>({
+					{ FileSystemJournalRecordType::Watch, Path("C:/Root/"), 73 },
+					{ FileSystemJournalRecordType::Change, Path("C:/Root/B.txt"), 94 },
+				}),
+				actual.Records,
+				"Verify records match expected.");
+			Assert::AreEqual<uint64_t>(94, actual.Size, "Verify size matches expected.");
+			Assert::AreEqual<uint64_t>(73, actual.CompactedOffset, "Verify compacted offset matches expected.");
+		}
+
+		// [[Fact]]
+		void WriteCompacted_PartialRecordThrows()
+		{
+			auto content = std::stringstream();
+			FileSystemJournalWriter::WriteHeader(content, 5, 7);
+			FileSystemJournalWriter::WriteRecord(content, FileSystemJournalRecordType::Watch, Path("C:/Root/"));
+			FileSystemJournalWriter::WriteRecord(content, FileSystemJournalRecordType::Change, Path("C:/Root/A.txt"));
+			auto journal = FileSystemJournalReader::Deserialize(content);
+
+			auto compactedContent = std::stringstream();
+			auto exception = Assert::Throws<std::runtime_error>([&]() {
+				FileSystemJournalWriter::WriteCompacted(compactedContent, journal, 60);
+			});
+
+			Assert::AreEqual("The compacted offset is not at the end of a record", exception.what(), "Verify Exception message");
+		}
+	};
+}
@@ -0,0 +1,77 @@
+// <copyright file="FileSystemStateReaderTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class FileSystemStateReaderTests
+	{
+	public:
+		// [[Fact]]
+		void Deserialize_InvalidFileHeaderThrows()
+		{
+			auto binaryFileContent = std::vector<char>(
+			{
+				'B', 'F', 'S', '2',
+			});
+			auto content = std::stringstream(std::string(binaryFileContent.data(), binaryFileContent.size()));
+
+			auto exception = Assert::Throws<std::runtime_error>([&content]() {
+				auto actual = FileSystemStateReader::Deserialize(content);
+			});
+
+			Assert::AreEqual("Invalid file system state file header", exception.what(), "Verify Exception message");
+		}
+
+		// [[Fact]]
+		void Deserialize_InvalidFileVersionThrows()
+		{
+			auto binaryFileContent = std::vector<char>(
+			{
+				'B', 'F', 'S', '\0', 0x03, 0x00, 0x00, 0x00,
+			});
+			auto content = std::stringstream(std::string(binaryFileContent.data(), binaryFileContent.size()));
+
+			auto exception = Assert::Throws<std::runtime_error>([&content]() {
+				auto actual = FileSystemStateReader::Deserialize(content);
+			});
+
+			Assert::AreEqual("File system state file version does not match expected", exception.what(), "Verify Exception message");
+		}
+
+		// [[Fact]]
+		void Deserialize_Files()
+		{
+			auto binaryFileContent = std::vector<char>(
+			{
+				'B', 'F', 'S', '\0', 0x02, 0x00, 0x00, 0x00,
+				'J', 'N', 'L', '\0', 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				'F', 'I', 'S', '\0', 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+				'C', ':', '/', 'R', 'o', 'o', 't', '/', 'F', 'i', 'l', 'e', '.', 't', 'x', 't',
+				'P', 'D', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'D', 'L', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'W', 'T', 'C', '\0', 0x00, 0x00, 0x00, 0x00,
+			});
+			auto content = std::stringstream(std::string(binaryFileContent.data(), binaryFileContent.size()));
+
+			auto actual = FileSystemStateReader::Deserialize(content);
+
+			Assert::AreEqual(
+				5u,
+				actual.GetMaxFileId(),
+				"Verify max file id match expected.");
+			Assert::AreEqual(
+				std::unordered_map<FileId, Path>({
+					{
+						4,
+						Path("C:/Root/File.txt"),
+					},
+				}),
+				actual.GetFiles(),
+				"Verify files match expected.");
+		}
+	};
+}
@@ -221,5 +221,285 @@ namespace Soup::Core::UnitTests
 				uut.GetFiles(),
 				"Verify files match expected.");
 		}
+
+		// [[Fact]]
+		void ToFileIds_Relative()
+		{
+			auto uut = FileSystemState(
+				10,
+				std::unordered_map<FileId, Path>({
+					{
+						7,
+						Path("C:/Root/"),
+					},
+					{
+						8,
+						Path("C:/Root/DoStuff.exe"),
+					},
+					{
+						9,
+						Path("C:/Root/Folder/Input.txt"),
+					}}));
+
+			auto fileIds = uut.ToFileIds(
+				{
+					Path("./Folder/Input.txt"),
+					Path("./Folder/../DoStuff.exe"),
+					Path("../Other/Input.txt"),
+					Path("C:/Root/DoStuff.exe"),
+					Path("./"),
+				},
+				Path("C:/Root/"));
+
+			Assert::AreEqual(
+				std::vector<FileId>({ 9, 8, 11, 8, 7, }),
+				fileIds,
+				"Verify file ids match expected.");
+
+			Assert::AreEqual<FileId>(11, uut.GetMaxFileId(), "Verify max file id matches expected.");
+			Assert::AreEqual(
+				Path("C:/Other/Input.txt"),
+				uut.GetFilePath(11),
+				"Verify file path matches expected.");
+		}
+
+		// [[Fact]]
+		void ToFileIds_AbsoluteStrings()
+		{
+			auto uut = FileSystemState(
+				10,
+				std::unordered_map<FileId, Path>({
+					{
+						8,
+						Path("C:/Root/DoStuff.exe"),
+					},
+					{
+						9,
+						Path("C:/Root/Folder/Input.txt"),
+					}}));
+
+			auto files = std::vector<std::string_view>({
+				"C:/Root/Folder/Input.txt",
+				"C:/Other/Input.txt",
+				"C:/Root/DoStuff.exe",
+			});
+			auto fileIds = uut.ToFileIds(files);
+
+			Assert::AreEqual(
+				std::vector<FileId>({ 8, 9, 11, }),
+				fileIds,
+				"Verify file ids match expected.");
+
+			Assert::AreEqual<FileId>(11, uut.GetMaxFileId(), "Verify max file id matches expected.");
+			Assert::AreEqual(
+				Path("C:/Other/Input.txt"),
+				uut.GetFilePath(11),
+				"Verify file path matches expected.");
+		}
+
+		// [[Fact]]
+		void ApplyJournal_TrustsUnchangedFiles()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto setLastWriteTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 11min);
+			auto uut = FileSystemState(
+				10,
+				std::unordered_map<FileId, Path>({
+					{ 2, Path("C:/Root/Unchanged.txt") },
+					{ 3, Path("C:/Root/Changed.txt") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 2, setLastWriteTime },
+					{ 3, setLastWriteTime },
+				}),
+				{},
+				1234,
+				36);
+
+			uut.ApplyJournal(
+				FileSystemJournal(
+					1234,
+					1,
+					std::vector<FileSystemJournalRecord>({
+						{ FileSystemJournalRecordType::Watch, Path("C:/Root/"), 36 },
+						{ FileSystemJournalRecordType::Change, Path("C:/Root/Changed.txt"), 63 },
+					}),
+					63));
+
+			Assert::AreEqual(
+				std::optional<std::chrono::time_point<std::chrono::file_clock>>(setLastWriteTime),
+				uut.GetLastWriteTime(2),
+				"Verify unchanged last write time matches expected.");
+			Assert::AreEqual(
+				std::optional<std::chrono::time_point<std::chrono::file_clock>>(std::nullopt),
+				uut.GetLastWriteTime(3),
+				"Verify changed last write time matches expected.");
+			Assert::AreEqual<uint64_t>(63, uut.GetJournalOffset(), "Verify journal offset matches expected.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"TryGetLastWriteTime: C:/Root/Changed.txt",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
+
+		// [[Fact]]
+		void ApplyJournal_SyncCookieIsNotChange()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto setLastWriteTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 11min);
+			auto uut = FileSystemState(
+				10,
+				std::unordered_map<FileId, Path>({
+					{ 2, Path("C:/Root/Unchanged.txt") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 2, setLastWriteTime },
+				}),
+				{},
+				1234,
+				36);
+
+			uut.ApplyJournal(
+				FileSystemJournal(
+					1234,
+					1,
+					std::vector<FileSystemJournalRecord>({
+						{ FileSystemJournalRecordType::Watch, Path("C:/Root/"), 36 },
+						{ FileSystemJournalRecordType::Cookie, Path("C:/Root/.soup-cookie-1"), 72 },
+					}),
+					72));
+
+			Assert::AreEqual(
+				std::optional<std::chrono::time_point<std::chrono::file_clock>>(setLastWriteTime),
+				uut.GetLastWriteTime(2),
+				"Verify unchanged last write time matches expected.");
+			Assert::AreEqual<uint64_t>(72, uut.GetJournalOffset(), "Verify journal offset matches expected.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
+
+		// [[Fact]]
+		void ApplyJournal_ChangedDirectoryInvalidatesTree()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto setLastWriteTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 11min);
+			auto uut = FileSystemState(
+				10,
+				std::unordered_map<FileId, Path>({
+					{ 2, Path("C:/Root/Moved/File.txt") },
+					{ 3, Path("C:/Root/Moved/Nested/File.txt") },
+					{ 4, Path("C:/Root/Other/File.txt") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 2, setLastWriteTime },
+					{ 3, setLastWriteTime },
+					{ 4, setLastWriteTime },
+				}),
+				{},
+				1234,
+				36);
+
+			uut.ApplyJournal(
+				FileSystemJournal(
+					1234,
+					1,
+					std::vector<FileSystemJournalRecord>({
+						{ FileSystemJournalRecordType::Watch, Path("C:/Root/"), 36 },
+						{ FileSystemJournalRecordType::Change, Path("C:/Root/Moved/"), 58 },
+						{ FileSystemJournalRecordType::Change, Path("C:/Root"), 73 },
+					}),
+					73));
+
+			Assert::AreEqual(
+				std::optional<std::chrono::time_point<std::chrono::file_clock>>(std::nullopt),
+				uut.GetLastWriteTime(2),
+				"Verify moved last write time matches expected.");
+			Assert::AreEqual(
+				std::optional<std::chrono::time_point<std::chrono::file_clock>>(std::nullopt),
+				uut.GetLastWriteTime(3),
+				"Verify nested moved last write time matches expected.");
+			Assert::AreEqual(
+				std::optional<std::chrono::time_point<std::chrono::file_clock>>(setLastWriteTime),
+				uut.GetLastWriteTime(4),
+				"Verify unchanged last write time matches expected.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"TryGetLastWriteTime: C:/Root/Moved/File.txt",
+					"TryGetLastWriteTime: C:/Root/Moved/Nested/File.txt",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
+
+		// [[Fact]]
+		void ApplyJournal_CompactedPastRestoredOffset()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto setLastWriteTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 11min);
+			auto uut = FileSystemState(
+				10,
+				std::unordered_map<FileId, Path>({
+					{ 2, Path("C:/Root/Unchanged.txt") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 2, setLastWriteTime },
+				}),
+				{},
+				1234,
+				36);
+
+			uut.ApplyJournal(
+				FileSystemJournal(
+					1234,
+					1,
+					std::vector<FileSystemJournalRecord>({
+						{ FileSystemJournalRecordType::Watch, Path("C:/Root/"), 63 },
+					}),
+					63,
+					63));
+
+			Assert::AreEqual(
+				std::optional<std::chrono::time_point<std::chrono::file_clock>>(std::nullopt),
+				uut.GetLastWriteTime(2),
+				"Verify last write time matches expected.");
+			Assert::AreEqual<uint64_t>(63, uut.GetJournalOffset(), "Verify journal offset matches expected.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"TryGetLastWriteTime: C:/Root/Unchanged.txt",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
 	};
 }
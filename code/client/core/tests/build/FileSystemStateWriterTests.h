@@ -0,0 +1,67 @@
+// <copyright file="FileSystemStateWriterTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class FileSystemStateWriterTests
+	{
+	public:
+		// [[Fact]]
+		void Serialize_Empty()
+		{
+			auto fileSystemState = FileSystemState();
+			auto content = std::stringstream();
+
+			FileSystemStateWriter::Serialize(fileSystemState, content);
+
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'F', 'S', '\0', 0x02, 0x00, 0x00, 0x00,
+				'J', 'N', 'L', '\0', 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				'P', 'D', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'D', 'L', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'W', 'T', 'C', '\0', 0x00, 0x00, 0x00, 0x00,
+			});
+			Assert::AreEqual(
+				std::string((char*)binaryFileContent.data(), binaryFileContent.size()),
+				content.str(),
+				"Verify file content match expected.");
+		}
+
+		// [[Fact]]
+		void Serialize_Files()
+		{
+			auto fileSystemState = FileSystemState(
+				5,
+				std::unordered_map<FileId, Path>({
+					{
+						4,
+						Path("C:/Root/File.txt"),
+					},
+				}));
+			auto content = std::stringstream();
+
+			FileSystemStateWriter::Serialize(fileSystemState, content);
+
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'F', 'S', '\0', 0x02, 0x00, 0x00, 0x00,
+				'J', 'N', 'L', '\0', 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				'F', 'I', 'S', '\0', 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+				'C', ':', '/', 'R', 'o', 'o', 't', '/', 'F', 'i', 'l', 'e', '.', 't', 'x', 't',
+				'P', 'D', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'D', 'L', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'W', 'T', 'C', '\0', 0x00, 0x00, 0x00, 0x00,
+			});
+			Assert::AreEqual(
+				std::string((char*)binaryFileContent.data(), binaryFileContent.size()),
+				content.str(),
+				"Verify file content match expected.");
+		}
+	};
+}
@@ -0,0 +1,129 @@
+// <copyright file="LocalActionCacheStoreTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class LocalActionCacheStoreTests
+	{
+	public:
+		// [[Fact]]
+		void Store_TryLoad()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockDirectory(
+				Path("C:/Cache/"),
+				std::make_shared<MockDirectory>(std::vector<Path>()));
+
+			auto uut = LocalActionCacheStore(Path("C:/Cache/"), 100);
+			uut.Store("Entry1", "1234");
+
+			auto content = std::string();
+			auto result = uut.TryLoad("Entry1", content);
+
+			Assert::IsTrue(result, "Verify the result is true.");
+			Assert::AreEqual<std::string>("1234", content, "Verify the content matches expected.");
+			Assert::AreEqual<uint64_t>(4, uut.GetTotalSize(), "Verify the total size matches expected.");
+		}
+
+		// [[Fact]]
+		void Store_OverMaxSize_EvictsLeastRecentlyUsed()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockDirectory(
+				Path("C:/Cache/"),
+				std::make_shared<MockDirectory>(std::vector<Path>()));
+
+			auto uut = LocalActionCacheStore(Path("C:/Cache/"), 10);
+			uut.Store("Entry1", "1111");
+			uut.Store("Entry2", "2222");
+
+			// Use the first entry so the second is the least recently used
+			auto content = std::string();
+			Assert::IsTrue(uut.TryLoad("Entry1", content), "Verify the first entry is loaded.");
+
+			uut.Store("Entry3", "3333");
+
+			Assert::AreEqual<uint64_t>(8, uut.GetTotalSize(), "Verify the total size matches expected.");
+			Assert::IsTrue(uut.TryLoad("Entry1", content), "Verify the first entry is kept.");
+			Assert::IsFalse(uut.TryLoad("Entry2", content), "Verify the second entry is evicted.");
+			Assert::IsTrue(uut.TryLoad("Entry3", content), "Verify the third entry is kept.");
+		}
+
+		// [[Fact]]
+		void Flush_Reload_KeepsUsageOrder()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockDirectory(
+				Path("C:/Cache/"),
+				std::make_shared<MockDirectory>(std::vector<Path>()));
+
+			{
+				auto store = LocalActionCacheStore(Path("C:/Cache/"), 10);
+				store.Store("Entry1", "1111");
+				store.Store("Entry2", "2222");
+
+				auto content = std::string();
+				Assert::IsTrue(store.TryLoad("Entry1", content), "Verify the first entry is loaded.");
+
+				store.Flush();
+			}
+
+			// Verify the saved usage order is used to pick the entry to evict
+			auto uut = LocalActionCacheStore(Path("C:/Cache/"), 10);
+			Assert::AreEqual<uint64_t>(8, uut.GetTotalSize(), "Verify the total size matches expected.");
+
+			uut.Store("Entry3", "3333");
+
+			auto content = std::string();
+			Assert::IsTrue(uut.TryLoad("Entry1", content), "Verify the first entry is kept.");
+			Assert::IsFalse(uut.TryLoad("Entry2", content), "Verify the second entry is evicted.");
+			Assert::IsTrue(uut.TryLoad("Entry3", content), "Verify the third entry is kept.");
+		}
+
+		// [[Fact]]
+		void Flush_SharedDirectory_MergesEntriesFromOtherStore()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockDirectory(
+				Path("C:/Cache/"),
+				std::make_shared<MockDirectory>(std::vector<Path>()));
+
+			// Load both stores before either has saved the index
+			auto store1 = LocalActionCacheStore(Path("C:/Cache/"), 100);
+			auto store2 = LocalActionCacheStore(Path("C:/Cache/"), 100);
+			Assert::AreEqual<uint64_t>(0, store1.GetTotalSize(), "Verify the first store is empty.");
+			Assert::AreEqual<uint64_t>(0, store2.GetTotalSize(), "Verify the second store is empty.");
+
+			store1.Store("Entry1", "1111");
+			store1.Flush();
+
+			store2.Store("Entry2", "22");
+			store2.Flush();
+
+			// Verify the last saved index still tracks the entry from the first store
+			auto uut = LocalActionCacheStore(Path("C:/Cache/"), 100);
+			Assert::AreEqual<uint64_t>(6, uut.GetTotalSize(), "Verify the total size matches expected.");
+
+			auto content = std::string();
+			Assert::IsTrue(uut.TryLoad("Entry1", content), "Verify the first entry is tracked.");
+			Assert::AreEqual<std::string>("1111", content, "Verify the first content matches expected.");
+			Assert::IsTrue(uut.TryLoad("Entry2", content), "Verify the second entry is tracked.");
+			Assert::AreEqual<std::string>("22", content, "Verify the second content matches expected.");
+		}
+	};
+}
@@ -0,0 +1,68 @@
+// <copyright file="MacroManagerTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class MacroManagerTests
+	{
+	public:
+		// [[Fact]]
+		void ResolveMacros_NoMacros()
+		{
+			auto macros = std::map<std::string, std::string>();
+			auto uut = MacroManager(macros);
+
+			auto result = uut.ResolveMacros(std::string("C:/Root/File.txt"));
+
+			Assert::AreEqual(std::string("C:/Root/File.txt"), result, "Verify result matches expected.");
+		}
+
+		// [[Fact]]
+		void ResolveMacros_NoMatch()
+		{
+			auto macros = std::map<std::string, std::string>({
+				{ "/(TARGET_Package1)/", "C:/Package1/out/" },
+			});
+			auto uut = MacroManager(macros);
+
+			auto result = uut.ResolveMacros(std::string("/(TARGET_Package2)/File.txt"));
+
+			Assert::AreEqual(std::string("/(TARGET_Package2)/File.txt"), result, "Verify result matches expected.");
+		}
+
+		// [[Fact]]
+		void ResolveMacros_Multiple()
+		{
+			auto macros = std::map<std::string, std::string>({
+				{ "/(PACKAGE_Package1)/", "C:/Package1/" },
+				{ "/(TARGET_Package1)/", "C:/Package1/out/" },
+				{ "/(TARGET_Package12)/", "C:/Package12/out/" },
+			});
+			auto uut = MacroManager(macros);
+
+			auto result = uut.ResolveMacros(
+				std::string("-I/(PACKAGE_Package1)/ -o /(TARGET_Package12)/File.obj /(TARGET_Package1)/File.obj /(TARGET_"));
+
+			Assert::AreEqual(
+				std::string("-IC:/Package1/ -o C:/Package12/out/File.obj C:/Package1/out/File.obj /(TARGET_"),
+				result,
+				"Verify result matches expected.");
+		}
+
+		// [[Fact]]
+		void ResolveMacros_Path()
+		{
+			auto macros = std::map<std::string, std::string>({
+				{ "/(TARGET_Package1)/", "C:/Package1/out/" },
+			});
+			auto uut = MacroManager(macros);
+
+			auto result = uut.ResolveMacros(Path("/(TARGET_Package1)/obj/File.obj"));
+
+			Assert::AreEqual(Path("C:/Package1/out/obj/File.obj"), result, "Verify result matches expected.");
+		}
+	};
+}
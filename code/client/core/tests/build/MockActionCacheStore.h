@@ -0,0 +1,53 @@
+﻿// <copyright file="MockActionCacheStore.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The mock action cache store that keeps all entries in memory
+	/// </summary>
+	class MockActionCacheStore : public IActionCacheStore
+	{
+	private:
+		std::map<std::string, std::string> _entries;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="MockActionCacheStore"/> class.
+		/// </summary>
+		MockActionCacheStore() :
+			_entries()
+		{
+		}
+
+		/// <summary>
+		/// Get the stored entries
+		/// </summary>
+		const std::map<std::string, std::string>& GetEntries() const
+		{
+			return _entries;
+		}
+
+		bool TryLoad(const std::string& key, std::string& content) override final
+		{
+			auto findEntry = _entries.find(key);
+			if (findEntry == _entries.end())
+				return false;
+
+			content = findEntry->second;
+			return true;
+		}
+
+		void Store(const std::string& key, const std::string& content) override final
+		{
+			_entries.insert_or_assign(key, content);
+		}
+
+		void Flush() override final
+		{
+		}
+	};
+}
@@ -14,15 +14,25 @@ namespace Soup::Core
 	private:
 		std::atomic<int> m_uniqueId;
 		std::vector<std::string> _requests;
+		std::optional<Path> _failTemporaryDirectory;
 
 	public:
 		/// <summary>
 		/// Initializes a new instance of the <see cref="MockEvaluateEngine"/> class.
 		/// </summary>
-		MockEvaluateEngine()
+		MockEvaluateEngine() :
+			_failTemporaryDirectory(std::nullopt)
 		{
 		}
 
+		/// <summary>
+		/// Fail the build for any evaluate request that uses the temporary directory
+		/// </summary>
+		void FailEvaluate(Path temporaryDirectory)
+		{
+			_failTemporaryDirectory = std::move(temporaryDirectory);
+		}
+
 		/// <summary>
 		/// Get the load requests
 		/// </summary>
@@ -35,8 +45,9 @@ namespace Soup::Core
 		/// Execute the entire operation graph that is referenced by this build evaluate engine
 		/// </summary>
 		bool Evaluate(
-			const OperationGraph& operationGraph,
+			const CompactOperationGraph& operationGraph,
 			OperationResults& operationResults,
+			OperationResultsJournal* operationResultsJournal,
 			const Path& temporaryDirectory,
 			const std::vector<Path>& /*globalAllowedReadAccess*/,
 			const std::vector<Path>& /*globalAllowedWriteAccess*/)
@@ -46,18 +57,22 @@ namespace Soup::Core
 
 			_requests.push_back(message.str());
 
+			if (_failTemporaryDirectory.has_value() && _failTemporaryDirectory.value() == temporaryDirectory)
+				throw BuildFailedException();
+
 			auto time = std::chrono::clock_cast<std::chrono::file_clock>(
 				std::chrono::time_point<std::chrono::system_clock>());
-			for (auto& operation : operationGraph.GetOperations())
+			for (auto& operationInfo : operationGraph.GetOperations())
 			{
-				auto& operationInfo = operation.second;
-				operationResults.AddOrUpdateOperationResult(
+				auto& result = operationResults.AddOrUpdateOperationResult(
 					operationInfo.Id,
 					OperationResult(
 					true,
 					time,
 					{ },
 					{ }));
+				if (operationResultsJournal != nullptr)
+					operationResultsJournal->Append(operationInfo.Id, result);
 			}
 
 			return true;
@@ -0,0 +1,57 @@
+﻿// <copyright file="MockGenerateEngine.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The mock in-process generate engine
+	/// </summary>
+	class MockGenerateEngine : public IGenerateEngine
+	{
+	private:
+		std::vector<std::string> _requests;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="MockGenerateEngine"/> class.
+		/// </summary>
+		MockGenerateEngine()
+		{
+		}
+
+		/// <summary>
+		/// Get the load requests
+		/// </summary>
+		const std::vector<std::string>& GetRequests() const
+		{
+			return _requests;
+		}
+
+		/// <summary>
+		/// Run the generate phase, reports the input file as read and the evaluate graph as written
+		/// </summary>
+		void Generate(
+			const Path& soupTargetDirectory,
+			const ValueTable& /*inputTable*/,
+			FileSystemState& /*fileSystemState*/,
+			RecipeCache& /*recipeCache*/,
+			std::vector<Path>& observedInput,
+			std::vector<Path>& observedOutput)
+		{
+			std::stringstream message;
+			message << "Generate: " << soupTargetDirectory.ToString();
+
+			_requests.push_back(message.str());
+
+			observedInput = {
+				soupTargetDirectory + Path("./GenerateInput.bvt"),
+			};
+			observedOutput = {
+				soupTargetDirectory + Path("./Evaluate.bog"),
+			};
+		}
+	};
+}
@@ -0,0 +1,140 @@
+// <copyright file="OperationOutputSinkTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class OperationOutputSinkTests
+	{
+	public:
+		// [[Fact]]
+		void StreamLines()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto uut = OperationOutputSink("TestCommand: 1", 1024, Path("C:/Temp/"), "Operation1.output.txt");
+
+			uut.OnStandardOutput("Line 1\r\nLi");
+			uut.OnStandardError("Error 1\n");
+			uut.OnStandardOutput("ne 2\nLine");
+			uut.OnStandardOutput(" 3");
+			uut.Flush();
+
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"INFO: TestCommand: 1: Line 1",
+					"ERRO: TestCommand: 1: Error 1",
+					"INFO: TestCommand: 1: Line 2",
+					"INFO: TestCommand: 1: Line 3",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			Assert::AreEqual<std::string>("Line 1\r\nLine 2\nLine 3", uut.GetStandardOutput(), "Verify standard output matches expected.");
+			Assert::AreEqual<size_t>(0, uut.GetSpilledSize(), "Verify spilled size matches expected.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
+
+		// [[Fact]]
+		void QueueLinesUntilLogged()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto uut = OperationOutputSink("TestCommand: 1", 1024, Path("C:/Temp/"), "Operation1.output.txt");
+			uint32_t queuedCount = 0;
+			uut.SetLinesQueuedCallback([&queuedCount]() { queuedCount++; });
+
+			uut.OnStandardOutput("Line 1\nLi");
+			uut.OnStandardOutput("ne 2");
+
+			Assert::AreEqual<uint32_t>(1, queuedCount, "Verify queued count matches expected.");
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				testListener->GetMessages(),
+				"Verify no log messages before the owner logs the queued lines.");
+
+			uut.LogQueuedLines();
+
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"INFO: TestCommand: 1: Line 1",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			uut.Flush();
+
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"INFO: TestCommand: 1: Line 1",
+					"INFO: TestCommand: 1: Line 2",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+		}
+
+		// [[Fact]]
+		void SpillToFile()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto uut = OperationOutputSink("TestCommand: 1", 8, Path("C:/Temp/"), "Operation1.output.txt");
+
+			uut.OnStandardOutput("Line 1\nLine 2\n");
+			uut.OnStandardOutput("Line 3\n");
+			uut.Flush();
+
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"INFO: TestCommand: 1: Line 1",
+					"INFO: TestCommand: 1: Line 2",
+					"INFO: TestCommand: 1: Line 3",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			Assert::AreEqual<std::string>("Line 1\nL", uut.GetStandardOutput(), "Verify standard output matches expected.");
+			Assert::AreEqual<size_t>(13, uut.GetSpilledSize(), "Verify spilled size matches expected.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"OpenWriteBinary: C:/Temp/Operation1.output.txt",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			// Verify the file content
+			auto mockFile = fileSystem->GetMockFile(Path("C:/Temp/Operation1.output.txt"));
+			Assert::AreEqual(
+				std::string("ine 2\nLine 3\n"),
+				mockFile->Content.str(),
+				"Verify file content match expected.");
+		}
+	};
+}
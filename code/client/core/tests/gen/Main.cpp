@@ -23,23 +23,34 @@ using namespace Soup::Test;
 
 #include "utilities/TestHelpers.h"
 
+#include "build/ActionCacheTests.gen.h"
 #include "build/BuildEngineTests.gen.h"
 #include "build/BuildEvaluateEngineTests.gen.h"
 #include "build/BuildHistoryCheckerTests.gen.h"
 #include "build/BuildLoadEngineTests.gen.h"
 #include "build/BuildRunnerTests.gen.h"
+#include "build/BuildTraceTests.gen.h"
+#include "build/FileSystemJournalReaderTests.gen.h"
+#include "build/FileSystemJournalWriterTests.gen.h"
 #include "build/FileSystemStateTests.gen.h"
+#include "build/FileSystemStateReaderTests.gen.h"
+#include "build/FileSystemStateWriterTests.gen.h"
+#include "build/LocalActionCacheStoreTests.gen.h"
+#include "build/MacroManagerTests.gen.h"
+#include "build/OperationOutputSinkTests.gen.h"
 #include "build/PackageProviderTests.gen.h"
 #include "build/RecipeBuildLocationManagerTests.gen.h"
 
 #include "local-user-config/LocalUserConfigExtensionsTests.gen.h"
 #include "local-user-config/LocalUserConfigTests.gen.h"
 
+#include "operation-graph/CompactOperationGraphTests.gen.h"
 #include "operation-graph/OperationGraphTests.gen.h"
 #include "operation-graph/OperationGraphManagerTests.gen.h"
 #include "operation-graph/OperationGraphReaderTests.gen.h"
 #include "operation-graph/OperationGraphWriterTests.gen.h"
 #include "operation-graph/OperationResultsTests.gen.h"
+#include "operation-graph/OperationResultsJournalTests.gen.h"
 #include "operation-graph/OperationResultsManagerTests.gen.h"
 #include "operation-graph/OperationResultsReaderTests.gen.h"
 #include "operation-graph/OperationResultsWriterTests.gen.h"
@@ -49,6 +60,7 @@ using namespace Soup::Test;
 #include "recipe/PackageIdentifierTests.gen.h"
 #include "recipe/PackageNameTests.gen.h"
 #include "recipe/PackageReferenceTests.gen.h"
+#include "recipe/PackageReferenceParserTests.gen.h"
 #include "recipe/RecipeExtensionsTests.gen.h"
 #include "recipe/RecipeTests.gen.h"
 #include "recipe/RecipeSMLTests.gen.h"
@@ -63,23 +75,34 @@ int main()
 
 	TestState state = { 0, 0 };
 
+	state += RunActionCacheTests();
 	state += RunBuildEngineTests();
 	state += RunBuildEvaluateEngineTests();
 	state += RunBuildHistoryCheckerTests();
 	state += RunBuildLoadEngineTests();
 	state += RunBuildRunnerTests();
+	state += RunBuildTraceTests();
+	state += RunFileSystemJournalReaderTests();
+	state += RunFileSystemJournalWriterTests();
 	state += RunFileSystemStateTests();
+	state += RunFileSystemStateReaderTests();
+	state += RunFileSystemStateWriterTests();
+	state += RunLocalActionCacheStoreTests();
+	state += RunMacroManagerTests();
+	state += RunOperationOutputSinkTests();
 	state += RunPackageProviderTests();
 	state += RunRecipeBuildLocationManagerTests();
 
 	state += RunLocalUserConfigExtensionsTests();
 	state += RunLocalUserConfigTests();
 
+	state += RunCompactOperationGraphTests();
 	state += RunOperationGraphTests();
 	state += RunOperationGraphManagerTests();
 	state += RunOperationGraphReaderTests();
 	state += RunOperationGraphWriterTests();
 	state += RunOperationResultsTests();
+	state += RunOperationResultsJournalTests();
 	state += RunOperationResultsManagerTests();
 	state += RunOperationResultsReaderTests();
 	state += RunOperationResultsWriterTests();
@@ -89,6 +112,7 @@ int main()
 	state += RunPackageIdentifierTests();
 	state += RunPackageNameTests();
 	state += RunPackageReferenceTests();
+	state += RunPackageReferenceParserTests();
 	state += RunRecipeExtensionsTests();
 	state += RunRecipeTests();
 	state += RunRecipeSMLTests();
@@ -0,0 +1,16 @@
+#pragma once
+#include "build/ActionCacheTests.h"
+
+TestState RunActionCacheTests() 
+{
+	auto className = "ActionCacheTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::ActionCacheTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "TryRestore_Empty", [&testClass]() { testClass->TryRestore_Empty(); });
+	state += Soup::Test::RunTest(className, "Store_TryRestore", [&testClass]() { testClass->Store_TryRestore(); });
+	state += Soup::Test::RunTest(className, "Store_TryRestore_InputContentChanged", [&testClass]() { testClass->Store_TryRestore_InputContentChanged(); });
+	state += Soup::Test::RunTest(className, "Store_TryRestore_NewFileIds_SortsObservedFiles", [&testClass]() { testClass->Store_TryRestore_NewFileIds_SortsObservedFiles(); });
+	state += Soup::Test::RunTest(className, "Store_TryRestore_NewWorkingDirectory", [&testClass]() { testClass->Store_TryRestore_NewWorkingDirectory(); });
+
+	return state;
+}
\ No newline at end of file
@@ -15,6 +15,11 @@ TestState RunBuildEvaluateEngineTests()
 	state += Soup::Test::RunTest(className, "Evaluate_OneOperation_Incremental_OutOfDate", [&testClass]() { testClass->Evaluate_OneOperation_Incremental_OutOfDate(); });
 	state += Soup::Test::RunTest(className, "Evaluate_OneOperation_Incremental_Executable_OutOfDate", [&testClass]() { testClass->Evaluate_OneOperation_Incremental_Executable_OutOfDate(); });
 	state += Soup::Test::RunTest(className, "Evaluate_OneOperation_Incremental_UpToDate", [&testClass]() { testClass->Evaluate_OneOperation_Incremental_UpToDate(); });
+	state += Soup::Test::RunTest(className, "Execute_TwoOperations_MultipleJobs_RunsChildAfterParent", [&testClass]() { testClass->Execute_TwoOperations_MultipleJobs_RunsChildAfterParent(); });
+	state += Soup::Test::RunTest(className, "Execute_TwoOperations_RunsLongestCriticalPathFirst", [&testClass]() { testClass->Execute_TwoOperations_RunsLongestCriticalPathFirst(); });
+	state += Soup::Test::RunTest(className, "Execute_OneOperation_WriteFile_KeepsPreviousRunStatistics", [&testClass]() { testClass->Execute_OneOperation_WriteFile_KeepsPreviousRunStatistics(); });
+	state += Soup::Test::RunTest(className, "Execute_TwoOperations_ResourcePool_WaitsForActiveOperation", [&testClass]() { testClass->Execute_TwoOperations_ResourcePool_WaitsForActiveOperation(); });
+	state += Soup::Test::RunTest(className, "Execute_TwoOperations_MemoryBudget_UnmeasuredOperation_WaitsForActiveOperation", [&testClass]() { testClass->Execute_TwoOperations_MemoryBudget_UnmeasuredOperation_WaitsForActiveOperation(); });
 	state += Soup::Test::RunTest(className, "Execute_TwoOperations_DuplicateOutputFile_Fails", [&testClass]() { testClass->Execute_TwoOperations_DuplicateOutputFile_Fails(); });
 	state += Soup::Test::RunTest(className, "Execute_TwoOperations_UndeclaredOutputWithDeclaredInput_Fails", [&testClass]() { testClass->Execute_TwoOperations_UndeclaredOutputWithDeclaredInput_Fails(); });
 	state += Soup::Test::RunTest(className, "Execute_TwoOperations_UndeclaredInputWithDeclaredOutput_Fails", [&testClass]() { testClass->Execute_TwoOperations_UndeclaredInputWithDeclaredOutput_Fails(); });
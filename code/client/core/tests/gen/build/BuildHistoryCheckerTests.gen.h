@@ -14,6 +14,8 @@ TestState RunBuildHistoryCheckerTests()
 	state += Soup::Test::RunTest(className, "IsOutdated_SingleInput_TargetExists_Outdated", [&testClass]() { testClass->IsOutdated_SingleInput_TargetExists_Outdated(); });
 	state += Soup::Test::RunTest(className, "IsOutdated_SingleInput_TargetExists_UpToDate", [&testClass]() { testClass->IsOutdated_SingleInput_TargetExists_UpToDate(); });
 	state += Soup::Test::RunTest(className, "IsOutdated_MultipleInputs_RelativeAndAbsolute", [&testClass]() { testClass->IsOutdated_MultipleInputs_RelativeAndAbsolute(); });
+	state += Soup::Test::RunTest(className, "IsOutdated_ContentHash_InputAltered_ContentUnchanged", [&testClass]() { testClass->IsOutdated_ContentHash_InputAltered_ContentUnchanged(); });
+	state += Soup::Test::RunTest(className, "IsOutdated_ContentHash_InputAltered_ContentChanged", [&testClass]() { testClass->IsOutdated_ContentHash_InputAltered_ContentChanged(); });
 
 	return state;
 }
\ No newline at end of file
@@ -8,9 +8,12 @@ TestState RunBuildRunnerTests()
 	TestState state = { 0, 0 };
 	state += Soup::Test::RunTest(className, "Initialize_Success", [&testClass]() { testClass->Initialize_Success(); });
 	state += Soup::Test::RunTest(className, "Execute_NoDependencies", [&testClass]() { testClass->Execute_NoDependencies(); });
+	state += Soup::Test::RunTest(className, "Execute_InProcessGenerate", [&testClass]() { testClass->Execute_InProcessGenerate(); });
 	state += Soup::Test::RunTest(className, "Execute_TriangleDependency_NoRebuild", [&testClass]() { testClass->Execute_TriangleDependency_NoRebuild(); });
 	state += Soup::Test::RunTest(className, "Execute_BuildDependency", [&testClass]() { testClass->Execute_BuildDependency(); });
 	state += Soup::Test::RunTest(className, "Execute_PackageLock_OverrideBuildDependency", [&testClass]() { testClass->Execute_PackageLock_OverrideBuildDependency(); });
+	state += Soup::Test::RunTest(className, "Execute_MultipleJobs_DiamondDependency", [&testClass]() { testClass->Execute_MultipleJobs_DiamondDependency(); });
+	state += Soup::Test::RunTest(className, "Execute_MultipleJobs_FailureWithSiblingInFlight", [&testClass]() { testClass->Execute_MultipleJobs_FailureWithSiblingInFlight(); });
 
 	return state;
 }
\ No newline at end of file
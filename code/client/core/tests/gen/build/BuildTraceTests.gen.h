@@ -0,0 +1,14 @@
+#pragma once
+#include "build/BuildTraceTests.h"
+
+TestState RunBuildTraceTests() 
+ {
+	auto className = "BuildTraceTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::BuildTraceTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "SpanDisabled", [&testClass]() { testClass->SpanDisabled(); });
+	state += Soup::Test::RunTest(className, "SpanRecordsEvent", [&testClass]() { testClass->SpanRecordsEvent(); });
+	state += Soup::Test::RunTest(className, "Save", [&testClass]() { testClass->Save(); });
+
+	return state;
+}
\ No newline at end of file
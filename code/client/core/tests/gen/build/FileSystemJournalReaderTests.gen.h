@@ -0,0 +1,14 @@
+#pragma once
+#include "build/FileSystemJournalReaderTests.h"
+
+TestState RunFileSystemJournalReaderTests() 
+{
+	auto className = "FileSystemJournalReaderTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::FileSystemJournalReaderTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Deserialize_InvalidFileHeaderThrows", [&testClass]() { testClass->Deserialize_InvalidFileHeaderThrows(); });
+	state += Soup::Test::RunTest(className, "Deserialize_IgnoresPartialRecord", [&testClass]() { testClass->Deserialize_IgnoresPartialRecord(); });
+	state += Soup::Test::RunTest(className, "Deserialize_Compacted", [&testClass]() { testClass->Deserialize_Compacted(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+#include "build/FileSystemJournalWriterTests.h"
+
+TestState RunFileSystemJournalWriterTests() 
+{
+	auto className = "FileSystemJournalWriterTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::FileSystemJournalWriterTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "WriteCompacted_KeepsOffsets", [&testClass]() { testClass->WriteCompacted_KeepsOffsets(); });
+	state += Soup::Test::RunTest(className, "WriteCompacted_PartialRecordThrows", [&testClass]() { testClass->WriteCompacted_PartialRecordThrows(); });
+
+	return state;
+}
\ No newline at end of file
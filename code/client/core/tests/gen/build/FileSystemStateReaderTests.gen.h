@@ -0,0 +1,14 @@
+#pragma once
+#include "build/FileSystemStateReaderTests.h"
+
+TestState RunFileSystemStateReaderTests() 
+{
+	auto className = "FileSystemStateReaderTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::FileSystemStateReaderTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Deserialize_InvalidFileHeaderThrows", [&testClass]() { testClass->Deserialize_InvalidFileHeaderThrows(); });
+	state += Soup::Test::RunTest(className, "Deserialize_InvalidFileVersionThrows", [&testClass]() { testClass->Deserialize_InvalidFileVersionThrows(); });
+	state += Soup::Test::RunTest(className, "Deserialize_Files", [&testClass]() { testClass->Deserialize_Files(); });
+
+	return state;
+}
\ No newline at end of file
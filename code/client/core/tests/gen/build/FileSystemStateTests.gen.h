@@ -16,6 +16,12 @@ TestState RunFileSystemStateTests()
 	state += Soup::Test::RunTest(className, "TryFindFileId_Found", [&testClass]() { testClass->TryFindFileId_Found(); });
 	state += Soup::Test::RunTest(className, "ToFileId_Existing", [&testClass]() { testClass->ToFileId_Existing(); });
 	state += Soup::Test::RunTest(className, "ToFileId_Unknown", [&testClass]() { testClass->ToFileId_Unknown(); });
+	state += Soup::Test::RunTest(className, "ToFileIds_Relative", [&testClass]() { testClass->ToFileIds_Relative(); });
+	state += Soup::Test::RunTest(className, "ToFileIds_AbsoluteStrings", [&testClass]() { testClass->ToFileIds_AbsoluteStrings(); });
+	state += Soup::Test::RunTest(className, "ApplyJournal_TrustsUnchangedFiles", [&testClass]() { testClass->ApplyJournal_TrustsUnchangedFiles(); });
+	state += Soup::Test::RunTest(className, "ApplyJournal_SyncCookieIsNotChange", [&testClass]() { testClass->ApplyJournal_SyncCookieIsNotChange(); });
+	state += Soup::Test::RunTest(className, "ApplyJournal_ChangedDirectoryInvalidatesTree", [&testClass]() { testClass->ApplyJournal_ChangedDirectoryInvalidatesTree(); });
+	state += Soup::Test::RunTest(className, "ApplyJournal_CompactedPastRestoredOffset", [&testClass]() { testClass->ApplyJournal_CompactedPastRestoredOffset(); });
 
 	return state;
 }
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+#include "build/FileSystemStateWriterTests.h"
+
+TestState RunFileSystemStateWriterTests() 
+{
+	auto className = "FileSystemStateWriterTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::FileSystemStateWriterTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Serialize_Empty", [&testClass]() { testClass->Serialize_Empty(); });
+	state += Soup::Test::RunTest(className, "Serialize_Files", [&testClass]() { testClass->Serialize_Files(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+#include "build/LocalActionCacheStoreTests.h"
+
+TestState RunLocalActionCacheStoreTests() 
+{
+	auto className = "LocalActionCacheStoreTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::LocalActionCacheStoreTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Store_TryLoad", [&testClass]() { testClass->Store_TryLoad(); });
+	state += Soup::Test::RunTest(className, "Store_OverMaxSize_EvictsLeastRecentlyUsed", [&testClass]() { testClass->Store_OverMaxSize_EvictsLeastRecentlyUsed(); });
+	state += Soup::Test::RunTest(className, "Flush_Reload_KeepsUsageOrder", [&testClass]() { testClass->Flush_Reload_KeepsUsageOrder(); });
+	state += Soup::Test::RunTest(className, "Flush_SharedDirectory_MergesEntriesFromOtherStore", [&testClass]() { testClass->Flush_SharedDirectory_MergesEntriesFromOtherStore(); });
+
+	return state;
+}
\ No newline at end of file
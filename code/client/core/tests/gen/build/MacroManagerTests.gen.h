@@ -0,0 +1,15 @@
+#pragma once
+#include "build/MacroManagerTests.h"
+
+TestState RunMacroManagerTests() 
+ {
+	auto className = "MacroManagerTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::MacroManagerTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "ResolveMacros_NoMacros", [&testClass]() { testClass->ResolveMacros_NoMacros(); });
+	state += Soup::Test::RunTest(className, "ResolveMacros_NoMatch", [&testClass]() { testClass->ResolveMacros_NoMatch(); });
+	state += Soup::Test::RunTest(className, "ResolveMacros_Multiple", [&testClass]() { testClass->ResolveMacros_Multiple(); });
+	state += Soup::Test::RunTest(className, "ResolveMacros_Path", [&testClass]() { testClass->ResolveMacros_Path(); });
+
+	return state;
+}
\ No newline at end of file
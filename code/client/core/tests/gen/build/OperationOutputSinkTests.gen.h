@@ -0,0 +1,14 @@
+#pragma once
+#include "build/OperationOutputSinkTests.h"
+
+TestState RunOperationOutputSinkTests() 
+ {
+	auto className = "OperationOutputSinkTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::OperationOutputSinkTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "StreamLines", [&testClass]() { testClass->StreamLines(); });
+	state += Soup::Test::RunTest(className, "QueueLinesUntilLogged", [&testClass]() { testClass->QueueLinesUntilLogged(); });
+	state += Soup::Test::RunTest(className, "SpillToFile", [&testClass]() { testClass->SpillToFile(); });
+
+	return state;
+}
\ No newline at end of file
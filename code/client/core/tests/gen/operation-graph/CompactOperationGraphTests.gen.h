@@ -0,0 +1,14 @@
+#pragma once
+#include "operation-graph/CompactOperationGraphTests.h"
+
+TestState RunCompactOperationGraphTests() 
+ {
+	auto className = "CompactOperationGraphTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::CompactOperationGraphTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Initialize_Empty", [&testClass]() { testClass->Initialize_Empty(); });
+	state += Soup::Test::RunTest(className, "Initialize_Multiple", [&testClass]() { testClass->Initialize_Multiple(); });
+	state += Soup::Test::RunTest(className, "GetOperationInfo_MissingThrows", [&testClass]() { testClass->GetOperationInfo_MissingThrows(); });
+
+	return state;
+}
\ No newline at end of file
@@ -14,6 +14,10 @@ TestState RunOperationGraphReaderTests()
 	state += Soup::Test::RunTest(className, "Deserialize_SingleSimple", [&testClass]() { testClass->Deserialize_SingleSimple(); });
 	state += Soup::Test::RunTest(className, "Deserialize_SingleComplex", [&testClass]() { testClass->Deserialize_SingleComplex(); });
 	state += Soup::Test::RunTest(className, "Deserialize_Multiple", [&testClass]() { testClass->Deserialize_Multiple(); });
+	state += Soup::Test::RunTest(className, "Deserialize_InvalidStringOffsetThrows", [&testClass]() { testClass->Deserialize_InvalidStringOffsetThrows(); });
+	state += Soup::Test::RunTest(className, "Deserialize_StringTable_Multiple", [&testClass]() { testClass->Deserialize_StringTable_Multiple(); });
+	state += Soup::Test::RunTest(className, "Deserialize_ResourcePool", [&testClass]() { testClass->Deserialize_ResourcePool(); });
+	state += Soup::Test::RunTest(className, "DeserializeCompact_ResourcePool", [&testClass]() { testClass->DeserializeCompact_ResourcePool(); });
 
 	return state;
 }
\ No newline at end of file
@@ -10,6 +10,7 @@ TestState RunOperationGraphWriterTests()
 	state += Soup::Test::RunTest(className, "Serialize_SingleSimple", [&testClass]() { testClass->Serialize_SingleSimple(); });
 	state += Soup::Test::RunTest(className, "Serialize_SingleComplex", [&testClass]() { testClass->Serialize_SingleComplex(); });
 	state += Soup::Test::RunTest(className, "Serialize_Multiple", [&testClass]() { testClass->Serialize_Multiple(); });
+	state += Soup::Test::RunTest(className, "Serialize_ResourcePool", [&testClass]() { testClass->Serialize_ResourcePool(); });
 
 	return state;
 }
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+#include "operation-graph/OperationResultsJournalTests.h"
+
+TestState RunOperationResultsJournalTests() 
+{
+	auto className = "OperationResultsJournalTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::OperationResultsJournalTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Open_Append_Replay", [&testClass]() { testClass->Open_Append_Replay(); });
+	state += Soup::Test::RunTest(className, "Replay_IgnoresPartialRecord", [&testClass]() { testClass->Replay_IgnoresPartialRecord(); });
+	state += Soup::Test::RunTest(className, "Open_CarryForwardJournaledOperations", [&testClass]() { testClass->Open_CarryForwardJournaledOperations(); });
+	state += Soup::Test::RunTest(className, "Open_Compact", [&testClass]() { testClass->Open_Compact(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+#include "recipe/PackageReferenceParserTests.h"
+
+TestState RunPackageReferenceParserTests() 
+ {
+	auto className = "PackageReferenceParserTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::PackageReferenceParserTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "TryParseNamedValues(\"Name\", std::nullopt, std::nullopt, \"Name\", std::nullopt)", [&testClass]() { testClass->TryParseNamedValues("Name", std::nullopt, std::nullopt, "Name", std::nullopt); });
+	state += Soup::Test::RunTest(className, "TryParseNamedValues(\"Name.Sub_1@1.2.3\", std::nullopt, std::nullopt, \"Name.Sub_1\", \"1.2.3\")", [&testClass]() { testClass->TryParseNamedValues("Name.Sub_1@1.2.3", std::nullopt, std::nullopt, "Name.Sub_1", "1.2.3"); });
+	state += Soup::Test::RunTest(className, "TryParseNamedValues(\"[C++]Name@2\", \"C++\", std::nullopt, \"Name\", \"2\")", [&testClass]() { testClass->TryParseNamedValues("[C++]Name@2", "C++", std::nullopt, "Name", "2"); });
+	state += Soup::Test::RunTest(className, "TryParseNamedValues(\"[C#]User1|Name\", \"C#\", \"User1\", \"Name\", std::nullopt)", [&testClass]() { testClass->TryParseNamedValues("[C#]User1|Name", "C#", "User1", "Name", std::nullopt); });
+	state += Soup::Test::RunTest(className, "TryParseNamedValues(\"[C#]User1|Name@1.2\", \"C#\", \"User1\", \"Name\", \"1.2\")", [&testClass]() { testClass->TryParseNamedValues("[C#]User1|Name@1.2", "C#", "User1", "Name", "1.2"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"\")", [&testClass]() { testClass->TryParseInvalidValues(""); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"1Name\")", [&testClass]() { testClass->TryParseInvalidValues("1Name"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"[]Name\")", [&testClass]() { testClass->TryParseInvalidValues("[]Name"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"[C#Name\")", [&testClass]() { testClass->TryParseInvalidValues("[C#Name"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"User1|\")", [&testClass]() { testClass->TryParseInvalidValues("User1|"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"User1|Name|Name\")", [&testClass]() { testClass->TryParseInvalidValues("User1|Name|Name"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"Name@\")", [&testClass]() { testClass->TryParseInvalidValues("Name@"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"Name@1.\")", [&testClass]() { testClass->TryParseInvalidValues("Name@1."); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"Name@1.2.3.4\")", [&testClass]() { testClass->TryParseInvalidValues("Name@1.2.3.4"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"Name@1-2\")", [&testClass]() { testClass->TryParseInvalidValues("Name@1-2"); });
+	state += Soup::Test::RunTest(className, "TryParseInvalidValues(\"../Path\")", [&testClass]() { testClass->TryParseInvalidValues("../Path"); });
+
+	return state;
+}
\ No newline at end of file
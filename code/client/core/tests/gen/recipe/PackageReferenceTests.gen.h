@@ -24,6 +24,7 @@ TestState RunPackageReferenceTests()
 	state += Soup::Test::RunTest(className, "ParseNamedValues(\"[C#]User1|Name\", \"C#\", \"User1\", \"Name\", std::nullopt)", [&testClass]() { testClass->ParseNamedValues("[C#]User1|Name", "C#", "User1", "Name", std::nullopt); });
 	state += Soup::Test::RunTest(className, "ParseNamedValues(\"[C#]User1|Name@1.2.3\", \"C#\", \"User1\", \"Name\", SemanticVersion(1, 2, 3))", [&testClass]() { testClass->ParseNamedValues("[C#]User1|Name@1.2.3", "C#", "User1", "Name", SemanticVersion(1, 2, 3)); });
 	state += Soup::Test::RunTest(className, "ParsePathValues(\"../Path\")", [&testClass]() { testClass->ParsePathValues("../Path"); });
+	state += Soup::Test::RunTest(className, "ParseRepeatedValue", [&testClass]() { testClass->ParseRepeatedValue(); });
 	state += Soup::Test::RunTest(className, "TryParseValues(\"Package@1.2.3\", true)", [&testClass]() { testClass->TryParseValues("Package@1.2.3", true); });
 	state += Soup::Test::RunTest(className, "TryParseValues(\"Package@2\", true)", [&testClass]() { testClass->TryParseValues("Package@2", true); });
 	state += Soup::Test::RunTest(className, "ToStringNamedValues(std::nullopt, std::nullopt, \"Name\", std::nullopt, \"Name\")", [&testClass]() { testClass->ToStringNamedValues(std::nullopt, std::nullopt, "Name", std::nullopt, "Name"); });
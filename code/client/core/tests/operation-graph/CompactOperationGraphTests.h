@@ -0,0 +1,146 @@
+// <copyright file="CompactOperationGraphTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class CompactOperationGraphTests
+	{
+	public:
+		// [[Fact]]
+		void Initialize_Empty()
+		{
+			auto graph = OperationGraph(
+				std::vector<OperationId>(),
+				std::vector<OperationInfo>());
+			auto uut = CompactOperationGraph(graph);
+
+			Assert::AreEqual<uint32_t>(0, uut.GetOperationCount(), "Verify operation count matches expected.");
+			Assert::AreEqual<OperationId>(0, uut.GetOperationIdLimit(), "Verify operation id limit matches expected.");
+			Assert::IsFalse(uut.HasOperation(1), "Verify operation does not exist.");
+		}
+
+		// [[Fact]]
+		void Initialize_Multiple()
+		{
+			auto graph = OperationGraph(
+				std::vector<OperationId>({ 1, }),
+				std::vector<OperationInfo>({
+					OperationInfo(
+						1,
+						"TestOperation1",
+						CommandInfo(
+							Path("C:/Root/"),
+							Path("./DoStuff1.exe"),
+							{}),
+						{ 1, 2, },
+						{ 3, },
+						{ 4, },
+						{ 5, 6, },
+						{ 3, 4, },
+						1),
+					OperationInfo(
+						3,
+						"TestOperation3",
+						CommandInfo(
+							Path("C:/Root/"),
+							Path("./DoStuff3.exe"),
+							{}),
+						{ 3, },
+						{ 7, },
+						{ },
+						{ },
+						{ 4, },
+						1),
+					OperationInfo(
+						4,
+						"TestOperation4",
+						CommandInfo(
+							Path("C:/Root/"),
+							Path("./DoStuff4.exe"),
+							{}),
+						{ 3, 7, },
+						{ 8, },
+						{ },
+						{ },
+						{ },
+						2),
+				}));
+			auto uut = CompactOperationGraph(graph);
+
+			Assert::AreEqual<uint32_t>(3, uut.GetOperationCount(), "Verify operation count matches expected.");
+			Assert::AreEqual<OperationId>(5, uut.GetOperationIdLimit(), "Verify operation id limit matches expected.");
+			Assert::AreEqual(
+				std::vector<OperationId>({ 1, }),
+				uut.GetRootOperationIds(),
+				"Verify root operation ids match expected.");
+
+			Assert::IsTrue(uut.HasOperation(1), "Verify operation exists.");
+			Assert::IsFalse(uut.HasOperation(2), "Verify operation does not exist.");
+			Assert::IsTrue(uut.HasOperation(3), "Verify operation exists.");
+			Assert::IsTrue(uut.HasOperation(4), "Verify operation exists.");
+			Assert::IsFalse(uut.HasOperation(5), "Verify operation does not exist.");
+
+			Assert::AreEqual(
+				std::string("TestOperation3"),
+				uut.GetOperationInfo(3).Title,
+				"Verify operation title matches expected.");
+
+			auto declaredInput = uut.GetDeclaredInput(1);
+			Assert::AreEqual(
+				std::vector<FileId>({ 1, 2, }),
+				std::vector<FileId>(declaredInput.begin(), declaredInput.end()),
+				"Verify declared input matches expected.");
+			auto declaredOutput = uut.GetDeclaredOutput(1);
+			Assert::AreEqual(
+				std::vector<FileId>({ 3, }),
+				std::vector<FileId>(declaredOutput.begin(), declaredOutput.end()),
+				"Verify declared output matches expected.");
+			auto readAccess = uut.GetReadAccess(1);
+			Assert::AreEqual(
+				std::vector<FileId>({ 4, }),
+				std::vector<FileId>(readAccess.begin(), readAccess.end()),
+				"Verify read access matches expected.");
+			auto writeAccess = uut.GetWriteAccess(1);
+			Assert::AreEqual(
+				std::vector<FileId>({ 5, 6, }),
+				std::vector<FileId>(writeAccess.begin(), writeAccess.end()),
+				"Verify write access matches expected.");
+
+			auto children1 = uut.GetChildren(1);
+			Assert::AreEqual(
+				std::vector<OperationId>({ 3, 4, }),
+				std::vector<OperationId>(children1.begin(), children1.end()),
+				"Verify children match expected.");
+			auto children4 = uut.GetChildren(4);
+			Assert::AreEqual(
+				std::vector<OperationId>(),
+				std::vector<OperationId>(children4.begin(), children4.end()),
+				"Verify children match expected.");
+			auto declaredInput4 = uut.GetDeclaredInput(4);
+			Assert::AreEqual(
+				std::vector<FileId>({ 3, 7, }),
+				std::vector<FileId>(declaredInput4.begin(), declaredInput4.end()),
+				"Verify declared input matches expected.");
+
+			Assert::AreEqual<uint32_t>(2, uut.GetDependencyCount(4), "Verify dependency count matches expected.");
+		}
+
+		// [[Fact]]
+		void GetOperationInfo_MissingThrows()
+		{
+			auto graph = OperationGraph(
+				std::vector<OperationId>(),
+				std::vector<OperationInfo>());
+			auto uut = CompactOperationGraph(graph);
+
+			auto exception = Assert::Throws<std::runtime_error>([&uut]() {
+				auto operationInfo = uut.GetOperationInfo(1);
+			});
+
+			Assert::AreEqual("The provided operation id does not exist", exception.what(), "Verify Exception message");
+		}
+	};
+}
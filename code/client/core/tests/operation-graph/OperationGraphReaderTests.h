@@ -342,5 +342,274 @@ namespace Soup::Core::UnitTests
 				actual.GetOperations(),
 				"Verify operations match expected.");
 		}
+
+		// [[Fact]]
+		void Deserialize_InvalidStringOffsetThrows()
+		{
+			auto fileSystemState = FileSystemState();
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'O', 'G', '\0', 0x07, 0x00, 0x00, 0x00,
+				'S', 'T', 'R', '\0', 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00,
+				'a', 'r', 'g', '1',
+				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'R', 'O', 'P', '\0', 0x00, 0x00, 0x00, 0x00,
+				'O', 'P', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'V', 'A', 'L', '\0', 0x00, 0x00, 0x00, 0x00,
+			});
+			auto content = std::stringstream(std::string((char*)binaryFileContent.data(), binaryFileContent.size()));
+
+			auto exception = Assert::Throws<std::runtime_error>([&content, &fileSystemState]() {
+				auto actual = OperationGraphReader::Deserialize(content, fileSystemState);
+			});
+
+			Assert::AreEqual("Invalid operation graph string offset", exception.what(), "Verify Exception message");
+		}
+
+		// [[Fact]]
+		void Deserialize_StringTable_Multiple()
+		{
+			auto fileSystemState = FileSystemState(
+				20,
+				{
+					{ 11, Path("C:/File1") },
+					{ 12, Path("C:/File2") },
+					{ 15, Path("C:/File5") },
+					{ 16, Path("C:/File6") },
+				});
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'O', 'G', '\0', 0x07, 0x00, 0x00, 0x00,
+				'S', 'T', 'R', '\0', 0x0D, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+				0x20, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+				0x48, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+				0x6C, 0x00, 0x00, 0x00,
+				'C', ':', '/', 'F', 'i', 'l', 'e', '1',
+				'C', ':', '/', 'F', 'i', 'l', 'e', '2',
+				'C', ':', '/', 'F', 'i', 'l', 'e', '5',
+				'C', ':', '/', 'F', 'i', 'l', 'e', '6',
+				'T', 'e', 's', 't', 'O', 'p', 'e', 'r', 'a', 't', 'i', 'o', 'n', '1',
+				'C', ':', '/', 'R', 'o', 'o', 't', '/',
+				'.', '/', 'D', 'o', 'S', 't', 'u', 'f', 'f', '1', '.', 'e', 'x', 'e',
+				'a', 'r', 'g', '1',
+				'a', 'r', 'g', '2',
+				'T', 'e', 's', 't', 'O', 'p', 'e', 'r', 'a', 't', 'i', 'o', 'n', '2',
+				'.', '/', 'D', 'o', 'S', 't', 'u', 'f', 'f', '2', '.', 'e', 'x', 'e',
+				'a', 'r', 'g', '3',
+				'a', 'r', 'g', '4',
+				'F', 'I', 'S', '\0', 0x04, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+				'R', 'O', 'P', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x06, 0x00, 0x00, 0x00,
+				'O', 'P', 'S', '\0', 0x02, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00,
+				0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00,
+				0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
+				'V', 'A', 'L', '\0', 0x09, 0x00, 0x00, 0x00,
+				0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x0B, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00,
+			});
+			auto content = std::stringstream(std::string((char*)binaryFileContent.data(), binaryFileContent.size()));
+
+			auto actual = OperationGraphReader::Deserialize(content, fileSystemState);
+
+			auto expected = std::map<OperationId, OperationInfo>(
+			{
+				{
+					5,
+					OperationInfo(
+						5,
+						"TestOperation1",
+						CommandInfo(
+							Path("C:/Root/"),
+							Path("./DoStuff1.exe"),
+							{ "arg1", "arg2" }),
+						{ 11, },
+						{ 12, },
+						{ },
+						{ },
+						{ },
+						2),
+				},
+				{
+					6,
+					OperationInfo(
+						6,
+						"TestOperation2",
+						CommandInfo(
+							Path("C:/Root/"),
+							Path("./DoStuff2.exe"),
+							{ "arg3", "arg4" }),
+						{ 15, },
+						{ 16, },
+						{ 15, },
+						{ },
+						{ },
+						1),
+				},
+			});
+
+			Assert::AreEqual(
+				std::vector<OperationId>({ 6, }),
+				actual.GetRootOperationIds(),
+				"Verify root operation ids match expected.");
+			Assert::AreEqual(
+				expected,
+				actual.GetOperations(),
+				"Verify operations match expected.");
+		}
+
+		// [[Fact]]
+		void Deserialize_ResourcePool()
+		{
+			auto fileSystemState = FileSystemState();
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'O', 'G', '\0', 0x08, 0x00, 0x00, 0x00,
+				'S', 'T', 'R', '\0', 0x06, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+				0x26, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00,
+				'T', 'e', 's', 't', 'O', 'p', 'e', 'r', 'a', 't', 'i', 'o', 'n',
+				'C', ':', '/', 'R', 'o', 'o', 't', '/',
+				'.', '/', 'D', 'o', 'S', 't', 'u', 'f', 'f', '.', 'e', 'x', 'e',
+				'a', 'r', 'g', '1',
+				'a', 'r', 'g', '2',
+				'L', 'i', 'n', 'k',
+				'\0', '\0',
+				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'R', 'O', 'P', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00,
+				'O', 'P', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+				'V', 'A', 'L', '\0', 0x02, 0x00, 0x00, 0x00,
+				0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+			});
+			auto content = std::stringstream(std::string((char*)binaryFileContent.data(), binaryFileContent.size()));
+
+			auto actual = OperationGraphReader::Deserialize(content, fileSystemState);
+
+			auto expected = std::map<OperationId, OperationInfo>(
+			{
+				{
+					5,
+					OperationInfo(
+						5,
+						"TestOperation",
+						CommandInfo(
+							Path("C:/Root/"),
+							Path("./DoStuff.exe"),
+							{ "arg1", "arg2" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ },
+						1,
+						"Link",
+						4),
+				},
+			});
+
+			Assert::AreEqual(
+				std::vector<OperationId>({ 5, }),
+				actual.GetRootOperationIds(),
+				"Verify root operation ids match expected.");
+			Assert::AreEqual(
+				expected,
+				actual.GetOperations(),
+				"Verify operations match expected.");
+		}
+
+		// [[Fact]]
+		void DeserializeCompact_ResourcePool()
+		{
+			auto fileSystemState = FileSystemState();
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'O', 'G', '\0', 0x08, 0x00, 0x00, 0x00,
+				'S', 'T', 'R', '\0', 0x06, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+				0x26, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00,
+				'T', 'e', 's', 't', 'O', 'p', 'e', 'r', 'a', 't', 'i', 'o', 'n',
+				'C', ':', '/', 'R', 'o', 'o', 't', '/',
+				'.', '/', 'D', 'o', 'S', 't', 'u', 'f', 'f', '.', 'e', 'x', 'e',
+				'a', 'r', 'g', '1',
+				'a', 'r', 'g', '2',
+				'L', 'i', 'n', 'k',
+				'\0', '\0',
+				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'R', 'O', 'P', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00,
+				'O', 'P', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+				'V', 'A', 'L', '\0', 0x02, 0x00, 0x00, 0x00,
+				0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+			});
+			auto content = std::stringstream(std::string((char*)binaryFileContent.data(), binaryFileContent.size()));
+
+			auto actual = OperationGraphReader::DeserializeCompact(content, fileSystemState);
+
+			auto expected = std::vector<OperationInfo>(
+			{
+				OperationInfo(
+					5,
+					"TestOperation",
+					CommandInfo(
+						Path("C:/Root/"),
+						Path("./DoStuff.exe"),
+						{ "arg1", "arg2" }),
+					{ },
+					{ },
+					{ },
+					{ },
+					{ },
+					1,
+					"Link",
+					4),
+			});
+
+			Assert::AreEqual(
+				std::vector<OperationId>({ 5, }),
+				actual.GetRootOperationIds(),
+				"Verify root operation ids match expected.");
+			Assert::IsTrue(actual.HasOperation(5), "Verify operation exists.");
+			Assert::AreEqual(
+				expected,
+				actual.GetOperations(),
+				"Verify operations match expected.");
+		}
 	};
 }
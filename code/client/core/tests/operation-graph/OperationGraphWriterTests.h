@@ -21,10 +21,12 @@ namespace Soup::Core::UnitTests
 
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'G', '\0', 0x06, 0x00, 0x00, 0x00,
+				'B', 'O', 'G', '\0', 0x08, 0x00, 0x00, 0x00,
+				'S', 'T', 'R', '\0', 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 				'R', 'O', 'P', '\0', 0x00, 0x00, 0x00, 0x00,
 				'O', 'P', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'V', 'A', 'L', '\0', 0x00, 0x00, 0x00, 0x00,
 			});
 			Assert::AreEqual(
 				std::string((char*)binaryFileContent.data(), binaryFileContent.size()),
@@ -60,24 +62,31 @@ namespace Soup::Core::UnitTests
 
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'G', '\0', 0x06, 0x00, 0x00, 0x00,
+				'B', 'O', 'G', '\0', 0x08, 0x00, 0x00, 0x00,
+				'S', 'T', 'R', '\0', 0x06, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+				0x26, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00,
+				'T', 'e', 's', 't', 'O', 'p', 'e', 'r', 'a', 't', 'i', 'o', 'n',
+				'C', ':', '/', 'R', 'o', 'o', 't', '/',
+				'.', '/', 'D', 'o', 'S', 't', 'u', 'f', 'f', '.', 'e', 'x', 'e',
+				'a', 'r', 'g', '1',
+				'a', 'r', 'g', '2',
+				'\0', '\0',
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 				'R', 'O', 'P', '\0', 0x01, 0x00, 0x00, 0x00,
 				0x05, 0x00, 0x00, 0x00,
 				'O', 'P', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
-				0x05, 0x00, 0x00, 0x00,
-				0x0D, 0x00, 0x00, 0x00, 'T', 'e', 's', 't', 'O', 'p', 'e', 'r', 'a', 't', 'i', 'o', 'n',
-				0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'R', 'o', 'o', 't', '/',
-				0x0D, 0x00, 0x00, 0x00, '.', '/', 'D', 'o', 'S', 't', 'u', 'f', 'f', '.', 'e', 'x', 'e',
-				0x02, 0x00, 0x00, 0x00,
-				0x04, 0x00, 0x00, 0x00, 'a', 'r', 'g', '1',
-				0x04, 0x00, 0x00, 0x00, 'a', 'r', 'g', '2',
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 				0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				'V', 'A', 'L', '\0', 0x02, 0x00, 0x00, 0x00,
+				0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
 			});
 
 			Assert::AreEqual(
@@ -114,24 +123,31 @@ namespace Soup::Core::UnitTests
 
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'G', '\0', 0x06, 0x00, 0x00, 0x00,
+				'B', 'O', 'G', '\0', 0x08, 0x00, 0x00, 0x00,
+				'S', 'T', 'R', '\0', 0x06, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+				0x26, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00,
+				'T', 'e', 's', 't', 'O', 'p', 'e', 'r', 'a', 't', 'i', 'o', 'n',
+				'C', ':', '/', 'R', 'o', 'o', 't', '/',
+				'.', '/', 'D', 'o', 'S', 't', 'u', 'f', 'f', '.', 'e', 'x', 'e',
+				'a', 'r', 'g', '1',
+				'a', 'r', 'g', '2',
+				'\0', '\0',
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 				'R', 'O', 'P', '\0', 0x01, 0x00, 0x00, 0x00,
 				0x05, 0x00, 0x00, 0x00,
 				'O', 'P', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
-				0x05, 0x00, 0x00, 0x00,
-				0x0D, 0x00, 0x00, 0x00, 'T', 'e', 's', 't', 'O', 'p', 'e', 'r', 'a', 't', 'i', 'o', 'n',
-				0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'R', 'o', 'o', 't', '/',
-				0x0D, 0x00, 0x00, 0x00, '.', '/', 'D', 'o', 'S', 't', 'u', 'f', 'f', '.', 'e', 'x', 'e',
-				0x02, 0x00, 0x00, 0x00,
-				0x04, 0x00, 0x00, 0x00, 'a', 'r', 'g', '1',
-				0x04, 0x00, 0x00, 0x00, 'a', 'r', 'g', '2',
-				0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-				0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 				0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				'V', 'A', 'L', '\0', 0x04, 0x00, 0x00, 0x00,
+				0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
 			});
 			Assert::AreEqual(
 				std::string((char*)binaryFileContent.data(), binaryFileContent.size()),
@@ -180,37 +196,110 @@ namespace Soup::Core::UnitTests
 
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'G', '\0', 0x06, 0x00, 0x00, 0x00,
+				'B', 'O', 'G', '\0', 0x08, 0x00, 0x00, 0x00,
+				'S', 'T', 'R', '\0', 0x0A, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+				0x28, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00,
+				0x48, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00,
+				'T', 'e', 's', 't', 'O', 'p', 'e', 'r', 'a', 't', 'i', 'o', 'n', '1',
+				'C', ':', '/', 'R', 'o', 'o', 't', '/',
+				'.', '/', 'D', 'o', 'S', 't', 'u', 'f', 'f', '1', '.', 'e', 'x', 'e',
+				'a', 'r', 'g', '1',
+				'a', 'r', 'g', '2',
+				'T', 'e', 's', 't', 'O', 'p', 'e', 'r', 'a', 't', 'i', 'o', 'n', '2',
+				'.', '/', 'D', 'o', 'S', 't', 'u', 'f', 'f', '2', '.', 'e', 'x', 'e',
+				'a', 'r', 'g', '3',
+				'a', 'r', 'g', '4',
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 				'R', 'O', 'P', '\0', 0x01, 0x00, 0x00, 0x00,
 				0x06, 0x00, 0x00, 0x00,
 				'O', 'P', 'S', '\0', 0x02, 0x00, 0x00, 0x00,
-				0x05, 0x00, 0x00, 0x00,
-				0x0E, 0x00, 0x00, 0x00, 'T', 'e', 's', 't', 'O', 'p', 'e', 'r', 'a', 't', 'i', 'o', 'n', '1',
-				0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'R', 'o', 'o', 't', '/',
-				0x0E, 0x00, 0x00, 0x00, '.', '/', 'D', 'o', 'S', 't', 'u', 'f', 'f', '1', '.', 'e', 'x', 'e',
-				0x02, 0x00, 0x00, 0x00,
-				0x04, 0x00, 0x00, 0x00, 'a', 'r', 'g', '1',
-				0x04, 0x00, 0x00, 0x00, 'a', 'r', 'g', '2',
-				0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-				0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 				0x02, 0x00, 0x00, 0x00,
-				0x06, 0x00, 0x00, 0x00,
-				0x0E, 0x00, 0x00, 0x00, 'T', 'e', 's', 't', 'O', 'p', 'e', 'r', 'a', 't', 'i', 'o', 'n', '2',
-				0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'R', 'o', 'o', 't', '/',
-				0x0E, 0x00, 0x00, 0x00, '.', '/', 'D', 'o', 'S', 't', 'u', 'f', 'f', '2', '.', 'e', 'x', 'e',
-				0x02, 0x00, 0x00, 0x00,
-				0x04, 0x00, 0x00, 0x00, 'a', 'r', 'g', '3',
-				0x04, 0x00, 0x00, 0x00, 'a', 'r', 'g', '4',
-				0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-				0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-				0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+				0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				'V', 'A', 'L', '\0', 0x09, 0x00, 0x00, 0x00,
+				0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x08, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00,
+			});
+
+			Assert::AreEqual(
+				std::string((char*)binaryFileContent.data(), binaryFileContent.size()),
+				content.str(),
+				"Verify file content match expected.");
+		}
+
+		// [[Fact]]
+		void Serialize_ResourcePool()
+		{
+			auto fileSystemState = FileSystemState();
+			auto files = std::set<FileId>();
+			auto operationGraph = OperationGraph(
+				std::vector<OperationId>({ 5, }),
+				std::vector<OperationInfo>({
+					OperationInfo(
+						5,
+						"TestOperation",
+						CommandInfo(
+							Path("C:/Root/"),
+							Path("./DoStuff.exe"),
+							{ "arg1", "arg2" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ },
+						1,
+						"Link",
+						4),
+				}));
+			auto content = std::stringstream();
+
+			OperationGraphWriter::Serialize(operationGraph, files, fileSystemState, content);
+
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'O', 'G', '\0', 0x08, 0x00, 0x00, 0x00,
+				'S', 'T', 'R', '\0', 0x06, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+				0x26, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00,
+				'T', 'e', 's', 't', 'O', 'p', 'e', 'r', 'a', 't', 'i', 'o', 'n',
+				'C', ':', '/', 'R', 'o', 'o', 't', '/',
+				'.', '/', 'D', 'o', 'S', 't', 'u', 'f', 'f', '.', 'e', 'x', 'e',
+				'a', 'r', 'g', '1',
+				'a', 'r', 'g', '2',
+				'L', 'i', 'n', 'k',
+				'\0', '\0',
+				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'R', 'O', 'P', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00,
+				'O', 'P', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 				0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+				'V', 'A', 'L', '\0', 0x02, 0x00, 0x00, 0x00,
+				0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
 			});
 
 			Assert::AreEqual(
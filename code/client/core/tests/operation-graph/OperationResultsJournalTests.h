@@ -0,0 +1,200 @@
+// <copyright file="OperationResultsJournalTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class OperationResultsJournalTests
+	{
+	public:
+		// [[Fact]]
+		void Open_Append_Replay()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto fileSystemState = FileSystemState(
+				20,
+				{
+					{ 11, Path("C:/File1") },
+					{ 12, Path("C:/File2") },
+				});
+			auto evaluateTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::time_point<std::chrono::system_clock>());
+
+			auto uut = OperationResultsJournal(
+				Path("./TestFiles/.soup/Evaluate.bor"),
+				Path("./TestFiles/.soup/Evaluate.brj"),
+				fileSystemState);
+			uut.Open(OperationResults(), { }, false);
+			uut.Append(5, OperationResult(false, evaluateTime, { 11, }, { }, { 1, }));
+			uut.Append(6, OperationResult(true, evaluateTime, { 11, }, { 12, }, { 2, }));
+			uut.Append(5, OperationResult(true, evaluateTime, { 11, }, { 12, }, { 3, }));
+			uut.Close();
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"OpenWriteBinary: ./TestFiles/.soup/Evaluate.brj",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			// Replay the journal into a new file system state
+			auto mockFile = fileSystem->GetMockFile(Path("./TestFiles/.soup/Evaluate.brj"));
+			auto content = std::stringstream(mockFile->Content.str());
+			auto actualFileSystemState = FileSystemState(
+				30,
+				{
+					{ 21, Path("C:/File1") },
+					{ 22, Path("C:/File2") },
+				});
+			auto actual = OperationResults();
+			auto journaledOperations = OperationResultsJournalReader::Deserialize(content, actual, actualFileSystemState);
+
+			Assert::AreEqual(
+				std::vector<OperationId>({ 5, 6, 5, }),
+				journaledOperations,
+				"Verify journaled operations match expected.");
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>({
+					{ 5, OperationResult(true, evaluateTime, { 21, }, { 22, }, { 3, }) },
+					{ 6, OperationResult(true, evaluateTime, { 21, }, { 22, }, { 2, }) },
+				}),
+				actual.GetResults(),
+				"Verify results match expected.");
+		}
+
+		// [[Fact]]
+		void Replay_IgnoresPartialRecord()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto fileSystemState = FileSystemState(
+				20,
+				{
+					{ 11, Path("C:/File1") },
+				});
+			auto evaluateTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::time_point<std::chrono::system_clock>());
+
+			auto uut = OperationResultsJournal(
+				Path("./TestFiles/.soup/Evaluate.bor"),
+				Path("./TestFiles/.soup/Evaluate.brj"),
+				fileSystemState);
+			uut.Open(OperationResults(), { }, false);
+			uut.Append(5, OperationResult(true, evaluateTime, { 11, }, { }, { }));
+			uut.Append(6, OperationResult(true, evaluateTime, { }, { 11, }, { }));
+			uut.Close();
+
+			// Drop the end of the last record as if the build was killed while it was written
+			auto mockFile = fileSystem->GetMockFile(Path("./TestFiles/.soup/Evaluate.brj"));
+			auto fullContent = mockFile->Content.str();
+			auto content = std::stringstream(fullContent.substr(0, fullContent.size() - 3));
+
+			auto actual = OperationResults();
+			auto journaledOperations = OperationResultsJournalReader::Deserialize(content, actual, fileSystemState);
+
+			Assert::AreEqual(
+				std::vector<OperationId>({ 5, }),
+				journaledOperations,
+				"Verify journaled operations match expected.");
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>({
+					{ 5, OperationResult(true, evaluateTime, { 11, }, { }, { }) },
+				}),
+				actual.GetResults(),
+				"Verify results match expected.");
+		}
+
+		// [[Fact]]
+		void Open_CarryForwardJournaledOperations()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto fileSystemState = FileSystemState();
+			auto evaluateTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::time_point<std::chrono::system_clock>());
+			auto results = OperationResults({
+				{ 1, OperationResult(true, evaluateTime, { }, { }) },
+				{ 2, OperationResult(true, evaluateTime, { }, { }) },
+				{ 3, OperationResult(true, evaluateTime, { }, { }) },
+				{ 4, OperationResult(true, evaluateTime, { }, { }) },
+			});
+
+			auto uut = OperationResultsJournal(
+				Path("./TestFiles/.soup/Evaluate.bor"),
+				Path("./TestFiles/.soup/Evaluate.brj"),
+				fileSystemState);
+			uut.Open(results, { 3, 3, }, false);
+			uut.Close();
+
+			// Verify only the journal is written
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"OpenWriteBinary: ./TestFiles/.soup/Evaluate.brj",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			auto mockFile = fileSystem->GetMockFile(Path("./TestFiles/.soup/Evaluate.brj"));
+			auto content = std::stringstream(mockFile->Content.str());
+			auto actual = OperationResults();
+			auto journaledOperations = OperationResultsJournalReader::Deserialize(content, actual, fileSystemState);
+
+			Assert::AreEqual(
+				std::vector<OperationId>({ 3, }),
+				journaledOperations,
+				"Verify journaled operations match expected.");
+		}
+
+		// [[Fact]]
+		void Open_Compact()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto fileSystemState = FileSystemState();
+			auto evaluateTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::time_point<std::chrono::system_clock>());
+			auto results = OperationResults({
+				{ 1, OperationResult(true, evaluateTime, { }, { }) },
+				{ 2, OperationResult(true, evaluateTime, { }, { }) },
+			});
+
+			auto uut = OperationResultsJournal(
+				Path("./TestFiles/.soup/Evaluate.bor"),
+				Path("./TestFiles/.soup/Evaluate.brj"),
+				fileSystemState);
+			uut.Open(results, { 1, 2, }, false);
+			uut.Close();
+
+			// Verify the journal is reset before the full results are saved
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"OpenWriteBinary: ./TestFiles/.soup/Evaluate.brj",
+					"OpenWriteBinary: ./TestFiles/.soup/Evaluate.bor",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'R', 'J', '\0', 0x02, 0x00, 0x00, 0x00,
+			});
+			auto mockFile = fileSystem->GetMockFile(Path("./TestFiles/.soup/Evaluate.brj"));
+			Assert::AreEqual(
+				std::string((char*)binaryFileContent.data(), binaryFileContent.size()),
+				mockFile->Content.str(),
+				"Verify file content match expected.");
+		}
+	};
+}
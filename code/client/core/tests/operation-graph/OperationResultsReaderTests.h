@@ -252,5 +252,84 @@ namespace Soup::Core::UnitTests
 				actual.GetResults(),
 				"Verify results match expected.");
 		}
+
+		// [[Fact]]
+		void Deserialize_ContentHashes()
+		{
+			auto fileSystemState = FileSystemState(
+				20,
+				{
+					{ 11, Path("C:/File1") },
+					{ 12, Path("C:/File2") },
+					{ 13, Path("C:/File3") },
+					{ 14, Path("C:/File4") },
+				});
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'O', 'R', '\0', 0x03, 0x00, 0x00, 0x00,
+				'F', 'I', 'S', '\0', 0x04, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '1',
+				0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '2',
+				0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '3',
+				0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '4',
+				'R', 'T', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
+				0x10, 0x16, 0x62, 0xbb, 0x0b, 0x41, 0x38, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00,
+				0x99, 0xe9, 0xd8, 0x51, 0x37, 0xdb, 0x46, 0xef,
+				0x99, 0x09, 0x77, 0xad, 0xf5, 0x2c, 0xbc, 0x44,
+				0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+			});
+			auto content = std::stringstream(std::string((char*)binaryFileContent.data(), binaryFileContent.size()));
+
+			auto actual = OperationResultsReader::Deserialize(content, fileSystemState);
+
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>({
+					{
+						5,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::sys_days(March/5/2020) + 12h + 35min + 34s + 1ms),
+							{ 11, 13, },
+							{ 12, 14, },
+							{ 0xEF46DB3751D8E999, 0x44BC2CF5AD770999, }),
+					}
+				}),
+				actual.GetResults(),
+				"Verify results match expected.");
+		}
+
+		// [[Fact]]
+		void Deserialize_RunStatistics()
+		{
+			auto fileSystemState = FileSystemState();
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'O', 'R', '\0', 0x04, 0x00, 0x00, 0x00,
+				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'R', 'T', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x60, 0xe3, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+			});
+			auto content = std::stringstream(std::string((char*)binaryFileContent.data(), binaryFileContent.size()));
+
+			auto actual = OperationResultsReader::Deserialize(content, fileSystemState);
+
+			OperationResult* result;
+			Assert::IsTrue(actual.TryFindResult(5, result), "Verify result was found.");
+			Assert::IsTrue(result->WasSuccessfulRun, "Verify was successful run matches expected.");
+			Assert::AreEqual<int64_t>(1500000, result->EvaluateDuration.count(), "Verify evaluate duration matches expected.");
+			Assert::AreEqual<uint64_t>(268435456, result->PeakMemoryUsage, "Verify peak memory usage matches expected.");
+		}
 	};
 }
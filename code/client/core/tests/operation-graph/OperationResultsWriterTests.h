@@ -22,7 +22,7 @@ namespace Soup::Core::UnitTests
 
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'R', '\0', 0x02, 0x00, 0x00, 0x00,
+				'B', 'O', 'R', '\0', 0x04, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 				'R', 'T', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 			});
@@ -54,12 +54,15 @@ namespace Soup::Core::UnitTests
 
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'R', '\0', 0x02, 0x00, 0x00, 0x00,
+				'B', 'O', 'R', '\0', 0x04, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 				'R', 'T', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
 				0x05, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 			});
@@ -92,13 +95,16 @@ namespace Soup::Core::UnitTests
 
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'R', '\0', 0x02, 0x00, 0x00, 0x00,
+				'B', 'O', 'R', '\0', 0x04, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 				'R', 'T', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
 				0x05, 0x00, 0x00, 0x00,
 				0x01, 0x00, 0x00, 0x00,
 				0x10, 0x16, 0x62, 0xbb, 0x0b, 0x41, 0x38, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 				0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 				0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
 			});
 			Assert::AreEqual(
@@ -138,18 +144,24 @@ namespace Soup::Core::UnitTests
 
 auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'R', '\0', 0x02, 0x00, 0x00, 0x00,
+				'B', 'O', 'R', '\0', 0x04, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 				'R', 'T', 'S', '\0', 0x02, 0x00, 0x00, 0x00,
 				0x05, 0x00, 0x00, 0x00,
 				0x01, 0x00, 0x00, 0x00,
 				0x10, 0x16, 0x62, 0xbb, 0x0b, 0x41, 0x38, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 				0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 				0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
 				0x06, 0x00, 0x00, 0x00,
 				0x01, 0x00, 0x00, 0x00,
 				0x80, 0x8d, 0xa9, 0xeb, 0x0b, 0x41, 0x38, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 				0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
 				0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
 			});
 
@@ -158,5 +170,49 @@ auto binaryFileContent = std::vector<uint8_t>(
 				content.str(),
 				"Verify file content match expected.");
 		}
+
+		// [[Fact]]
+		void Serialize_RunStatistics()
+		{
+			auto fileSystemState = FileSystemState();
+			auto files = std::set<FileId>();
+			auto operationResults = OperationResults({
+				{
+					5,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::time_point<std::chrono::system_clock>()),
+						{ },
+						{ },
+						{ },
+						std::chrono::microseconds(1500000),
+						268435456)
+				},
+			});
+			auto content = std::stringstream();
+
+			OperationResultsWriter::Serialize(operationResults, files, fileSystemState, content);
+
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'O', 'R', '\0', 0x04, 0x00, 0x00, 0x00,
+				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'R', 'T', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x60, 0xe3, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+			});
+
+			Assert::AreEqual(
+				std::string((char*)binaryFileContent.data(), binaryFileContent.size()),
+				content.str(),
+				"Verify file content match expected.");
+		}
 	};
 }
@@ -0,0 +1,66 @@
+// <copyright file="PackageReferenceParserTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class PackageReferenceParserTests
+	{
+	public:
+		// [[Theory]]
+		// [[InlineData("Name", std::nullopt, std::nullopt, "Name", std::nullopt)]]
+		// [[InlineData("Name.Sub_1@1.2.3", std::nullopt, std::nullopt, "Name.Sub_1", "1.2.3")]]
+		// [[InlineData("[C++]Name@2", "C++", std::nullopt, "Name", "2")]]
+		// [[InlineData("[C#]User1|Name", "C#", "User1", "Name", std::nullopt)]]
+		// [[InlineData("[C#]User1|Name@1.2", "C#", "User1", "Name", "1.2")]]
+		void TryParseNamedValues(
+			std::string value,
+			std::optional<std::string> language,
+			std::optional<std::string> owner,
+			std::string name,
+			std::optional<std::string> version)
+		{
+			auto uut = PackageReferenceParts();
+			auto result = PackageReferenceParser::TryParse(value, uut);
+
+			Assert::IsTrue(result, "Verify parse succeeded.");
+			AreEqual(language, uut.Language, "Verify language matches expected.");
+			AreEqual(owner, uut.Owner, "Verify owner matches expected.");
+			Assert::AreEqual(name, std::string(uut.Name), "Verify name matches expected.");
+			AreEqual(version, uut.Version, "Verify version matches expected.");
+		}
+
+		// [[Theory]]
+		// [[InlineData("")]]
+		// [[InlineData("1Name")]]
+		// [[InlineData("[]Name")]]
+		// [[InlineData("[C#Name")]]
+		// [[InlineData("User1|")]]
+		// [[InlineData("User1|Name|Name")]]
+		// [[InlineData("Name@")]]
+		// [[InlineData("Name@1.")]]
+		// [[InlineData("Name@1.2.3.4")]]
+		// [[InlineData("Name@1-2")]]
+		// [[InlineData("../Path")]]
+		void TryParseInvalidValues(std::string value)
+		{
+			auto uut = PackageReferenceParts();
+			auto result = PackageReferenceParser::TryParse(value, uut);
+
+			Assert::IsFalse(result, "Verify parse failed.");
+		}
+
+	private:
+		static void AreEqual(
+			const std::optional<std::string>& expected,
+			const std::optional<std::string_view>& actual,
+			const char* message)
+		{
+			Assert::AreEqual(expected.has_value(), actual.has_value(), message);
+			if (expected.has_value())
+				Assert::AreEqual(expected.value(), std::string(actual.value()), message);
+		}
+	};
+}
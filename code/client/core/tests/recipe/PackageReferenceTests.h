@@ -180,6 +180,18 @@ namespace Soup::Core::UnitTests
 				"Verify matches expected values.");
 		}
 
+		// [[Fact]]
+		void ParseRepeatedValue()
+		{
+			auto first = PackageReference::Parse("[C#]User1|Name@1.2.3");
+			auto second = PackageReference::Parse("[C#]User1|Name@1.2.3");
+			Assert::AreEqual(
+				PackageReference("C#", "User1", "Name", SemanticVersion(1, 2, 3)),
+				second,
+				"Verify repeated parse matches expected values.");
+			Assert::AreEqual(first, second, "Verify repeated parse matches first parse.");
+		}
+
 		// [[Theory]]
 		// [[InlineData("Package@1.2.3", true)]] // Success
 		// [[InlineData("Package@2", true)]] // Success
@@ -82,6 +82,19 @@ namespace Soup::Core::Generate
 			"		_workingDirectory = workingDirectory\n"
 			"		_declaredInput = declaredInput\n"
 			"		_declaredOutput = declaredOutput\n"
+			"		_resourcePool = \"\"\n"
+			"		_resourceWeight = 1\n"
+			"	}\n"
+			"\n"
+			"	construct new(title, executable, arguments, workingDirectory, declaredInput, declaredOutput, resourcePool, resourceWeight) {\n"
+			"		_title = title\n"
+			"		_executable = executable\n"
+			"		_arguments = arguments\n"
+			"		_workingDirectory = workingDirectory\n"
+			"		_declaredInput = declaredInput\n"
+			"		_declaredOutput = declaredOutput\n"
+			"		_resourcePool = resourcePool\n"
+			"		_resourceWeight = resourceWeight\n"
 			"	}\n"
 			"\n"
 			"	title { _title }\n"
@@ -90,12 +103,18 @@ namespace Soup::Core::Generate
 			"	workingDirectory { _workingDirectory }\n"
 			"	declaredInput { _declaredInput }\n"
 			"	declaredOutput { _declaredOutput }\n"
+			"	resourcePool { _resourcePool }\n"
+			"	resourceWeight { _resourceWeight }\n"
 			"\n"
 			"	==(other) {\n"
 			"		return this.toString == other.toString\n"
 			"	}\n"
 			"\n"
 			"	toString {\n"
+			"		if (_resourcePool != \"\") {\n"
+			"			return \"SoupTestOperation { Title=%(_title), Executable=%(_executable), Arguments=%(_arguments), WorkingDirectory=%(_workingDirectory), DeclaredInput=%(_declaredInput), DeclaredOutput=%(_declaredOutput), ResourcePool=%(_resourcePool), ResourceWeight=%(_resourceWeight) }\"\n"
+			"		}\n"
+			"\n"
 			"		return \"SoupTestOperation { Title=%(_title), Executable=%(_executable), Arguments=%(_arguments), WorkingDirectory=%(_workingDirectory), DeclaredInput=%(_declaredInput), DeclaredOutput=%(_declaredOutput) }\"\n"
 			"	}\n"
 			"}\n"
@@ -132,6 +151,11 @@ namespace Soup::Core::Generate
 			"		__operations.add(SoupTestOperation.new(title, executable, arguments, workingDirectory, declaredInput, declaredOutput))\n"
 			"	}\n"
 			"\n"
+			"	static createOperation(title, executable, arguments, workingDirectory, declaredInput, declaredOutput, resourcePool, resourceWeight) {\n"
+			"		if (__operations is Null) Fiber.abort(\"Operations not initialized.\")\n"
+			"		__operations.add(SoupTestOperation.new(title, executable, arguments, workingDirectory, declaredInput, declaredOutput, resourcePool, resourceWeight))\n"
+			"	}\n"
+			"\n"
 			"	static info(message) {\n"
 			"		if (__logs is Null) Fiber.abort(\"Logs not initialized.\")\n"
 			"		__logs.add(\"INFO: %(message)\")\n"
@@ -180,6 +204,18 @@ namespace Soup::Core::Generate
 			"		SoupTest.createOperation(title, executable, arguments, workingDirectory, declaredInput, declaredOutput)\n"
 			"	}\n"
 			"\n"
+			"	static createOperation(title, executable, arguments, workingDirectory, declaredInput, declaredOutput, resourcePool, resourceWeight) {\n"
+			"		if (!(title is String)) Fiber.abort(\"Title must be a string.\")\n"
+			"		if (!(executable is String)) Fiber.abort(\"Executable must be a string.\")\n"
+			"		if (!(arguments is List)) Fiber.abort(\"Arguments must be a list.\")\n"
+			"		if (!(workingDirectory is String)) Fiber.abort(\"WorkingDirectory must be a string.\")\n"
+			"		if (!(declaredInput is List)) Fiber.abort(\"DeclaredInput must be a list.\")\n"
+			"		if (!(declaredOutput is List)) Fiber.abort(\"DeclaredOutput must be a list.\")\n"
+			"		if (!(resourcePool is String)) Fiber.abort(\"ResourcePool must be a string.\")\n"
+			"		if (!(resourceWeight is Num) || !resourceWeight.isInteger || resourceWeight < 1) Fiber.abort(\"ResourceWeight must be a positive integer.\")\n"
+			"		SoupTest.createOperation(title, executable, arguments, workingDirectory, declaredInput, declaredOutput, resourcePool, resourceWeight)\n"
+			"	}\n"
+			"\n"
 			"	static info(message) {\n"
 			"		if (!(message is String)) Fiber.abort(\"Message must be a string.\")\n"
 			"		SoupTest.info(message)\n"
@@ -16,15 +16,36 @@ namespace Soup::Core::Generate
 	private:
 		std::map<std::string, ExtensionTaskDetails> _tasks;
 
+		// The Wren Hosts keyed by script file
+		std::map<std::string, std::unique_ptr<GenerateHost>> _hosts;
+
+		// The script files whose current host has already evaluated a task
+		std::set<std::string> _evaluatedHosts;
+
 	public:
 		/// <summary>
 		/// Initializes a new instance of the <see cref="ExtensionManager"/> class.
 		/// </summary>
 		ExtensionManager() :
-			_tasks()
+			_tasks(),
+			_hosts(),
+			_evaluatedHosts()
 		{
 		}
 
+		/// <summary>
+		/// Register an interpreted extension host to evaluate the first task discovered from its script
+		/// </summary>
+		void RegisterExtensionHost(const Path& scriptFile, std::unique_ptr<GenerateHost> host)
+		{
+			auto insertResult = _hosts.emplace(scriptFile.ToString(), std::move(host));
+			if (!insertResult.second)
+			{
+				Log::HighPriority("An extension host with the provided script has already been registered: {}", scriptFile.ToString());
+				throw std::runtime_error("An extension host with the provided script has already been registered");
+			}
+		}
+
 		/// <summary>
 		/// Register extension task
 		/// </summary>
@@ -71,6 +92,21 @@ namespace Soup::Core::Generate
 			}
 		}
 
+		/// <summary>
+		/// Get the set of script files that were loaded by all extension hosts
+		/// </summary>
+		std::vector<Path> GetLoadedFiles() const
+		{
+			auto result = std::vector<Path>();
+			for (auto& [scriptFile, host] : _hosts)
+			{
+				auto& loadedFiles = host->GetLoadedFiles();
+				result.insert(result.end(), loadedFiles.begin(), loadedFiles.end());
+			}
+
+			return result;
+		}
+
 		/// <summary>
 		/// Execute all build extensions
 		/// </summary>
@@ -110,22 +146,24 @@ namespace Soup::Core::Generate
 				if (currentTask == nullptr)
 					throw std::runtime_error("TryFindNextTask returned empty result");
 
-				// Create a Wren Host to evaluate the extension task
-				auto host = std::make_unique<GenerateHost>(currentTask->ScriptFile, currentTask->BundlesFile);
-				host->InterpretMain();
+				// Get a Wren Host that has not evaluated any other task
+				auto& host = GetExtensionHost(*currentTask);
 
 				// Set the current state AFTER we initialize to prevent pre-loading
-				host->SetState(state);
+				host.SetState(state);
 
 				Log::Info("TaskStart: {}", currentTask->Name);
 
-				host->EvaluateTask(currentTask->Name);
+				{
+					auto span = BuildTraceSpan(currentTask->Name, "ExtensionTask");
+					host.EvaluateTask(currentTask->Name);
+				}
 
 				Log::Info("TaskDone: {}", currentTask->Name);
 
 				// Get the final state to be passed to the next extension
-				auto updatedActiveState = host->GetUpdatedActiveState();
-				auto updatedSharedState = host->GetUpdatedSharedState();
+				auto updatedActiveState = host.GetUpdatedActiveState();
+				auto updatedSharedState = host.GetUpdatedSharedState();
 
 				auto runBeforeList = ValueList();
 				for (const auto& value : currentTask->RunBeforeList)
@@ -169,6 +207,27 @@ namespace Soup::Core::Generate
 		}
 
 	private:
+		/// <summary>
+		/// Get the Wren Host for the script that owns the extension task.
+		/// The registered host is only used for the first task it evaluates, Wren cannot reset the class statics
+		/// and module variables a task leaves behind so every later task gets a newly interpreted host.
+		/// </summary>
+		GenerateHost& GetExtensionHost(const ExtensionTaskDetails& task)
+		{
+			auto scriptFile = task.ScriptFile.ToString();
+			auto findResult = _hosts.find(scriptFile);
+			if (findResult != _hosts.end() && _evaluatedHosts.insert(scriptFile).second)
+				return *findResult->second;
+
+			auto host = std::make_unique<GenerateHost>(task.ScriptFile, task.BundlesFile);
+			host->InterpretMain();
+
+			_evaluatedHosts.insert(scriptFile);
+			auto& result = _hosts[std::move(scriptFile)];
+			result = std::move(host);
+			return *result;
+		}
+
 		/// <summary>
 		/// Try to find the next task that has yet to be run and is ready
 		/// Returns false if all tasks have been run
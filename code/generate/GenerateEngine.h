@@ -11,18 +11,64 @@ namespace Soup::Core::Generate
 	class GenerateEngine
 	{
 	private:
-		FileSystemState _fileSystemState;
+		// The state owned by a standalone generate, an in-process generate is given the state by the build
+		FileSystemState _localFileSystemState;
+		RecipeCache _localRecipeCache;
+
+		FileSystemState& _fileSystemState;
+		RecipeCache& _recipeCache;
+
+		// The files accessed during generate to be used for incremental builds
+		std::set<std::string> _observedInput;
+		std::set<std::string> _observedOutput;
+
 	public:
 		GenerateEngine() :
-			_fileSystemState()
+			_localFileSystemState(),
+			_localRecipeCache(),
+			_fileSystemState(_localFileSystemState),
+			_recipeCache(_localRecipeCache),
+			_observedInput(),
+			_observedOutput()
 		{
 		}
 
-		void Run(const Path& soupTargetDirectory)
+		GenerateEngine(FileSystemState& fileSystemState, RecipeCache& recipeCache) :
+			_localFileSystemState(),
+			_localRecipeCache(),
+			_fileSystemState(fileSystemState),
+			_recipeCache(recipeCache),
+			_observedInput(),
+			_observedOutput()
 		{
-			// Run all build operations in the correct order with incremental build checks
-			Log::Diag("Build generate start: {}", soupTargetDirectory.ToString());
+		}
+
+		/// <summary>
+		/// Get the set of files that were read during generate
+		/// </summary>
+		std::vector<Path> GetObservedInput() const
+		{
+			auto result = std::vector<Path>();
+			for (auto& value : _observedInput)
+				result.push_back(Path(value));
+
+			return result;
+		}
+
+		/// <summary>
+		/// Get the set of files that were written during generate
+		/// </summary>
+		std::vector<Path> GetObservedOutput() const
+		{
+			auto result = std::vector<Path>();
+			for (auto& value : _observedOutput)
+				result.push_back(Path(value));
+
+			return result;
+		}
 
+		void Run(const Path& soupTargetDirectory)
+		{
 			// Load the input file
 			auto inputFile = soupTargetDirectory + BuildConstants::GenerateInputFileName();
 			auto inputTable = ValueTable();
@@ -32,6 +78,21 @@ namespace Soup::Core::Generate
 				throw std::runtime_error("Failed to load input file.");
 			}
 
+			Run(soupTargetDirectory, inputTable);
+		}
+
+		/// <summary>
+		/// Run generate with an input table that is already loaded,
+		/// the table must match the content of the input file
+		/// </summary>
+		void Run(const Path& soupTargetDirectory, const ValueTable& inputTable)
+		{
+			// Run all build operations in the correct order with incremental build checks
+			Log::Diag("Build generate start: {}", soupTargetDirectory.ToString());
+
+			auto inputFile = soupTargetDirectory + BuildConstants::GenerateInputFileName();
+			TouchFileRead(inputFile);
+
 			auto packageRoot = Path(inputTable.at("PackageRoot").AsString());
 			auto userDataPath = Path(inputTable.at("UserDataPath").AsString());
 
@@ -42,13 +103,15 @@ namespace Soup::Core::Generate
 
 			// Load the recipe file
 			auto recipeFile = packageRoot + BuildConstants::RecipeFileName();
-			Recipe recipe;
-			if (!RecipeExtensions::TryLoadRecipeFromFile(recipeFile, recipe))
+			const Recipe* recipe;
+			if (!_recipeCache.TryGetOrLoadRecipe(recipeFile, recipe))
 			{
 				Log::Error("Failed to load the recipe: {}", recipeFile.ToString());
 				throw std::runtime_error("Failed to load recipe.");
 			}
 
+			TouchFileRead(recipeFile);
+
 			// Load the input macro definition
 			auto generateMacros = std::map<std::string, std::string>();
 			for (auto& [key, value] : inputTable.at("GenerateMacros").AsTable())
@@ -100,13 +163,13 @@ namespace Soup::Core::Generate
 			globalState.emplace("SDKs", std::move(sdkParameters));
 
 			// Initialize the Recipe Root Table
-			auto recipeState = RecipeBuildStateConverter::ConvertToBuildState(recipe.GetTable());
+			auto recipeState = RecipeBuildStateConverter::ConvertToBuildState(recipe->GetTable());
 			globalState.emplace("Recipe", Value(std::move(recipeState)));
 
 			// Initialize input global state
 			for (auto& [key, value] : inputTable.at("GlobalState").AsTable())
 			{
-				globalState.emplace(key, std::move(value));
+				globalState.emplace(key, value);
 			}
 
 			// Merge the dependencies state
@@ -134,7 +197,8 @@ namespace Soup::Core::Generate
 					Log::Info("Bundles: {}", buildExtension.second.value().ToString());
 				}
 
-				// Create a temporary Wren Host to discover all build extensions
+				// Create a Wren Host to discover all build extensions
+				// Note: The host is kept alive to evaluate the first discovered task without interpreting the script again
 				auto host = std::make_unique<GenerateHost>(buildExtension.first, buildExtension.second);
 				host->InterpretMain();
 				auto extensions = host->DiscoverExtensions();
@@ -143,6 +207,8 @@ namespace Soup::Core::Generate
 				{
 					extensionManager.RegisterExtensionTask(std::move(extension));
 				}
+
+				extensionManager.RegisterExtensionHost(buildExtension.first, std::move(host));
 			}
 
 			// Evaluate the build extensions
@@ -153,15 +219,19 @@ namespace Soup::Core::Generate
 				evaluateAllowedWriteAccess);
 			extensionManager.Execute(buildState);
 
+			for (auto& file : extensionManager.GetLoadedFiles())
+				TouchFileRead(file);
+
 			// Grab the build results
-			auto generateInfoTable = buildState.GetGenerateInfo();
 			auto evaluateGraph = buildState.BuildOperationGraph();
+			auto generateInfoTable = buildState.GetGenerateInfo();
 			auto sharedState = buildState.GetSharedState();
 
 			// Save the runtime information so Soup View can easily visualize runtime
 			auto generateInfoStateFile = soupTargetDirectory + BuildConstants::GenerateInfoFileName();
 			Log::Info("Save Generate Info State: {}", generateInfoStateFile.ToString());
 			ValueTableManager::SaveState(generateInfoStateFile, generateInfoTable);
+			TouchFileWrite(generateInfoStateFile);
 
 			// Resolve macros before saving evaluate graph
 			Log::Diag("Resolve build macros in evaluate graph");
@@ -170,19 +240,31 @@ namespace Soup::Core::Generate
 			// Save the operation graph so the evaluate phase can load it
 			auto evaluateGraphFile = soupTargetDirectory + BuildConstants::EvaluateGraphFileName();
 			OperationGraphManager::SaveState(evaluateGraphFile, evaluateGraph, _fileSystemState);
+			TouchFileWrite(evaluateGraphFile);
 
 			// Save the shared state that is to be passed to the downstream builds
 			auto sharedStateFile = soupTargetDirectory + BuildConstants::GenerateSharedStateFileName();
 			ValueTableManager::SaveState(sharedStateFile, sharedState);
+			TouchFileWrite(sharedStateFile);
 
 			Log::Diag("Build generate end");
 		}
 
 	private:
+		void TouchFileRead(const Path& file)
+		{
+			_observedInput.insert(file.ToString());
+		}
+
+		void TouchFileWrite(const Path& file)
+		{
+			_observedOutput.insert(file.ToString());
+		}
+
 		/// <summary>
 		/// Load Local User Config and process any known state
 		/// </summary>
-		static void LoadLocalUserConfig(
+		void LoadLocalUserConfig(
 			const Path& userDataPath,
 			ValueList& sdkParameters,
 			std::vector<Path>& sdkReadAccess)
@@ -190,7 +272,11 @@ namespace Soup::Core::Generate
 			// Load the local user config
 			auto localUserConfigPath = userDataPath + BuildConstants::LocalUserConfigFileName();
 			LocalUserConfig localUserConfig = {};
-			if (!LocalUserConfigExtensions::TryLoadLocalUserConfigFromFile(localUserConfigPath, localUserConfig))
+			if (LocalUserConfigExtensions::TryLoadLocalUserConfigFromFile(localUserConfigPath, localUserConfig))
+			{
+				TouchFileRead(localUserConfigPath);
+			}
+			else
 			{
 				Log::Warning("Local User Config invalid");
 			}
@@ -231,7 +317,7 @@ namespace Soup::Core::Generate
 		/// Using the parameters to resolve the dependency output folders, load up the shared state table and
 		/// combine them into a single value table to be used as input the this generate phase.
 		/// </summary>
-		static ValueTable LoadDependenciesSharedState(
+		ValueTable LoadDependenciesSharedState(
 			MacroManager& generateSubGraphMacroManager,
 			const ValueTable& inputTable)
 		{
@@ -265,6 +351,8 @@ namespace Soup::Core::Generate
 							throw std::runtime_error("Failed to load shared state file.");
 						}
 
+						TouchFileRead(sharedStateFile);
+
 						// Hack
 						sharedStateTable = ResolveMacros(hackMacroManager, sharedStateTable);
 
@@ -395,22 +483,89 @@ namespace Soup::Core::Generate
 		}
 
 		void ResolveMacros(
-			MacroManager& macroManager,
+			const MacroManager& macroManager,
 			OperationGraph& operationGraph)
 		{
+			auto operations = std::vector<OperationInfo*>();
+			operations.reserve(operationGraph.GetOperations().size());
 			for (auto& [operationId, operation] : operationGraph.GetOperations())
+				operations.push_back(&operation);
+
+			// Resolve the values for chunks of operations in parallel, the file system state is only read
+			// and the resolved files are mapped back to ids afterwards
+			auto resolvedFiles = std::vector<std::array<std::vector<Path>, 4>>(operations.size());
+			RunParallelChunks(
+				operations.size(),
+				[&](size_t begin, size_t end)
+				{
+					for (auto i = begin; i < end; i++)
+					{
+						auto& operation = *operations[i];
+						ResolveMacros(macroManager, operation.Command.Arguments);
+						operation.Command.WorkingDirectory = macroManager.ResolveMacros(std::move(operation.Command.WorkingDirectory));
+						operation.Command.Executable = macroManager.ResolveMacros(std::move(operation.Command.Executable));
+						resolvedFiles[i][0] = ResolveMacros(macroManager, operation.DeclaredInput);
+						resolvedFiles[i][1] = ResolveMacros(macroManager, operation.DeclaredOutput);
+						resolvedFiles[i][2] = ResolveMacros(macroManager, operation.ReadAccess);
+						resolvedFiles[i][3] = ResolveMacros(macroManager, operation.WriteAccess);
+					}
+				});
+
+			for (size_t i = 0; i < operations.size(); i++)
+			{
+				auto& operation = *operations[i];
+				UpdateFileIds(resolvedFiles[i][0], operation.DeclaredInput);
+				UpdateFileIds(resolvedFiles[i][1], operation.DeclaredOutput);
+				UpdateFileIds(resolvedFiles[i][2], operation.ReadAccess);
+				UpdateFileIds(resolvedFiles[i][3], operation.WriteAccess);
+			}
+		}
+
+		/// <summary>
+		/// Split the work into contiguous chunks that run on their own threads, small amounts of work run inline
+		/// </summary>
+		static void RunParallelChunks(size_t count, const std::function<void(size_t, size_t)>& callback)
+		{
+			const size_t minChunkSize = 512;
+			auto chunkCount = std::min<size_t>(
+				std::max(1u, std::thread::hardware_concurrency()),
+				(count + minChunkSize - 1) / minChunkSize);
+			if (chunkCount <= 1)
 			{
-				ResolveMacros(macroManager, operation.Command.Arguments);
-				operation.Command.WorkingDirectory = macroManager.ResolveMacros(std::move(operation.Command.WorkingDirectory));
-				operation.Command.Executable = macroManager.ResolveMacros(std::move(operation.Command.Executable));
-				ResolveMacros(macroManager, operation.DeclaredInput);
-				ResolveMacros(macroManager, operation.DeclaredOutput);
-				ResolveMacros(macroManager, operation.ReadAccess);
-				ResolveMacros(macroManager, operation.WriteAccess);
+				callback(0, count);
+				return;
+			}
+
+			auto chunkSize = (count + chunkCount - 1) / chunkCount;
+			auto failures = std::vector<std::exception_ptr>(chunkCount);
+			auto workers = std::vector<std::thread>();
+			for (size_t chunk = 0; chunk < chunkCount; chunk++)
+			{
+				workers.emplace_back([&, chunk]()
+				{
+					try
+					{
+						auto begin = chunk * chunkSize;
+						callback(begin, std::min(begin + chunkSize, count));
+					}
+					catch (...)
+					{
+						failures[chunk] = std::current_exception();
+					}
+				});
+			}
+
+			for (auto& worker : workers)
+				worker.join();
+
+			for (auto& failure : failures)
+			{
+				if (failure != nullptr)
+					std::rethrow_exception(failure);
 			}
 		}
 
-		void ResolveMacros(MacroManager& macroManager, std::vector<std::string>& value)
+		static void ResolveMacros(const MacroManager& macroManager, std::vector<std::string>& value)
 		{
 			for(size_t i = 0; i < value.size(); i++)
 			{
@@ -419,17 +574,27 @@ namespace Soup::Core::Generate
 			}
 		}
 
-		void ResolveMacros(MacroManager& macroManager, std::vector<FileId>& value)
+		std::vector<Path> ResolveMacros(const MacroManager& macroManager, const std::vector<FileId>& value) const
 		{
-			for(size_t i = 0; i < value.size(); i++)
+			auto result = std::vector<Path>();
+			result.reserve(value.size());
+			for (auto fileId : value)
+			{
+				result.push_back(macroManager.ResolveMacros(_fileSystemState.GetFilePath(fileId)));
+			}
+
+			return result;
+		}
+
+		void UpdateFileIds(const std::vector<Path>& files, std::vector<FileId>& value)
+		{
+			for (size_t i = 0; i < files.size(); i++)
 			{
-				Path file = _fileSystemState.GetFilePath(value[i]);
-				auto resolvedFile = macroManager.ResolveMacros(file);
-				value[i] = _fileSystemState.ToFileId(resolvedFile);
+				value[i] = _fileSystemState.ToFileId(files[i]);
 			}
 		}
 
-		static ValueTable ResolveMacros(MacroManager& macroManager, const ValueTable& table)
+		static ValueTable ResolveMacros(const MacroManager& macroManager, const ValueTable& table)
 		{
 			auto result = ValueTable();
 			for (auto& [key, value] : table)
@@ -446,7 +611,7 @@ namespace Soup::Core::Generate
 			return result;
 		}
 
-		static ValueList ResolveMacros(MacroManager& macroManager, const ValueList& list)
+		static ValueList ResolveMacros(const MacroManager& macroManager, const ValueList& list)
 		{
 			auto result = ValueList();
 			for (auto& value : list)
@@ -457,7 +622,7 @@ namespace Soup::Core::Generate
 			return result;
 		}
 
-		static Value ResolveMacros(MacroManager& macroManager, const Value& value)
+		static Value ResolveMacros(const MacroManager& macroManager, const Value& value)
 		{
 			switch (value.GetType())
 			{
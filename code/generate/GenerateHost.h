@@ -12,6 +12,11 @@ namespace Soup::Core::Generate
 		static inline const char* SoupClassName = "Soup";
 		static inline const char* SoupTaskClassName = "SoupTask";
 
+		// The identifiers for the state tables that are lazily loaded into the Soup class
+		static inline const int GlobalStateId = 0;
+		static inline const int ActiveStateId = 1;
+		static inline const int SharedStateId = 2;
+
 	private:
 		GenerateState* _state;
 
@@ -88,25 +93,12 @@ namespace Soup::Core::Generate
 		ValueTable GetUpdatedActiveState()
 		{
 			Log::Diag("GetUpdatedActiveState");
-			wrenEnsureSlots(_vm, 1);
-			wrenGetVariable(_vm, SoupModuleName, SoupClassName, 0);
-
-			auto soupClassType = wrenGetSlotType(_vm, 0);
-			if (soupClassType != WREN_TYPE_UNKNOWN) {
-				throw std::runtime_error("Missing Class Soup");
-			}
-
-			auto soupClassHandle = SmartHandle(_vm, wrenGetSlotHandle(_vm, 0));
-
-			// Call ActiveState
-			auto activeStateGetterHandle = SmartHandle(_vm, wrenMakeCallHandle(_vm, "activeState"));
-			wrenSetSlotHandle(_vm, 0, soupClassHandle);
-			WrenHelpers::ThrowIfFailed(wrenCall(_vm, activeStateGetterHandle));
+			if (_state == nullptr)
+				throw std::runtime_error("Cannot get ActiveState at this time");
 
 			try
 			{
-				auto result = WrenValueTable::GetSlotTable(_vm, 0);
-				return result;
+				return GetUpdatedState(ActiveStateId, _state->GetActiveState());
 			}
 			catch(const InvalidTypeException& exception)
 			{
@@ -120,25 +112,12 @@ namespace Soup::Core::Generate
 		ValueTable GetUpdatedSharedState()
 		{
 			Log::Diag("GetUpdatedSharedState");
-			wrenEnsureSlots(_vm, 1);
-			wrenGetVariable(_vm, SoupModuleName, SoupClassName, 0);
-
-			auto soupClassType = wrenGetSlotType(_vm, 0);
-			if (soupClassType != WREN_TYPE_UNKNOWN) {
-				throw std::runtime_error("Missing Class Soup");
-			}
-
-			auto soupClassHandle = SmartHandle(_vm, wrenGetSlotHandle(_vm, 0));
-
-			// Call SharedState
-			auto sharedStateGetterHandle = SmartHandle(_vm, wrenMakeCallHandle(_vm, "sharedState"));
-			wrenSetSlotHandle(_vm, 0, soupClassHandle);
-			WrenHelpers::ThrowIfFailed(wrenCall(_vm, sharedStateGetterHandle));
+			if (_state == nullptr)
+				throw std::runtime_error("Cannot get SharedState at this time");
 
 			try
 			{
-				auto result = WrenValueTable::GetSlotTable(_vm, 0);
-				return result;
+				return GetUpdatedState(SharedStateId, _state->GetSharedState());
 			}
 			catch(const InvalidTypeException& exception)
 			{
@@ -188,13 +167,9 @@ namespace Soup::Core::Generate
 			{
 				if (className == SoupClassName && isStatic)
 				{
-					if (signature == "loadGlobalState_()")
-						return SoupLoadGlobalState;
-					else if (signature == "loadActiveState_()")
-						return SoupLoadActiveState;
-					else if (signature == "loadSharedState_()")
-						return SoupLoadSharedState;
-					else if (signature == "createOperation_(_,_,_,_,_,_)")
+					if (signature == "loadState_(_)")
+						return SoupLoadState;
+					else if (signature == "createOperation_(_,_,_,_,_,_,_,_)")
 						return SoupCreateOperation;
 					else if (signature == "info_(_)")
 						return SoupLogInfo;
@@ -230,47 +205,65 @@ namespace Soup::Core::Generate
 			return WrenHelpers::GetSlotStringList(_vm, 0, 1);
 		}
 
-		void SoupLoadGlobalState()
+		/// <summary>
+		/// Get the state table after the task has run.
+		/// The table is only converted back from Wren if the script loaded it, otherwise it cannot
+		/// have changed and the original table is returned as is.
+		/// </summary>
+		ValueTable GetUpdatedState(int stateId, const ValueTable& sourceTable)
 		{
-			try
-			{
-				Log::Diag("SoupLoadGlobalState");
-				if (_state == nullptr)
-					throw std::runtime_error("Cannot load GlobalState at this time");
+			wrenEnsureSlots(_vm, 2);
+			wrenGetVariable(_vm, SoupModuleName, SoupClassName, 0);
 
-				WrenValueTable::SetSlotTable(_vm, 0, _state->GetGlobalState());
-			}
-			catch(const std::exception& ex)
-			{
-				WrenHelpers::GenerateRuntimeError(_vm, ex.what());
+			auto soupClassType = wrenGetSlotType(_vm, 0);
+			if (soupClassType != WREN_TYPE_UNKNOWN) {
+				throw std::runtime_error("Missing Class Soup");
 			}
+
+			auto soupClassHandle = SmartHandle(_vm, wrenGetSlotHandle(_vm, 0));
+
+			// Get the loaded state without forcing it to load
+			auto loadedStateHandle = SmartHandle(_vm, wrenMakeCallHandle(_vm, "loadedState_(_)"));
+			wrenSetSlotHandle(_vm, 0, soupClassHandle);
+			wrenSetSlotDouble(_vm, 1, stateId);
+			WrenHelpers::ThrowIfFailed(wrenCall(_vm, loadedStateHandle));
+
+			if (wrenGetSlotType(_vm, 0) == WREN_TYPE_NULL)
+				return sourceTable;
+			else
+				return WrenValueTable::GetSlotTable(_vm, 0);
 		}
 
-		void SoupLoadActiveState()
+		const ValueTable& GetStateTable(int stateId)
 		{
-			try
-			{
-				Log::Diag("SoupLoadActiveState");
-				if (_state == nullptr)
-					throw std::runtime_error("Cannot load ActiveState at this time");
+			if (_state == nullptr)
+				throw std::runtime_error("Cannot load state at this time");
 
-				WrenValueTable::SetSlotTable(_vm, 0, _state->GetActiveState());
-			}
-			catch(const std::exception& exception)
+			switch (stateId)
 			{
-				WrenHelpers::GenerateRuntimeError(_vm, exception.what());
+				case GlobalStateId:
+					return _state->GetGlobalState();
+				case ActiveStateId:
+					return _state->GetActiveState();
+				case SharedStateId:
+					return _state->GetSharedState();
+				default:
+					throw std::runtime_error("Unknown state table");
 			}
 		}
 
-		void SoupLoadSharedState()
+		void SoupLoadState()
 		{
 			try
 			{
-				Log::Diag("SoupLoadSharedState");
-				if (_state == nullptr)
-					throw std::runtime_error("Cannot load SharedState at this time");
+				Log::Diag("SoupLoadState");
+				auto parameter1 = wrenGetSlotType(_vm, 1);
+				if (parameter1 != WREN_TYPE_NUM) {
+					throw std::runtime_error("SoupLoadState parameter 1 must be of type number");
+				}
+				auto& table = GetStateTable(static_cast<int>(wrenGetSlotDouble(_vm, 1)));
 
-				WrenValueTable::SetSlotTable(_vm, 0, _state->GetSharedState());
+				WrenValueTable::SetSlotTable(_vm, 0, table);
 			}
 			catch(const std::exception& exception)
 			{
@@ -302,7 +295,7 @@ namespace Soup::Core::Generate
 				if (parameter3 != WREN_TYPE_LIST) {
 					throw std::runtime_error("SoupCreateOperation parameter 3 must be of type list");
 				}
-				auto arguments = WrenHelpers::GetSlotStringList(_vm, 3, 7);
+				auto arguments = WrenHelpers::GetSlotStringList(_vm, 3, 9);
 				
 				auto parameter4 = wrenGetSlotType(_vm, 4);
 				if (parameter4 != WREN_TYPE_STRING) {
@@ -314,13 +307,25 @@ namespace Soup::Core::Generate
 				if (parameter5 != WREN_TYPE_LIST) {
 					throw std::runtime_error("SoupCreateOperation parameter 5 must be of type list");
 				}
-				auto declaredInput = WrenHelpers::GetSlotStringList(_vm, 5, 7);
+				auto declaredInput = WrenHelpers::GetSlotStringList(_vm, 5, 9);
 
 				auto parameter6 = wrenGetSlotType(_vm, 6);
 				if (parameter6 != WREN_TYPE_LIST) {
 					throw std::runtime_error("SoupCreateOperation parameter 6 must be of type list");
 				}
-				auto declaredOutput = WrenHelpers::GetSlotStringList(_vm, 6, 7);
+				auto declaredOutput = WrenHelpers::GetSlotStringList(_vm, 6, 9);
+
+				auto parameter7 = wrenGetSlotType(_vm, 7);
+				if (parameter7 != WREN_TYPE_STRING) {
+					throw std::runtime_error("SoupCreateOperation parameter 7 must be of type string");
+				}
+				auto resourcePool = std::string(wrenGetSlotString(_vm, 7));
+
+				auto parameter8 = wrenGetSlotType(_vm, 8);
+				if (parameter8 != WREN_TYPE_NUM) {
+					throw std::runtime_error("SoupCreateOperation parameter 8 must be of type number");
+				}
+				auto resourceWeight = static_cast<uint32_t>(wrenGetSlotDouble(_vm, 8));
 
 				_state->CreateOperation(
 					std::move(title),
@@ -328,7 +333,9 @@ namespace Soup::Core::Generate
 					std::move(arguments),
 					std::move(workingDirectory),
 					std::move(declaredInput),
-					std::move(declaredOutput));
+					std::move(declaredOutput),
+					std::move(resourcePool),
+					resourceWeight);
 
 				// No return value
 				wrenEnsureSlots(_vm, 1);
@@ -361,22 +368,10 @@ namespace Soup::Core::Generate
 			wrenSetSlotNull(_vm, 0);
 		}
 
-		static void SoupLoadGlobalState(WrenVM* vm)
-		{
-			auto host = (GenerateHost*)wrenGetUserData(vm);
-			host->SoupLoadGlobalState();
-		}
-
-		static void SoupLoadActiveState(WrenVM* vm)
-		{
-			auto host = (GenerateHost*)wrenGetUserData(vm);
-			host->SoupLoadActiveState();
-		}
-
-		static void SoupLoadSharedState(WrenVM* vm)
+		static void SoupLoadState(WrenVM* vm)
 		{
 			auto host = (GenerateHost*)wrenGetUserData(vm);
-			host->SoupLoadSharedState();
+			host->SoupLoadState();
 		}
 
 		static void SoupCreateOperation(WrenVM* vm)
@@ -417,28 +412,40 @@ namespace Soup::Core::Generate
 			"\n"
 			"class Soup {\n"
 			"	static globalState {\n"
-			"		if (__globalState is Null) __globalState = loadGlobalState_()\n"
+			"		if (__globalState is Null) __globalState = loadState_(0)\n"
 			"		return __globalState\n"
 			"	}\n"
 			"\n"
 			"	static activeState {\n"
-			"		if (__activeState is Null) __activeState = loadActiveState_()\n"
+			"		if (__activeState is Null) __activeState = loadState_(1)\n"
 			"		return __activeState\n"
 			"	}\n"
 			"\n"
 			"	static sharedState {\n"
-			"		if (__sharedState is Null) __sharedState = loadSharedState_()\n"
+			"		if (__sharedState is Null) __sharedState = loadState_(2)\n"
 			"		return __sharedState\n"
 			"	}\n"
 			"\n"
+			"	static loadedState_(id) {\n"
+			"		if (id == 1) return __activeState\n"
+			"		if (id == 2) return __sharedState\n"
+			"		return __globalState\n"
+			"	}\n"
+			"\n"
 			"	static createOperation(title, executable, arguments, workingDirectory, declaredInput, declaredOutput) {\n"
+			"		createOperation(title, executable, arguments, workingDirectory, declaredInput, declaredOutput, \"\", 1)\n"
+			"	}\n"
+			"\n"
+			"	static createOperation(title, executable, arguments, workingDirectory, declaredInput, declaredOutput, resourcePool, resourceWeight) {\n"
 			"		if (!(title is String)) Fiber.abort(\"Title must be a string.\")\n"
 			"		if (!(executable is String)) Fiber.abort(\"Executable must be a string.\")\n"
 			"		if (!(arguments is List)) Fiber.abort(\"Arguments must be a list.\")\n"
 			"		if (!(workingDirectory is String)) Fiber.abort(\"WorkingDirectory must be a string.\")\n"
 			"		if (!(declaredInput is List)) Fiber.abort(\"DeclaredInput must be a list.\")\n"
 			"		if (!(declaredOutput is List)) Fiber.abort(\"DeclaredOutput must be a list.\")\n"
-			"		createOperation_(title, executable, arguments, workingDirectory, declaredInput, declaredOutput)\n"
+			"		if (!(resourcePool is String)) Fiber.abort(\"ResourcePool must be a string.\")\n"
+			"		if (!(resourceWeight is Num) || !resourceWeight.isInteger || resourceWeight < 1) Fiber.abort(\"ResourceWeight must be a positive integer.\")\n"
+			"		createOperation_(title, executable, arguments, workingDirectory, declaredInput, declaredOutput, resourcePool, resourceWeight)\n"
 			"	}\n"
 			"\n"
 			"	static info(message) {\n"
@@ -456,10 +463,8 @@ namespace Soup::Core::Generate
 			"		error_(message)\n"
 			"	}\n"
 			"\n"
-			"	foreign static loadGlobalState_()\n"
-			"	foreign static loadActiveState_()\n"
-			"	foreign static loadSharedState_()\n"
-			"	foreign static createOperation_(title, executable, arguments, workingDirectory, declaredInput, declaredOutput)\n"
+			"	foreign static loadState_(id)\n"
+			"	foreign static createOperation_(title, executable, arguments, workingDirectory, declaredInput, declaredOutput, resourcePool, resourceWeight)\n"
 			"	foreign static info_(message)\n"
 			"	foreign static warning_(message)\n"
 			"	foreign static error_(message)\n"
@@ -75,7 +75,7 @@ namespace Soup::Core::Generate
 		}
 
 		/// <summary>
-		/// Create a build operation
+		/// Create a build operation, operations in the same resource pool share its limit
 		/// </summary>
 		void CreateOperation(
 			std::string title,
@@ -83,7 +83,9 @@ namespace Soup::Core::Generate
 			std::vector<std::string> arguments,
 			std::string workingDirectory,
 			std::vector<std::string> declaredInput,
-			std::vector<std::string> declaredOutput)
+			std::vector<std::string> declaredOutput,
+			std::string resourcePool,
+			uint32_t resourceWeight)
 		{
 			auto declaredInputPaths = std::vector<Path>();
 			for (auto& value : declaredInput)
@@ -99,7 +101,9 @@ namespace Soup::Core::Generate
 				std::move(arguments),
 				Path(std::move(workingDirectory)),
 				std::move(declaredInputPaths),
-				std::move(declaredOutputPaths));
+				std::move(declaredOutputPaths),
+				std::move(resourcePool),
+				resourceWeight);
 		}
 
 		void Update(ValueTable activeState, ValueTable sharedState)
@@ -110,7 +114,12 @@ namespace Soup::Core::Generate
 
 		OperationGraph BuildOperationGraph()
 		{
-			return _graphGenerator.FinalizeGraph();
+			auto result = _graphGenerator.FinalizeGraph();
+
+			// Keep the time spent building the graph with the runtime information
+			_generateInfo.insert_or_assign("OperationGraph", Value(_graphGenerator.GetGenerateInfo()));
+
+			return result;
 		}
 	};
 }
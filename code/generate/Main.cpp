@@ -3,15 +3,19 @@
 // </copyright>
 
 #include <algorithm>
+#include <array>
+#include <chrono>
 #include <filesystem>
 #include <format>
 #include <fstream>
+#include <functional>
 #include <map>
 #include <optional>
 #include <set>
 #include <stdexcept>
 #include <string>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 // TODO import
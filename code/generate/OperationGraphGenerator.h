@@ -24,6 +24,15 @@ namespace Soup::Core::Generate
 		std::map<FileId, OperationId> _outputFileLookup;
 		std::map<FileId, OperationId> _outputDirectoryLookup;
 
+		// The declared outputs sorted by path so the files under a directory are a single range
+		// and the directories that contain a file can be found from each prefix of its path
+		std::map<std::string, std::pair<FileId, OperationId>, std::less<>> _outputFilePathLookup;
+		std::map<std::string, OperationId, std::less<>> _outputDirectoryPathLookup;
+
+		// The time spent building the graph
+		std::chrono::duration<double> _createOperationTime;
+		std::chrono::duration<double> _finalizeGraphTime;
+
 	public:
 		OperationGraphGenerator(
 			FileSystemState& fileSystemState,
@@ -36,13 +45,29 @@ namespace Soup::Core::Generate
 			_graph(),
 			_inputFileLookup(),
 			_outputFileLookup(),
-			_outputDirectoryLookup()
+			_outputDirectoryLookup(),
+			_outputFilePathLookup(),
+			_outputDirectoryPathLookup(),
+			_createOperationTime(0),
+			_finalizeGraphTime(0)
 		{
 		}
 
+		/// <summary>
+		/// Get the runtime information for building the graph
+		/// </summary>
+		ValueTable GetGenerateInfo() const
+		{
+			auto result = ValueTable();
+			result.emplace("OperationCount", Value(static_cast<int64_t>(_uniqueId)));
+			result.emplace("CreateOperationTime", Value(_createOperationTime.count()));
+			result.emplace("FinalizeGraphTime", Value(_finalizeGraphTime.count()));
+			return result;
+		}
+
 		/// <summary>
 		/// Create an operation graph from the provided generated graph
-		/// At the same time verify that there are no cycles
+		/// The graph is checked for cycles once it is finalized
 		/// </summary>
 		void CreateOperation(
 			std::string title,
@@ -51,12 +76,41 @@ namespace Soup::Core::Generate
 			Path workingDirectory,
 			std::vector<Path> declaredInput,
 			std::vector<Path> declaredOutput)
+		{
+			CreateOperation(
+				std::move(title),
+				std::move(executable),
+				std::move(arguments),
+				std::move(workingDirectory),
+				std::move(declaredInput),
+				std::move(declaredOutput),
+				std::string(),
+				1);
+		}
+
+		/// <summary>
+		/// Create an operation that shares the named resource pool with other operations,
+		/// the weight is the share of the pool it uses while it runs
+		/// </summary>
+		void CreateOperation(
+			std::string title,
+			Path executable,
+			std::vector<std::string> arguments,
+			Path workingDirectory,
+			std::vector<Path> declaredInput,
+			std::vector<Path> declaredOutput,
+			std::string resourcePool,
+			uint32_t resourceWeight)
 		{
 			Log::Diag("Create Operation: {}", title);
+			auto startTime = std::chrono::high_resolution_clock::now();
 
 			if (!workingDirectory.HasRoot())
 				throw std::runtime_error("Working directory must be an absolute path.");
 
+			if (resourceWeight == 0)
+				throw std::runtime_error("Resource weight must be at least one.");
+
 			// Build up the operation unique command
 			auto commandInfo = CommandInfo(
 				std::move(workingDirectory),
@@ -108,14 +162,23 @@ namespace Soup::Core::Generate
 				declaredOutputFileIds,
 				readAccessFileIds,
 				writeAccessFileIds);
+			operationInfo.ResourcePool = std::move(resourcePool);
+			operationInfo.ResourceWeight = resourceWeight;
 			auto& operationInfoReference = _graph.AddOperation(std::move(operationInfo));
 
 			StoreLookupInfo(operationInfoReference);
 			ResolveDependencies(operationInfoReference);
+
+			_createOperationTime += std::chrono::high_resolution_clock::now() - startTime;
 		}
 
 		OperationGraph FinalizeGraph()
 		{
+			auto startTime = std::chrono::high_resolution_clock::now();
+
+			// Ensure there are no circular references before walking the graph from the roots
+			CheckCircularReferences();
+
 			// Add any operation with zero dependencies to the root
 			auto rootOperations = std::vector<OperationId>();
 			for (auto& [_, activeOperationInfo] : _graph.GetOperations())
@@ -170,6 +233,8 @@ namespace Soup::Core::Generate
 				}
 			}
 
+			_finalizeGraphTime = std::chrono::high_resolution_clock::now() - startTime;
+
 			return _graph;
 		}
 
@@ -180,7 +245,7 @@ namespace Soup::Core::Generate
 			// and help build up the dependency graph
 			for (auto file : operationInfo.DeclaredOutput)
 			{
-				auto& filePath = _fileSystemState.GetFilePath(file);
+				auto filePath = _fileSystemState.GetFilePath(file);
 				if (filePath.HasFileName())
 				{
 					CheckSetOutputFileOperation(file, operationInfo);
@@ -193,7 +258,7 @@ namespace Soup::Core::Generate
 
 			for (auto file : operationInfo.DeclaredInput)
 			{
-				auto& filePath = _fileSystemState.GetFilePath(file);
+				auto filePath = _fileSystemState.GetFilePath(file);
 				if (filePath.HasFileName())
 				{
 					AddInputFileOperation(file, operationInfo);
@@ -233,19 +298,26 @@ namespace Soup::Core::Generate
 			// Check for output directories that are under previous output files
 			for (auto file : operationInfo.DeclaredOutput)
 			{
-				auto& filePath = _fileSystemState.GetFilePath(file);
+				auto filePath = _fileSystemState.GetFilePath(file);
 
 				// If this is a directory output check if under previous output files
 				if (!filePath.HasFileName())
 				{
-					for (auto outputFile : _outputFileLookup)
+					// Visit the matches in file id order to keep the child order stable
+					auto matchedOutputFiles = std::vector<std::pair<FileId, OperationId>>();
+					const auto& directory = filePath.ToString();
+					for (auto outputFile = _outputFilePathLookup.lower_bound(directory);
+						outputFile != _outputFilePathLookup.end() && outputFile->first.starts_with(directory);
+						outputFile++)
 					{
-						auto& outputFilePath = _fileSystemState.GetFilePath(outputFile.first);
-						if (outputFilePath.ToString().starts_with(filePath.ToString()))
-						{
-							// The active operation must run before the matched file output operation
-							CheckAddChildOperation(operationInfo, _graph.GetOperationInfo(outputFile.second));
-						}
+						matchedOutputFiles.push_back(outputFile->second);
+					}
+
+					std::sort(matchedOutputFiles.begin(), matchedOutputFiles.end());
+					for (auto& [outputFileId, outputOperationId] : matchedOutputFiles)
+					{
+						// The active operation must run before the matched file output operation
+						CheckAddChildOperation(operationInfo, _graph.GetOperationInfo(outputOperationId));
 					}
 				}
 			}
@@ -253,55 +325,96 @@ namespace Soup::Core::Generate
 			// Check for output files that are under previous output directories
 			for (auto file : operationInfo.DeclaredOutput)
 			{
-				auto& filePath = _fileSystemState.GetFilePath(file);
-				auto parentDirectory = filePath.GetParent();
-				auto done = false;
-				while (!done)
+				auto outputFilePath = _fileSystemState.GetFilePath(file);
+				auto filePath = std::string_view(outputFilePath.ToString());
+				if (filePath.ends_with('/'))
+					filePath.remove_suffix(1);
+
+				// Check each parent directory from the closest to the root
+				auto separator = filePath.rfind('/');
+				while (separator != std::string_view::npos)
 				{
-					FileId parentDirectoryId;
-					if (_fileSystemState.TryFindFileId(parentDirectory, parentDirectoryId))
+					auto findResult = _outputDirectoryPathLookup.find(filePath.substr(0, separator + 1));
+					if (findResult != _outputDirectoryPathLookup.end())
 					{
-						OperationId matchedOperation;
-						if (TryGetOutputDirectoryOperation(parentDirectoryId, matchedOperation))
-						{
-							// The matched directory output operation must run before the active operation
-							CheckAddChildOperation(_graph.GetOperationInfo(matchedOperation), operationInfo);
-						}
+						// The matched directory output operation must run before the active operation
+						CheckAddChildOperation(_graph.GetOperationInfo(findResult->second), operationInfo);
 					}
 
-					// Get the next parent directory
-					auto nextParentDirectory = parentDirectory.GetParent();
-					done = nextParentDirectory.ToString().size() == parentDirectory.ToString().size();
-					parentDirectory = nextParentDirectory;
+					separator = separator > 0 ? filePath.rfind('/', separator - 1) : std::string_view::npos;
 				}
 			}
-
-			// Ensure there are no circular references
-			auto closure = std::set<OperationId>();
-			BuildChildClosure(operationInfo.Children, closure);
-			if (closure.contains(operationInfo.Id))
-			{
-				throw std::runtime_error("Operation introduced circular reference");
-			}
 		}
 
-		void BuildChildClosure(
-			const std::vector<OperationId>& operations,
-			std::set<OperationId>& closure)
+		/// <summary>
+		/// Walk the entire graph once depth first and report the first cycle that is found
+		/// </summary>
+		void CheckCircularReferences()
 		{
-			for (auto operationId : operations)
+			enum class VisitState : uint8_t
 			{
-				// Check if this node was already handled in a different branch
-				if (!closure.contains(operationId))
+				Unvisited,
+				Active,
+				Done,
+			};
+
+			auto visitState = std::vector<VisitState>(static_cast<size_t>(_uniqueId) + 1, VisitState::Unvisited);
+
+			// The active path of operations and the next child to visit for each
+			auto stack = std::vector<std::pair<OperationId, size_t>>();
+			for (auto& [operationId, _] : _graph.GetOperations())
+			{
+				if (visitState[operationId] != VisitState::Unvisited)
+					continue;
+
+				visitState[operationId] = VisitState::Active;
+				stack.push_back({ operationId, 0 });
+				while (!stack.empty())
 				{
-					closure.insert(operationId);
+					auto& [activeId, childIndex] = stack.back();
+					auto& children = _graph.GetOperationInfo(activeId).Children;
+					if (childIndex == children.size())
+					{
+						visitState[activeId] = VisitState::Done;
+						stack.pop_back();
+						continue;
+					}
 
-					auto& operation = _graph.GetOperationInfo(operationId);
-					BuildChildClosure(operation.Children, closure);
+					auto childId = children[childIndex++];
+					switch (visitState[childId])
+					{
+						case VisitState::Unvisited:
+							visitState[childId] = VisitState::Active;
+							stack.push_back({ childId, 0 });
+							break;
+						case VisitState::Active:
+							throw std::runtime_error(
+								std::format("Operation introduced circular reference: {}", GetCyclePath(stack, childId)));
+						case VisitState::Done:
+							break;
+					}
 				}
 			}
 		}
 
+		std::string GetCyclePath(
+			const std::vector<std::pair<OperationId, size_t>>& stack,
+			OperationId operationId)
+		{
+			auto result = std::stringstream();
+			auto start = std::find_if(
+				stack.begin(),
+				stack.end(),
+				[&](const auto& entry) { return entry.first == operationId; });
+			for (auto iterator = start; iterator != stack.end(); iterator++)
+			{
+				result << "\"" << _graph.GetOperationInfo(iterator->first).Title << "\" -> ";
+			}
+
+			result << "\"" << _graph.GetOperationInfo(operationId).Title << "\"";
+			return result.str();
+		}
+
 		void BuildRecursiveChildSets(
 			std::map<OperationId, std::set<OperationId>>& recursiveChildren,
 			const std::vector<OperationId>& operations)
@@ -425,23 +538,6 @@ namespace Soup::Core::Generate
 			}
 		}
 
-		bool TryGetOutputDirectoryOperation(
-			FileId file,
-			OperationId& operationId)
-		{
-			auto findResult = _outputDirectoryLookup.find(file);
-			if (findResult != _outputDirectoryLookup.end())
-			{
-				operationId = findResult->second;
-				return true;
-			}
-			else
-			{
-				operationId = 0;
-				return false;
-			}
-		}
-
 		void CheckSetOutputFileOperation(
 			FileId file,
 			const OperationInfo& operation)
@@ -449,7 +545,7 @@ namespace Soup::Core::Generate
 			auto findResult = _outputFileLookup.find(file);
 			if (findResult != _outputFileLookup.end())
 			{
-				auto& filePath = _fileSystemState.GetFilePath(file);
+				auto filePath = _fileSystemState.GetFilePath(file);
 				auto& existingOperation = _graph.GetOperationInfo(findResult->second);
 				throw std::runtime_error(
 					std::format("File \"{}\" already written to by operation \"{}\"",
@@ -459,6 +555,9 @@ namespace Soup::Core::Generate
 			else
 			{
 				_outputFileLookup.emplace(file, operation.Id);
+				_outputFilePathLookup.emplace(
+					_fileSystemState.GetFilePath(file).ToString(),
+					std::make_pair(file, operation.Id));
 			}
 		}
 
@@ -469,7 +568,7 @@ namespace Soup::Core::Generate
 			auto findResult = _outputDirectoryLookup.find(file);
 			if (findResult != _outputDirectoryLookup.end())
 			{
-				auto& filePath = _fileSystemState.GetFilePath(file);
+				auto filePath = _fileSystemState.GetFilePath(file);
 				auto& existingOperation = _graph.GetOperationInfo(findResult->second);
 				throw std::runtime_error(
 					std::format(
@@ -480,6 +579,9 @@ namespace Soup::Core::Generate
 			else
 			{
 				_outputDirectoryLookup.emplace(file, operation.Id);
+				_outputDirectoryPathLookup.emplace(
+					_fileSystemState.GetFilePath(file).ToString(),
+					operation.Id);
 			}
 		}
 
@@ -3,6 +3,7 @@
 // </copyright>
 
 #pragma once
+#include "IProcessOutputSink.h"
 #include "ISystemAccessMonitor.h"
 
 namespace Monitor
@@ -42,6 +43,7 @@ namespace Monitor
 			const Path& workingDirectory,
 			const std::map<std::string, std::string>& environmentVariables,
 			std::shared_ptr<ISystemAccessMonitor> monitor,
+			std::shared_ptr<IProcessOutputSink> outputSink,
 			bool enableAccessChecks,
 			bool partialMonitor,
 			std::vector<Path> allowedReadAccess,
@@ -0,0 +1,22 @@
+﻿// <copyright file="IProcessOutputSink.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Monitor
+{
+	/// <summary>
+	/// Receives the output of a monitored process as it is read from the child pipes.
+	/// When a sink is provided the process does not keep its own copy of the output.
+	/// The peak resident memory in bytes of the process tree is reported once the process exits,
+	/// zero when it is not known.
+	/// </summary>
+	export class IProcessOutputSink
+	{
+	public:
+		virtual void OnStandardOutput(std::string_view chunk) = 0;
+		virtual void OnStandardError(std::string_view chunk) = 0;
+		virtual void OnProcessExit(uint64_t peakMemoryUsage) = 0;
+	};
+}
@@ -1,7 +1,8 @@
-module;
+﻿module;
 
 #ifdef _WIN32
 #include <windows.h>
+#include <psapi.h>
 
 #ifdef SearchPath
 #undef SearchPath
@@ -21,18 +22,23 @@ module;
 
 #include <sys/user.h>
 #include <sys/ptrace.h>
+#include <sys/resource.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
 #include <sys/reg.h>
 #include <sys/syscall.h>
 #include <sys/uio.h>
+#include <sys/socket.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
 #include <poll.h>
 #include <fcntl.h>
 #include <cstring>
 
 #include <elf.h>
+#include <linux/filter.h>
 
 #include <seccomp.h>
 
@@ -52,7 +58,9 @@ extern char **environ;
 #include <filesystem>
 #include <format>
 #include <functional>
+#include <initializer_list>
 #include <iostream>
+#include <limits>
 #include <locale>
 #include <map>
 #include <memory>
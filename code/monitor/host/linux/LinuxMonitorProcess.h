@@ -3,6 +3,7 @@
 // </copyright>
 
 #pragma once
+#include "LinuxSeccompFilter.h"
 #include "LinuxSystemAccessMonitor.h"
 #include "LinuxSystemLoggerMonitor.h"
 #include "LinuxSystemMonitorFork.h"
@@ -27,13 +28,18 @@ namespace Monitor::Linux
 		pid_t m_processId;
 		int m_stdOutReadHandle;
 		int m_stdErrReadHandle;
+		int m_stopOutputReadHandle;
+		int m_stopOutputWriteHandle;
 
 		std::thread m_workerThread;
+		std::thread m_outputThread;
 		std::atomic<bool> m_processRunning;
 		std::atomic<bool> m_workerFailed;
 		std::exception_ptr m_workerException = nullptr;
+		std::exception_ptr m_outputException = nullptr;
 
 		// Result
+		std::shared_ptr<IProcessOutputSink> m_outputSink;
 		bool m_isFinished;
 		std::stringstream m_stdOut;
 		std::stringstream m_stdErr;
@@ -48,6 +54,7 @@ namespace Monitor::Linux
 			std::vector<std::string> arguments,
 			const Path& workingDirectory,
 			std::shared_ptr<ISystemAccessMonitor> monitor,
+			std::shared_ptr<IProcessOutputSink> outputSink,
 			bool partialMonitor) :
 			m_executable(executable),
 			m_arguments(std::move(arguments)),
@@ -63,68 +70,73 @@ namespace Monitor::Linux
 			m_processId(),
 			m_stdOutReadHandle(),
 			m_stdErrReadHandle(),
+			m_stopOutputReadHandle(-1),
+			m_stopOutputWriteHandle(-1),
 			m_workerThread(),
+			m_outputThread(),
 			m_processRunning(),
 			m_workerFailed(),
+			m_outputSink(std::move(outputSink)),
 			m_isFinished(false),
 			m_exitCode(-1)
 		{
 		}
 
+		LinuxMonitorProcess(const LinuxMonitorProcess&) = delete;
+		LinuxMonitorProcess& operator=(const LinuxMonitorProcess&) = delete;
+
+		/// <summary>
+		/// Finalizes an instance of the <see cref='LinuxMonitorProcess'/> class.
+		/// </summary>
+		~LinuxMonitorProcess()
+		{
+			if (m_workerThread.joinable())
+				m_workerThread.join();
+			if (m_outputThread.joinable())
+				StopOutputThread();
+		}
+
 		/// <summary>
 		/// Execute a process for the provided
 		/// </summary>
 		void Start() override final
 		{
-			// Set current working directory that will be inherited by the child process
-			auto currentWorkingDirectory = std::filesystem::current_path();
-			if (chdir(m_workingDirectory.ToString().c_str()) == -1)
-				throw std::runtime_error("Failed to set working directory");
-
 			// Create a pipe to send stdout to parent
+			// Close on exec so the pipes do not leak into other processes started in parallel
 			int stdOutPipe[2];
-			if (pipe2(stdOutPipe, O_NONBLOCK) < 0)
+			if (pipe2(stdOutPipe, O_NONBLOCK | O_CLOEXEC) < 0)
 				throw std::runtime_error("Failed to create stdOutPipe");
 
 			// Create a pipe to send stderr to parent
 			int stdErrPipe[2];
-			if (pipe2(stdErrPipe, O_NONBLOCK) < 0)
+			if (pipe2(stdErrPipe, O_NONBLOCK | O_CLOEXEC) < 0)
 				throw std::runtime_error("Failed to create stdErrPipe");
 
-			// Create a child process
-			DebugTrace("Fork");
-			pid_t processId = fork();
-			if (processId == 0)
-			{
-				SetupChildProcess(stdOutPipe, stdErrPipe);
-			}
-			else
-			{
-				// Parent process still
-				DebugTrace("Parent");
-
-				// Reset working directory
-				if (chdir(currentWorkingDirectory.string().c_str()) == -1)
-					throw std::runtime_error("Failed to reset working directory");
-
-				m_processId = processId;
-
-				// Close our handle on the write end
-				close(stdOutPipe[1]);
-				close(stdErrPipe[1]);
-				m_stdOutReadHandle = stdOutPipe[0];
-				m_stdErrReadHandle = stdErrPipe[0];
-
-				// Create the worker thread that will monitor the child process
-				m_processRunning = true;
-				m_workerFailed = false;
-				DebugTrace("Thread");
-				// m_workerThread = std::thread(&LinuxMonitorProcess::WorkerThread, std::ref(*this));
-				
-				WorkerThread();
-
-				DebugTrace("Parent done");
-			}
+			// Create a pipe to signal the output thread to stop once the child process exits
+			int stopOutputPipe[2];
+			if (pipe2(stopOutputPipe, O_CLOEXEC) < 0)
+				throw std::runtime_error("Failed to create stopOutputPipe");
+
+			m_stdOutReadHandle = stdOutPipe[0];
+			m_stdErrReadHandle = stdErrPipe[0];
+			m_stopOutputReadHandle = stopOutputPipe[0];
+			m_stopOutputWriteHandle = stopOutputPipe[1];
+
+			// Create the output thread that will read the pipes as the child writes to them,
+			// the tracer thread only wakes on system calls and cannot keep the pipes drained
+			m_outputThread = std::thread(&LinuxMonitorProcess::OutputThread, this);
+
+			// Create the worker thread that will start and monitor the child process.
+			// The thread that forks the child is its tracer so all ptrace requests for the process tree
+			// must come from the same thread, this allows multiple processes to be monitored at once.
+			m_processRunning = true;
+			m_workerFailed = false;
+			DebugTrace("Thread");
+			m_workerThread = std::thread(
+				&LinuxMonitorProcess::TraceProcess,
+				this,
+				stdOutPipe[1],
+				stdErrPipe[1]);
 		}
 
 		/// <summary>
@@ -133,10 +145,13 @@ namespace Monitor::Linux
 		void WaitForExit() override final
 		{
 			// Wait until child process exits.
-			// m_workerThread.join();
+			m_workerThread.join();
 
 			m_processRunning = false;
 
+			// Stop the output thread and read anything left behind by the child
+			StopOutputThread();
+
 			ReadAvailableStdOut();
 			m_stdOut << std::flush;
 			close(m_stdOutReadHandle);
@@ -151,6 +166,11 @@ namespace Monitor::Linux
 			{
 				std::rethrow_exception(m_workerException);
 			}
+
+			if (m_outputException != nullptr)
+			{
+				std::rethrow_exception(m_outputException);
+			}
 		}
 
 		/// <summary>
@@ -184,6 +204,64 @@ namespace Monitor::Linux
 		}
 
 	private:
+		/// <summary>
+		/// The main entry point for the output thread that will read the standard output and error
+		/// pipes until they are closed or the process has exited
+		/// </summary>
+		void OutputThread()
+		{
+			try
+			{
+				bool stdOutOpen = true;
+				bool stdErrOpen = true;
+				while (stdOutOpen || stdErrOpen)
+				{
+					// Negative handles are ignored by poll once a pipe has closed
+					auto pollHandles = std::array<pollfd, 3>({
+						pollfd({ stdOutOpen ? m_stdOutReadHandle : -1, POLLIN, 0 }),
+						pollfd({ stdErrOpen ? m_stdErrReadHandle : -1, POLLIN, 0 }),
+						pollfd({ m_stopOutputReadHandle, POLLIN, 0 }),
+					});
+
+					if (poll(pollHandles.data(), pollHandles.size(), -1) < 0)
+					{
+						if (errno == EINTR)
+							continue;
+						throw std::runtime_error(std::format("poll failed {0}", errno));
+					}
+
+					if ((pollHandles[0].revents & POLLIN) != 0)
+						ReadAvailableStdOut();
+					else if ((pollHandles[0].revents & (POLLHUP | POLLERR)) != 0)
+						stdOutOpen = false;
+
+					if ((pollHandles[1].revents & POLLIN) != 0)
+						ReadAvailableStdErr();
+					else if ((pollHandles[1].revents & (POLLHUP | POLLERR)) != 0)
+						stdErrOpen = false;
+
+					if ((pollHandles[2].revents & POLLIN) != 0)
+						break;
+				}
+			}
+			catch (...)
+			{
+				m_outputException = std::current_exception();
+			}
+		}
+
+		void StopOutputThread()
+		{
+			char signal = 0;
+			if (write(m_stopOutputWriteHandle, &signal, sizeof(signal)) < 0)
+				Log::Warning("Failed to signal the output thread {0}", errno);
+
+			m_outputThread.join();
+
+			close(m_stopOutputReadHandle);
+			close(m_stopOutputWriteHandle);
+		}
+
 		void ReadAvailableStdOut()
 		{
 			// Read all and write to stdout
@@ -200,7 +278,10 @@ namespace Monitor::Linux
 				if (dwRead == 0)
 					break;
 
-				m_stdOut << std::string_view(buffer, dwRead);
+				if (m_outputSink != nullptr)
+					m_outputSink->OnStandardOutput(std::string_view(buffer, dwRead));
+				else
+					m_stdOut << std::string_view(buffer, dwRead);
 			}
 		}
 
@@ -220,130 +301,162 @@ namespace Monitor::Linux
 				if (dwRead == 0)
 					break;
 
-				// Make the string null terminated
-				m_stdErr << std::string_view(buffer, dwRead);
+				if (m_outputSink != nullptr)
+					m_outputSink->OnStandardError(std::string_view(buffer, dwRead));
+				else
+					m_stdErr << std::string_view(buffer, dwRead);
 			}
 		}
 
-		void SetupChildProcess(int stdOutPipe[2], int stdErrPipe[2])
+		void TraceProcess(int stdOutWriteHandle, int stdErrWriteHandle)
 		{
 			try
 			{
-				// We are the child process
-				DebugTrace("Child");
-
-				// Close the read pipe
-				close(stdOutPipe[0]);
-				close(stdErrPipe[0]);
-
-				// Redirect stdout to the pipe write
-				if (dup2(stdOutPipe[1], STDOUT_FILENO) != STDOUT_FILENO)
-					throw std::runtime_error("dup2 error to stdout");
+				// Build up the child process state before the fork, other threads may hold locks
+				// that the child will never see released
+				auto executable = m_executable.ToString();
+				auto workingDirectory = m_workingDirectory.ToString();
 
-				// Redirect stderr to the pipe write
-				if (dup2(stdErrPipe[1], STDERR_FILENO) != STDERR_FILENO)
-					throw std::runtime_error("dup2 error to stderr");
-
-				// Close our handle on the write end
-				close(stdOutPipe[1]);
-				close(stdErrPipe[1]);
+				std::vector<const char*> arguments;
+				arguments.push_back(executable.c_str());
+				for (auto& argument : m_arguments)
+					arguments.push_back(argument.c_str());
+				arguments.push_back(nullptr);
 
-				auto environment = std::vector<std::string>();
+				auto environment = std::vector<const char*>({
+					"HOME=/",
+					"USER=user1",
+					"PATH=/usr/local/bin:/usr/sbin:/usr/bin:/sbin:/bin",
+					nullptr,
+				});
 
-				environment.push_back("HOME=/");
-				environment.push_back("USER=user1");
-				environment.push_back("PATH=/usr/local/bin:/usr/sbin:/usr/bin:/sbin:/bin");
+				auto& filter = GetSeccompFilter();
 
-				scmp_filter_ctx ctx;
-				try
+				// Create a child process
+				DebugTrace("Fork");
+				pid_t processId = fork();
+				if (processId == 0)
 				{
-					scmp_filter_ctx ctx = seccomp_init(SCMP_ACT_ALLOW);
-					if (ctx == NULL)
-						throw std::runtime_error("seccomp_init failed");
-
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(open), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(openat), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(openat2), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(creat), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(link), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(linkat), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(rename), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(renameat), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(renameat2), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(unlink), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(mkdir), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(mkdirat), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(rmdir), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(fork), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(vfork), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(clone), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(clone3), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					// TODO: Allow first execve when the parent has not connected yet to allow it
-					// Maybe try to filter to the known exe and only allow that and trace others
-					// https://lore.kernel.org/lkml/20201029075841.GB29881@ircssh-2.c.rugged-nimbus-611.internal/T/
-					// if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(execve), 0) < 0)
-					// 	throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(execveat), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-
-					if (seccomp_load(ctx) < 0)
-						throw std::runtime_error("seccomp_load failed");
-
-					seccomp_release(ctx);
+					SetupChildProcess(
+						stdOutWriteHandle,
+						stdErrWriteHandle,
+						filter,
+						executable.c_str(),
+						workingDirectory.c_str(),
+						arguments,
+						environment);
 				}
-				catch(const std::exception& e)
+				else
 				{
-					// Ensure we cleanup nicely
-					seccomp_release(ctx);
-					throw;
-				}
+					// Parent process still
+					DebugTrace("Parent");
 
-				ptrace(PTRACE_TRACEME, 0, 0, 0);
+					// Close our handle on the write end
+					close(stdOutWriteHandle);
+					close(stdErrWriteHandle);
 
-				std::vector<const char*> arguments;
-				arguments.push_back(m_executable.ToString().c_str());
-				for (auto& argument : m_arguments)
-					arguments.push_back(argument.c_str());
-				arguments.push_back(nullptr);
+					if (processId == -1)
+						throw std::runtime_error("Failed to fork child process");
+
+					m_processId = processId;
 
-				auto environmentArray = std::vector<const char*>();
-				for (auto& value : environment)
-					environmentArray.push_back(value.c_str());
-				environmentArray.push_back(nullptr);
-
-				// Replace runtime with child program
-				DebugTrace("child exec");
-				auto result = execve(
-					m_executable.ToString().c_str(),
-					const_cast<char**>(arguments.data()),
-					const_cast<char**>(environmentArray.data()));
-				if (result == -1)
-					throw std::runtime_error("Failed to start child");
+					WorkerThread();
+
+					DebugTrace("Parent done");
+				}
 			}
-			catch(const std::exception& e)
+			catch (...)
 			{
-				std::cerr << e.what() << '\n';
-				exit(1234);
+				m_workerException = std::current_exception();
+				m_workerFailed = true;
 			}
+		}
+
+		/// <summary>
+		/// Setup the forked child and replace it with the requested program.
+		/// Only async-signal-safe calls may be made after the fork, so failures are reported
+		/// directly with write and the child exits without unwinding
+		/// </summary>
+		void SetupChildProcess(
+			int stdOutWriteHandle,
+			int stdErrWriteHandle,
+			const LinuxSeccompFilter& filter,
+			const char* executable,
+			const char* workingDirectory,
+			const std::vector<const char*>& arguments,
+			const std::vector<const char*>& environment)
+		{
+			// Set the working directory for the child only, the host may be running other processes
+			if (chdir(workingDirectory) == -1)
+				ExitChild("Failed to set working directory");
+
+			// Redirect stdout to the pipe write
+			if (dup2(stdOutWriteHandle, STDOUT_FILENO) != STDOUT_FILENO)
+				ExitChild("dup2 error to stdout");
+
+			// Redirect stderr to the pipe write
+			if (dup2(stdErrWriteHandle, STDERR_FILENO) != STDERR_FILENO)
+				ExitChild("dup2 error to stderr");
+
+			// Close our handle on the write end
+			close(stdOutWriteHandle);
+			close(stdErrWriteHandle);
+
+			// TODO: Allow first execve when the parent has not connected yet to allow it
+			// Maybe try to filter to the known exe and only allow that and trace others
+			// https://lore.kernel.org/lkml/20201029075841.GB29881@ircssh-2.c.rugged-nimbus-611.internal/T/
+			if (filter.Load(0) < 0)
+				ExitChild("Failed to load the seccomp filter");
+
+			ptrace(PTRACE_TRACEME, 0, 0, 0);
+
+			// Replace runtime with child program
+			execve(
+				executable,
+				const_cast<char**>(arguments.data()),
+				const_cast<char**>(environment.data()));
+
+			// Running in other program now unless the exec failed
+			ExitChild("Failed to start child");
+		}
+
+		/// <summary>
+		/// The filter that traces the file system and process calls, it is the same for every process
+		/// and is only compiled once
+		/// </summary>
+		static const LinuxSeccompFilter& GetSeccompFilter()
+		{
+			static const auto filter = LinuxSeccompFilter(
+				SCMP_ACT_TRACE(1),
+				{
+					SCMP_SYS(open),
+					SCMP_SYS(openat),
+					SCMP_SYS(openat2),
+					SCMP_SYS(creat),
+					SCMP_SYS(link),
+					SCMP_SYS(linkat),
+					SCMP_SYS(rename),
+					SCMP_SYS(renameat),
+					SCMP_SYS(renameat2),
+					SCMP_SYS(unlink),
+					SCMP_SYS(mkdir),
+					SCMP_SYS(mkdirat),
+					SCMP_SYS(rmdir),
+					SCMP_SYS(fork),
+					SCMP_SYS(vfork),
+					SCMP_SYS(clone),
+					SCMP_SYS(clone3),
+					SCMP_SYS(execveat),
+				});
+			return filter;
+		}
 
-			// Running in other program now
+		[[noreturn]] static void ExitChild(const char* message)
+		{
+			// Write directly to the standard error handle, the C++ streams are not safe to use in the child
+			write(STDERR_FILENO, message, strlen(message));
+			write(STDERR_FILENO, "\n", 1);
+			_exit(1234);
 		}
 
 		/// <summary>
@@ -404,14 +517,12 @@ namespace Monitor::Linux
 
 		void WorkerThread()
 		{
-			Log::Diag("WorkerThread Start");
-
 			auto activeProcesses = std::vector<ProcessTraceState>();
 			InitializeProcess(activeProcesses, m_processId);
 
 			// Wait for the first notification from the child
 			int status;
-			auto currentProcessId = waitpid(m_processId, &status, 0);
+			auto currentProcessId = waitpid(m_processId, &status, __WNOTHREAD);
 			DebugTrace("WaitPID:", currentProcessId);
 			if (currentProcessId == -1)
 				throw std::runtime_error("Wait failed");
@@ -438,12 +549,13 @@ namespace Monitor::Linux
 			if (ptrace(PTRACE_CONT, m_processId, 0, 0) < 0)
 				throw std::runtime_error(std::format("ptrace PTRACE_CONT failed {0}", errno));
 
-			int eventCount = 0;
 			while (true)
 			{
-				eventCount++;
 				DebugTrace("Waiting...");
-				currentProcessId = waitpid(-1, &status, __WALL);
+
+				// Only wait on the processes traced by this thread so other monitored processes are left to their own tracer
+				struct rusage resourceUsage;
+				currentProcessId = wait4(-1, &status, __WALL | __WNOTHREAD, &resourceUsage);
 				int wait_errno = errno;
 
 				DebugTrace("Wait:", currentProcessId);
@@ -461,6 +573,11 @@ namespace Monitor::Linux
 					{
 						m_exitCode = exitCode;
 						DebugTrace("Main exit:", m_exitCode);
+
+						// The max resident size of the main process includes the largest of its waited children, in kilobytes
+						if (m_outputSink != nullptr)
+							m_outputSink->OnProcessExit(static_cast<uint64_t>(resourceUsage.ru_maxrss) * 1024);
+
 						return;
 					}
 					else
@@ -627,16 +744,6 @@ namespace Monitor::Linux
 					DebugTrace("CONTINUE");
 					if (ptrace(continueRequest, currentProcessId, 0, (unsigned long)continueSignal) < 0)
 						throw std::runtime_error(std::format("ptrace PTRACE_SYSCALL failed {0}", errno));
-
-					if (eventCount > 100)
-					{
-						// Read std out so the child does not fill the buffer
-						// TODO: Move to background thread so we do not block the child
-						ReadAvailableStdOut();
-						ReadAvailableStdErr();
-
-						eventCount = 0;
-					}
 				}
 				else
 				{
@@ -5,19 +5,44 @@
 #pragma once
 #include "../IMonitorProcessManager.h"
 #include "LinuxMonitorProcess.h"
+#include "LinuxNotifyMonitorProcess.h"
 
 namespace Monitor::Linux
 {
+	/// <summary>
+	/// The mechanism used to observe the system calls of a monitored process
+	/// </summary>
+	export enum class LinuxMonitorBackend
+	{
+		// Stop the process on entry and exit of each system call with ptrace
+		Trace,
+
+		// Receive seccomp user notifications and let the system call continue without a second stop
+		Notify,
+	};
+
 	/// <summary>
 	/// A Linux platform specific process executable using system
 	/// </summary>
 	export class LinuxMonitorProcessManager : public IMonitorProcessManager
 	{
+	private:
+		LinuxMonitorBackend _backend;
+
 	public:
 		/// <summary>
 		/// Initializes a new instance of the <see cref='LinuxMonitorProcessManager'/> class.
 		/// </summary>
-		LinuxMonitorProcessManager()
+		LinuxMonitorProcessManager() :
+			LinuxMonitorProcessManager(LinuxMonitorBackend::Trace)
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref='LinuxMonitorProcessManager'/> class.
+		/// </summary>
+		LinuxMonitorProcessManager(LinuxMonitorBackend backend) :
+			_backend(backend)
 		{
 		}
 
@@ -30,16 +55,29 @@ namespace Monitor::Linux
 			const Path& workingDirectory,
 			const std::map<std::string, std::string>& environmentVariables,
 			std::shared_ptr<ISystemAccessMonitor> monitor,
+			std::shared_ptr<IProcessOutputSink> outputSink,
 			bool enableAccessChecks,
 			bool partialMonitor,
 			std::vector<Path> allowedReadAccess,
 			std::vector<Path> allowedWriteAccess) override final
 		{
+			if (_backend == LinuxMonitorBackend::Notify)
+			{
+				return std::make_shared<LinuxNotifyMonitorProcess>(
+					executable,
+					std::move(arguments),
+					workingDirectory,
+					std::move(monitor),
+					std::move(outputSink),
+					partialMonitor);
+			}
+
 			return std::make_shared<LinuxMonitorProcess>(
 				executable,
 				std::move(arguments),
 				workingDirectory,
 				std::move(monitor),
+				std::move(outputSink),
 				partialMonitor);
 		}
 	};
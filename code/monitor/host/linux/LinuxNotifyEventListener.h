@@ -0,0 +1,324 @@
+﻿// <copyright file="LinuxNotifyEventListener.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "ILinuxSystemMonitor.h"
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// The event listener for seccomp user notifications. The notification is received before the system call runs
+	/// so the arguments are read while the caller is blocked and the result of the call is never seen.
+	/// The calls that do not need a result are reported with UnknownResult, opens need to know if the file exists
+	/// and are held until the process tree has exited and the file can be checked.
+	/// </summary>
+	class LinuxNotifyEventListener
+	{
+	private:
+		// The longest path that will be read from the monitored process
+		static constexpr size_t MaxPathLength = 4096;
+
+		// The result reported for a system call that has not run yet
+		static constexpr int32_t UnknownResult = std::numeric_limits<int32_t>::min();
+
+		/// <summary>
+		/// An open that is waiting for the process tree to exit to check if the file exists
+		/// </summary>
+		struct PendingOpen
+		{
+			int SystemCall;
+			int32_t DirectoryHandle;
+			std::string Path;
+			int32_t Flags;
+			std::string ResolvedPath;
+		};
+
+		// Input
+		std::shared_ptr<ILinuxSystemMonitor> m_monitor;
+
+		// Runtime
+		size_t m_pageSize;
+		std::vector<PendingOpen> m_pendingOpens;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref='LinuxNotifyEventListener'/> class.
+		/// </summary>
+		LinuxNotifyEventListener(
+			std::shared_ptr<ILinuxSystemMonitor> monitor) :
+			m_monitor(std::move(monitor)),
+			m_pageSize(static_cast<size_t>(sysconf(_SC_PAGESIZE))),
+			m_pendingOpens()
+		{
+		}
+
+		void LogError(std::string_view message)
+		{
+			m_monitor->OnError(message);
+		}
+
+		void ProcessNotification(int notifyHandle, const seccomp_notif& request)
+		{
+			auto pid = static_cast<pid_t>(request.pid);
+
+			// Open the process memory once for all arguments of the system call
+			auto memoryHandle = open(std::format("/proc/{}/mem", pid).c_str(), O_RDONLY | O_CLOEXEC);
+			if (memoryHandle == -1)
+			{
+				// The process is gone
+				return;
+			}
+
+			try
+			{
+				ProcessNotification(notifyHandle, request, pid, memoryHandle);
+			}
+			catch (...)
+			{
+				close(memoryHandle);
+				throw;
+			}
+
+			close(memoryHandle);
+		}
+
+		/// <summary>
+		/// Report all opens now that the system calls have run, a file that does not exist after the process
+		/// tree exits is reported as a failed open
+		/// </summary>
+		void ProcessPendingOpens()
+		{
+			for (auto& pendingOpen : m_pendingOpens)
+			{
+				auto result = faccessat(AT_FDCWD, pendingOpen.ResolvedPath.c_str(), F_OK, 0) == 0 ? 0 : -1;
+				switch (pendingOpen.SystemCall)
+				{
+					case SCMP_SYS(open):
+						m_monitor->OnOpen(pendingOpen.Path, pendingOpen.Flags, result);
+						break;
+					case SCMP_SYS(openat):
+						m_monitor->OnOpenAt(pendingOpen.DirectoryHandle, pendingOpen.Path, pendingOpen.Flags, result);
+						break;
+					case SCMP_SYS(openat2):
+						m_monitor->OnOpenAt2(pendingOpen.DirectoryHandle, pendingOpen.Path, pendingOpen.Flags, result);
+						break;
+				}
+			}
+
+			m_pendingOpens.clear();
+		}
+
+	private:
+		void ProcessNotification(
+			int notifyHandle,
+			const seccomp_notif& request,
+			pid_t pid,
+			int memoryHandle)
+		{
+			auto& args = request.data.args;
+			switch (request.data.nr)
+			{
+				// FileApi
+				case SCMP_SYS(creat):
+				{
+					auto path = ReadNullTerminatedStringValue(memoryHandle, args[0]);
+					if (IsValid(notifyHandle, request))
+						m_monitor->OnCreat(path, UnknownResult);
+					break;
+				}
+				case SCMP_SYS(link):
+				{
+					auto oldpath = ReadNullTerminatedStringValue(memoryHandle, args[0]);
+					auto newpath = ReadNullTerminatedStringValue(memoryHandle, args[1]);
+					if (IsValid(notifyHandle, request))
+						m_monitor->OnLink(oldpath, newpath, UnknownResult);
+					break;
+				}
+				case SCMP_SYS(linkat):
+				{
+					auto olddirfd = (int32_t)args[0];
+					auto oldpath = ReadNullTerminatedStringValue(memoryHandle, args[1]);
+					auto newdirfd = (int32_t)args[2];
+					auto newpath = ReadNullTerminatedStringValue(memoryHandle, args[3]);
+					auto flags = (int32_t)args[4];
+					if (IsValid(notifyHandle, request))
+						m_monitor->OnLinkAt(olddirfd, oldpath, newdirfd, newpath, flags, UnknownResult);
+					break;
+				}
+				case SCMP_SYS(mkdir):
+				{
+					auto path = ReadNullTerminatedStringValue(memoryHandle, args[0]);
+					auto mode = (uint32_t)args[1];
+					if (IsValid(notifyHandle, request))
+						m_monitor->OnMkdir(path, mode, UnknownResult);
+					break;
+				}
+				case SCMP_SYS(mkdirat):
+				{
+					auto dirfd = (int32_t)args[0];
+					auto path = ReadNullTerminatedStringValue(memoryHandle, args[1]);
+					auto mode = (uint32_t)args[2];
+					if (IsValid(notifyHandle, request))
+						m_monitor->OnMkdirAt(dirfd, path, mode, UnknownResult);
+					break;
+				}
+				case SCMP_SYS(open):
+				{
+					auto path = ReadNullTerminatedStringValue(memoryHandle, args[0]);
+					auto oflag = (int32_t)args[1];
+					if (IsValid(notifyHandle, request))
+						AddPendingOpen(request, pid, AT_FDCWD, std::move(path), oflag);
+					break;
+				}
+				case SCMP_SYS(openat):
+				{
+					auto dirfd = (int32_t)args[0];
+					auto path = ReadNullTerminatedStringValue(memoryHandle, args[1]);
+					auto oflag = (int32_t)args[2];
+					if (IsValid(notifyHandle, request))
+						AddPendingOpen(request, pid, dirfd, std::move(path), oflag);
+					break;
+				}
+				case SCMP_SYS(openat2):
+				{
+					// The flags are the first member of the open_how structure
+					auto dirfd = (int32_t)args[0];
+					auto path = ReadNullTerminatedStringValue(memoryHandle, args[1]);
+					uint64_t how = 0;
+					ReadValue(memoryHandle, args[2], reinterpret_cast<char*>(&how), sizeof(uint64_t));
+					auto oflag = (int32_t)how;
+					if (IsValid(notifyHandle, request))
+						AddPendingOpen(request, pid, dirfd, std::move(path), oflag);
+					break;
+				}
+				case SCMP_SYS(rename):
+				{
+					auto oldpath = ReadNullTerminatedStringValue(memoryHandle, args[0]);
+					auto newpath = ReadNullTerminatedStringValue(memoryHandle, args[1]);
+					if (IsValid(notifyHandle, request))
+						m_monitor->OnRename(oldpath, newpath, UnknownResult);
+					break;
+				}
+				case SCMP_SYS(renameat):
+				{
+					auto oldfd = (int32_t)args[0];
+					auto oldpath = ReadNullTerminatedStringValue(memoryHandle, args[1]);
+					auto newfd = (int32_t)args[2];
+					auto newpath = ReadNullTerminatedStringValue(memoryHandle, args[3]);
+					if (IsValid(notifyHandle, request))
+						m_monitor->OnRenameAt(oldfd, oldpath, newfd, newpath, UnknownResult);
+					break;
+				}
+				case SCMP_SYS(renameat2):
+				{
+					auto oldfd = (int32_t)args[0];
+					auto oldpath = ReadNullTerminatedStringValue(memoryHandle, args[1]);
+					auto newfd = (int32_t)args[2];
+					auto newpath = ReadNullTerminatedStringValue(memoryHandle, args[3]);
+					if (IsValid(notifyHandle, request))
+						m_monitor->OnRenameAt2(oldfd, oldpath, newfd, newpath, UnknownResult);
+					break;
+				}
+				case SCMP_SYS(rmdir):
+				{
+					auto pathname = ReadNullTerminatedStringValue(memoryHandle, args[0]);
+					if (IsValid(notifyHandle, request))
+						m_monitor->OnRmdir(pathname, UnknownResult);
+					break;
+				}
+				case SCMP_SYS(unlink):
+				{
+					auto pathname = ReadNullTerminatedStringValue(memoryHandle, args[0]);
+					if (IsValid(notifyHandle, request))
+						m_monitor->OnUnlink(pathname, UnknownResult);
+					break;
+				}
+				default:
+				{
+					throw std::runtime_error(std::format("Unknown system call type {0}", request.data.nr));
+				}
+			}
+		}
+
+		/// <summary>
+		/// Verify the process that made the request is still waiting on it, otherwise the process may have
+		/// exited and the id reused so the memory that was read does not belong to the request
+		/// </summary>
+		bool IsValid(int notifyHandle, const seccomp_notif& request)
+		{
+			return seccomp_notify_id_valid(notifyHandle, request.id) == 0;
+		}
+
+		/// <summary>
+		/// Resolve the path against the working directory or directory handle of the caller while it is still
+		/// blocked on the request, both are gone by the time the process tree exits
+		/// </summary>
+		void AddPendingOpen(const seccomp_notif& request, pid_t pid, int32_t dirfd, std::string path, int32_t oflag)
+		{
+			auto resolvedPath = std::string();
+			if (!path.empty() && path[0] == '/')
+				resolvedPath = path;
+			else if (dirfd == AT_FDCWD)
+				resolvedPath = ReadLink(std::format("/proc/{}/cwd", pid)) + "/" + path;
+			else
+				resolvedPath = ReadLink(std::format("/proc/{}/fd/{}", pid, dirfd)) + "/" + path;
+
+			m_pendingOpens.push_back(PendingOpen({
+				static_cast<int>(request.data.nr),
+				dirfd,
+				std::move(path),
+				oflag,
+				std::move(resolvedPath),
+			}));
+		}
+
+		std::string ReadLink(const std::string& path)
+		{
+			auto result = std::string(MaxPathLength, '\0');
+			auto length = readlink(path.c_str(), result.data(), result.size());
+			if (length < 0)
+				throw std::runtime_error(std::format("Failed to read link {}", path));
+
+			result.resize(static_cast<size_t>(length));
+			return result;
+		}
+
+		void ReadValue(int memoryHandle, uint64_t addr, char* buffer, size_t count)
+		{
+			auto readCount = pread(memoryHandle, buffer, count, static_cast<off_t>(addr));
+			if (readCount != static_cast<ssize_t>(count))
+				throw std::runtime_error("address space is inaccessible");
+		}
+
+		/// <summary>
+		/// Read a null terminated string one page at a time so the read never crosses into an unmapped page
+		/// </summary>
+		std::string ReadNullTerminatedStringValue(int memoryHandle, uint64_t addr)
+		{
+			auto result = std::string(MaxPathLength, '\0');
+			size_t nread = 0;
+			while (nread < MaxPathLength)
+			{
+				auto remoteAddress = addr + nread;
+				auto pageRemaining = m_pageSize - (remoteAddress & (m_pageSize - 1));
+				auto count = std::min(pageRemaining, MaxPathLength - nread);
+
+				auto readCount = pread(memoryHandle, result.data() + nread, count, static_cast<off_t>(remoteAddress));
+				if (readCount <= 0)
+					throw std::runtime_error("address space is inaccessible");
+
+				auto terminator = memchr(result.data() + nread, '\0', readCount);
+				if (terminator != nullptr)
+				{
+					result.resize(static_cast<char*>(terminator) - result.data());
+					return result;
+				}
+
+				nread += readCount;
+			}
+
+			return result;
+		}
+	};
+}
@@ -0,0 +1,561 @@
+﻿// <copyright file="LinuxNotifyMonitorProcess.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "LinuxSeccompFilter.h"
+#include "LinuxSystemAccessMonitor.h"
+#include "LinuxSystemLoggerMonitor.h"
+#include "LinuxSystemMonitorFork.h"
+#include "LinuxNotifyEventListener.h"
+
+#ifndef SECCOMP_USER_NOTIF_FLAG_CONTINUE
+#define SECCOMP_USER_NOTIF_FLAG_CONTINUE (1UL << 0)
+#endif
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// A Linux platform specific process executable that is monitored with seccomp user notifications.
+	/// Unlike the ptrace monitor the system calls are reported once before they run and are allowed to continue
+	/// without stopping again on exit, the monitor never attaches to the process tree.
+	/// </summary>
+	export class LinuxNotifyMonitorProcess : public Opal::System::IProcess
+	{
+	private:
+		// Input
+		Path m_executable;
+		std::vector<std::string> m_arguments;
+		Path m_workingDirectory;
+		LinuxNotifyEventListener m_eventListener;
+		bool m_partialMonitor;
+
+		// Runtime
+		pid_t m_processId;
+		int m_processHandle;
+		int m_notifyHandle;
+		int m_stdOutReadHandle;
+		int m_stdErrReadHandle;
+
+		std::thread m_workerThread;
+		std::atomic<bool> m_workerFailed;
+		std::exception_ptr m_workerException = nullptr;
+
+		// Result
+		std::shared_ptr<IProcessOutputSink> m_outputSink;
+		bool m_isFinished;
+		std::stringstream m_stdOut;
+		std::stringstream m_stdErr;
+		int m_exitCode;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref='LinuxNotifyMonitorProcess'/> class.
+		/// </summary>
+		LinuxNotifyMonitorProcess(
+			const Path& executable,
+			std::vector<std::string> arguments,
+			const Path& workingDirectory,
+			std::shared_ptr<ISystemAccessMonitor> monitor,
+			std::shared_ptr<IProcessOutputSink> outputSink,
+			bool partialMonitor) :
+			m_executable(executable),
+			m_arguments(std::move(arguments)),
+			m_workingDirectory(workingDirectory),
+	#ifdef TRACE_DETOUR_SERVER
+			m_eventListener(std::make_shared<LinuxSystemMonitorFork>(
+				std::make_shared<LinuxSystemLoggerMonitor>(std::cout),
+				std::make_shared<LinuxSystemAccessMonitor>(std::move(monitor)))),
+	#else
+			m_eventListener(std::make_shared<LinuxSystemAccessMonitor>(std::move(monitor))),
+	#endif
+			m_partialMonitor(partialMonitor),
+			m_processId(),
+			m_processHandle(-1),
+			m_notifyHandle(-1),
+			m_stdOutReadHandle(),
+			m_stdErrReadHandle(),
+			m_workerThread(),
+			m_workerFailed(),
+			m_outputSink(std::move(outputSink)),
+			m_isFinished(false),
+			m_exitCode(-1)
+		{
+		}
+
+		LinuxNotifyMonitorProcess(const LinuxNotifyMonitorProcess&) = delete;
+		LinuxNotifyMonitorProcess& operator=(const LinuxNotifyMonitorProcess&) = delete;
+
+		/// <summary>
+		/// Finalizes an instance of the <see cref='LinuxNotifyMonitorProcess'/> class.
+		/// </summary>
+		~LinuxNotifyMonitorProcess()
+		{
+			if (m_workerThread.joinable())
+				m_workerThread.join();
+		}
+
+		/// <summary>
+		/// Execute a process for the provided
+		/// </summary>
+		void Start() override final
+		{
+			// Create a pipe to send stdout to parent
+			int stdOutPipe[2];
+			if (pipe2(stdOutPipe, O_NONBLOCK | O_CLOEXEC) < 0)
+				throw std::runtime_error("Failed to create stdOutPipe");
+
+			// Create a pipe to send stderr to parent
+			int stdErrPipe[2];
+			if (pipe2(stdErrPipe, O_NONBLOCK | O_CLOEXEC) < 0)
+				throw std::runtime_error("Failed to create stdErrPipe");
+
+			// Create a socket to send the notification listener from the child to the parent
+			int notifySocket[2];
+			if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, notifySocket) < 0)
+				throw std::runtime_error("Failed to create notifySocket");
+
+			// Build up the child process state before the fork, other threads may hold locks
+			// that the child will never see released
+			auto executable = m_executable.ToString();
+			auto workingDirectory = m_workingDirectory.ToString();
+
+			std::vector<const char*> arguments;
+			arguments.push_back(executable.c_str());
+			for (auto& argument : m_arguments)
+				arguments.push_back(argument.c_str());
+			arguments.push_back(nullptr);
+
+			auto environment = std::vector<const char*>({
+				"HOME=/",
+				"USER=user1",
+				"PATH=/usr/local/bin:/usr/sbin:/usr/bin:/sbin:/bin",
+				nullptr,
+			});
+
+			auto& filter = GetSeccompFilter();
+
+			// Create a child process
+			DebugTrace("Fork");
+			pid_t processId = fork();
+			if (processId == 0)
+			{
+				close(notifySocket[0]);
+				SetupChildProcess(
+					stdOutPipe[1],
+					stdErrPipe[1],
+					notifySocket[1],
+					filter,
+					executable.c_str(),
+					workingDirectory.c_str(),
+					arguments,
+					environment);
+			}
+			else
+			{
+				// Parent process still
+				DebugTrace("Parent");
+
+				// Close our handle on the write end
+				close(stdOutPipe[1]);
+				close(stdErrPipe[1]);
+				close(notifySocket[1]);
+				m_stdOutReadHandle = stdOutPipe[0];
+				m_stdErrReadHandle = stdErrPipe[0];
+
+				if (processId == -1)
+				{
+					close(notifySocket[0]);
+					throw std::runtime_error("Failed to fork child process");
+				}
+
+				m_processId = processId;
+				m_processHandle = static_cast<int>(syscall(SYS_pidfd_open, m_processId, 0));
+				if (m_processHandle < 0)
+					throw std::runtime_error(std::format("pidfd_open failed {0}", errno));
+
+				// Receive the notification listener, the child will block on its first notification until it is handled
+				m_notifyHandle = ReceiveNotifyHandle(notifySocket[0]);
+				close(notifySocket[0]);
+
+				// Create the worker thread that will handle notifications until the child process exits
+				m_workerFailed = false;
+				DebugTrace("Thread");
+				m_workerThread = std::thread(&LinuxNotifyMonitorProcess::WorkerThread, this);
+			}
+		}
+
+		/// <summary>
+		/// Wait for the process to exit
+		/// </summary>
+		void WaitForExit() override final
+		{
+			// Wait until child process exits.
+			m_workerThread.join();
+
+			ReadAvailableStdOut();
+			m_stdOut << std::flush;
+			close(m_stdOutReadHandle);
+
+			ReadAvailableStdErr();
+			m_stdErr << std::flush;
+			close(m_stdErrReadHandle);
+
+			if (m_notifyHandle != -1)
+				close(m_notifyHandle);
+			close(m_processHandle);
+
+			m_isFinished = true;
+
+			if (m_workerFailed)
+			{
+				std::rethrow_exception(m_workerException);
+			}
+		}
+
+		/// <summary>
+		/// Get the exit code
+		/// </summary>
+		int GetExitCode() override final
+		{
+			if (!m_isFinished)
+				throw std::runtime_error("Process has not finished.");
+			return m_exitCode;
+		}
+
+		/// <summary>
+		/// Get the standard output
+		/// </summary>
+		std::string GetStandardOutput() override final
+		{
+			if (!m_isFinished)
+				throw std::runtime_error("Process has not finished.");
+			return m_stdOut.str();
+		}
+
+		/// <summary>
+		/// Get the standard error output
+		/// </summary>
+		std::string GetStandardError() override final
+		{
+			if (!m_isFinished)
+				throw std::runtime_error("Process has not finished.");
+			return m_stdErr.str();
+		}
+
+	private:
+		void ReadAvailableStdOut()
+		{
+			// Read all and write to stdout
+			int dwRead;
+			const int BufferSize = 256;
+			char buffer[BufferSize + 1];
+
+			// Read on output
+			while (true)
+			{
+				dwRead = read(m_stdOutReadHandle, buffer, BufferSize);
+				if(dwRead < 0)
+					break;
+				if (dwRead == 0)
+					break;
+
+				if (m_outputSink != nullptr)
+					m_outputSink->OnStandardOutput(std::string_view(buffer, dwRead));
+				else
+					m_stdOut << std::string_view(buffer, dwRead);
+			}
+		}
+
+		void ReadAvailableStdErr()
+		{
+			// Read all and write to stdout
+			int dwRead;
+			const int BufferSize = 256;
+			char buffer[BufferSize + 1];
+
+			// Read all errors
+			while (true)
+			{
+				dwRead = read(m_stdErrReadHandle, buffer, BufferSize);
+				if(dwRead < 0)
+					break;
+				if (dwRead == 0)
+					break;
+
+				if (m_outputSink != nullptr)
+					m_outputSink->OnStandardError(std::string_view(buffer, dwRead));
+				else
+					m_stdErr << std::string_view(buffer, dwRead);
+			}
+		}
+
+		int ReceiveNotifyHandle(int notifySocket)
+		{
+			char data = 0;
+			iovec io = { &data, sizeof(data) };
+			char control[CMSG_SPACE(sizeof(int))] = {};
+			msghdr message = {};
+			message.msg_iov = &io;
+			message.msg_iovlen = 1;
+			message.msg_control = control;
+			message.msg_controllen = sizeof(control);
+
+			if (recvmsg(notifySocket, &message, MSG_CMSG_CLOEXEC) <= 0)
+				throw std::runtime_error("Failed to receive the seccomp notification listener from the child process");
+
+			auto header = CMSG_FIRSTHDR(&message);
+			if (header == nullptr || header->cmsg_type != SCM_RIGHTS)
+				throw std::runtime_error("Missing seccomp notification listener from the child process");
+
+			int notifyHandle;
+			memcpy(&notifyHandle, CMSG_DATA(header), sizeof(int));
+			return notifyHandle;
+		}
+
+		/// <summary>
+		/// Setup the forked child and replace it with the requested program.
+		/// Only async-signal-safe calls may be made after the fork, so failures are reported
+		/// directly with write and the child exits without unwinding
+		/// </summary>
+		void SetupChildProcess(
+			int stdOutWriteHandle,
+			int stdErrWriteHandle,
+			int notifySocket,
+			const LinuxSeccompFilter& filter,
+			const char* executable,
+			const char* workingDirectory,
+			const std::vector<const char*>& arguments,
+			const std::vector<const char*>& environment)
+		{
+			// Set the working directory for the child only
+			if (chdir(workingDirectory) == -1)
+				ExitChild("Failed to set working directory");
+
+			// Redirect stdout to the pipe write
+			if (dup2(stdOutWriteHandle, STDOUT_FILENO) != STDOUT_FILENO)
+				ExitChild("dup2 error to stdout");
+
+			// Redirect stderr to the pipe write
+			if (dup2(stdErrWriteHandle, STDERR_FILENO) != STDERR_FILENO)
+				ExitChild("dup2 error to stderr");
+
+			// Close our handle on the write end
+			close(stdOutWriteHandle);
+			close(stdErrWriteHandle);
+
+			auto notifyHandle = filter.Load(SECCOMP_FILTER_FLAG_NEW_LISTENER);
+			if (notifyHandle < 0)
+				ExitChild("Failed to load the seccomp filter");
+
+			if (!SendNotifyHandle(notifySocket, notifyHandle))
+				ExitChild("Failed to send the seccomp notification listener");
+
+			close(notifyHandle);
+			close(notifySocket);
+
+			// Replace runtime with child program
+			execve(
+				executable,
+				const_cast<char**>(arguments.data()),
+				const_cast<char**>(environment.data()));
+
+			// Running in other program now unless the exec failed
+			ExitChild("Failed to start child");
+		}
+
+		/// <summary>
+		/// The filter that reports the file system calls, child processes inherit the filter
+		/// so there is no need to follow fork, clone or exec
+		/// </summary>
+		static const LinuxSeccompFilter& GetSeccompFilter()
+		{
+			static const auto filter = LinuxSeccompFilter(
+				SCMP_ACT_NOTIFY,
+				{
+					SCMP_SYS(open),
+					SCMP_SYS(openat),
+					SCMP_SYS(openat2),
+					SCMP_SYS(creat),
+					SCMP_SYS(link),
+					SCMP_SYS(linkat),
+					SCMP_SYS(rename),
+					SCMP_SYS(renameat),
+					SCMP_SYS(renameat2),
+					SCMP_SYS(unlink),
+					SCMP_SYS(mkdir),
+					SCMP_SYS(mkdirat),
+					SCMP_SYS(rmdir),
+				});
+			return filter;
+		}
+
+		[[noreturn]] static void ExitChild(const char* message)
+		{
+			// Write directly to the standard error handle, the C++ streams are not safe to use in the child
+			write(STDERR_FILENO, message, strlen(message));
+			write(STDERR_FILENO, "\n", 1);
+			_exit(1234);
+		}
+
+		static bool SendNotifyHandle(int notifySocket, int notifyHandle)
+		{
+			char data = 0;
+			iovec io = { &data, sizeof(data) };
+			char control[CMSG_SPACE(sizeof(int))] = {};
+			msghdr message = {};
+			message.msg_iov = &io;
+			message.msg_iovlen = 1;
+			message.msg_control = control;
+			message.msg_controllen = sizeof(control);
+
+			auto header = CMSG_FIRSTHDR(&message);
+			header->cmsg_level = SOL_SOCKET;
+			header->cmsg_type = SCM_RIGHTS;
+			header->cmsg_len = CMSG_LEN(sizeof(int));
+			memcpy(CMSG_DATA(header), &notifyHandle, sizeof(int));
+
+			return sendmsg(notifySocket, &message, 0) >= 0;
+		}
+
+		/// <summary>
+		/// The main entry point for the worker thread that will handle notifications and output
+		/// until the child process exits
+		/// </summary>
+		void WorkerThread()
+		{
+			seccomp_notif* request = nullptr;
+			seccomp_notif_resp* response = nullptr;
+			if (seccomp_notify_alloc(&request, &response) != 0)
+			{
+				m_workerException = std::make_exception_ptr(std::runtime_error("seccomp_notify_alloc failed"));
+				m_workerFailed = true;
+				return;
+			}
+
+			// Stop polling an output pipe once all writers are gone, a hang up is reported on every poll
+			auto stdOutPollHandle = m_stdOutReadHandle;
+			auto stdErrPollHandle = m_stdErrReadHandle;
+
+			try
+			{
+				while (true)
+				{
+					auto pollHandles = std::array<pollfd, 4>({
+						pollfd({ m_processHandle, POLLIN, 0 }),
+						pollfd({ m_notifyHandle, POLLIN, 0 }),
+						pollfd({ stdOutPollHandle, POLLIN, 0 }),
+						pollfd({ stdErrPollHandle, POLLIN, 0 }),
+					});
+
+					if (poll(pollHandles.data(), pollHandles.size(), -1) < 0)
+					{
+						if (errno == EINTR)
+							continue;
+						throw std::runtime_error(std::format("poll failed {0}", errno));
+					}
+
+					if ((pollHandles[1].revents & POLLIN) != 0)
+					{
+						HandleNotification(*request, *response);
+					}
+					else if ((pollHandles[1].revents & (POLLHUP | POLLERR)) != 0)
+					{
+						// All processes holding the filter are gone
+						close(m_notifyHandle);
+						m_notifyHandle = -1;
+					}
+
+					if ((pollHandles[2].revents & (POLLIN | POLLHUP | POLLERR)) != 0)
+					{
+						ReadAvailableStdOut();
+						if ((pollHandles[2].revents & (POLLHUP | POLLERR)) != 0)
+							stdOutPollHandle = -1;
+					}
+
+					if ((pollHandles[3].revents & (POLLIN | POLLHUP | POLLERR)) != 0)
+					{
+						ReadAvailableStdErr();
+						if ((pollHandles[3].revents & (POLLHUP | POLLERR)) != 0)
+							stdErrPollHandle = -1;
+					}
+
+					if ((pollHandles[0].revents & POLLIN) != 0)
+					{
+						int status;
+						struct rusage resourceUsage;
+						if (wait4(m_processId, &status, 0, &resourceUsage) == -1)
+							throw std::runtime_error(std::format("Wait failed {0}", errno));
+
+						m_exitCode = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+						DebugTrace("Main exit:", m_exitCode);
+
+						// The main process has exited, report the opens that need to know if the file exists
+						if (!m_partialMonitor)
+							m_eventListener.ProcessPendingOpens();
+
+						// The max resident size of the main process includes the largest of its waited children, in kilobytes
+						if (m_outputSink != nullptr)
+							m_outputSink->OnProcessExit(static_cast<uint64_t>(resourceUsage.ru_maxrss) * 1024);
+						break;
+					}
+				}
+			}
+			catch (...)
+			{
+				m_workerException = std::current_exception();
+				m_workerFailed = true;
+			}
+
+			seccomp_notify_free(request, response);
+		}
+
+		void HandleNotification(seccomp_notif& request, seccomp_notif_resp& response)
+		{
+			memset(&request, 0, sizeof(seccomp_notif));
+			if (seccomp_notify_receive(m_notifyHandle, &request) != 0)
+			{
+				// The caller was interrupted or exited before the notification was received
+				return;
+			}
+
+			// Ignore all messages if partial monitor is enabled
+			std::exception_ptr exception = nullptr;
+			if (!m_partialMonitor)
+			{
+				try
+				{
+					m_eventListener.ProcessNotification(m_notifyHandle, request);
+				}
+				catch (...)
+				{
+					exception = std::current_exception();
+				}
+			}
+
+			// Always let the system call run without stopping the caller again, the caller is blocked until it is answered
+			response.id = request.id;
+			response.val = 0;
+			response.error = 0;
+			response.flags = SECCOMP_USER_NOTIF_FLAG_CONTINUE;
+			seccomp_notify_respond(m_notifyHandle, &response);
+
+			if (exception != nullptr)
+				std::rethrow_exception(exception);
+		}
+
+		void DebugTrace(std::string_view message, uint32_t value)
+		{
+#ifdef TRACE_MONITOR_HOST
+			std::cout << "Monitor-HOST: " << message << " " << value << std::endl;
+#endif
+		}
+
+		void DebugTrace(std::string_view message)
+		{
+#ifdef TRACE_MONITOR_HOST
+			std::cout << "Monitor-HOST: " << message << std::endl;
+#endif
+		}
+	};
+}
@@ -0,0 +1,104 @@
+// <copyright file="LinuxSeccompFilter.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+#ifndef SECCOMP_FILTER_FLAG_NEW_LISTENER
+#define SECCOMP_FILTER_FLAG_NEW_LISTENER (1UL << 3)
+#endif
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// A seccomp filter that is compiled to a BPF program before the fork. libseccomp allocates while building
+	/// and loading a filter which is not safe after a fork, the child only loads the program with raw system calls.
+	/// </summary>
+	class LinuxSeccompFilter
+	{
+	private:
+		std::vector<sock_filter> m_program;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref='LinuxSeccompFilter'/> class that allows all system calls
+		/// except the provided set, which will use the requested action
+		/// </summary>
+		LinuxSeccompFilter(uint32_t action, std::initializer_list<int> systemCalls) :
+			m_program()
+		{
+			scmp_filter_ctx ctx = seccomp_init(SCMP_ACT_ALLOW);
+			if (ctx == nullptr)
+				throw std::runtime_error("seccomp_init failed");
+
+			try
+			{
+				for (auto systemCall : systemCalls)
+				{
+					if (seccomp_rule_add(ctx, action, systemCall, 0) < 0)
+						throw std::runtime_error("seccomp_rule_add failed");
+				}
+
+				m_program = ExportProgram(ctx);
+			}
+			catch (...)
+			{
+				seccomp_release(ctx);
+				throw;
+			}
+
+			seccomp_release(ctx);
+		}
+
+		/// <summary>
+		/// Load the filter into the current process, only async-signal-safe calls are made so this can be used in a
+		/// forked child. Returns the result of the seccomp system call, the notification listener when requested.
+		/// </summary>
+		int Load(unsigned int flags) const
+		{
+			// Required to load a filter without privileges, seccomp_load sets the same attribute by default
+			if (prctl(PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0) < 0)
+				return -1;
+
+			auto program = sock_fprog({
+				static_cast<unsigned short>(m_program.size()),
+				const_cast<sock_filter*>(m_program.data()),
+			});
+			return static_cast<int>(syscall(SYS_seccomp, SECCOMP_SET_MODE_FILTER, flags, &program));
+		}
+
+	private:
+		/// <summary>
+		/// libseccomp 2.5 can only export the program to a file descriptor, use an anonymous memory file
+		/// </summary>
+		static std::vector<sock_filter> ExportProgram(scmp_filter_ctx ctx)
+		{
+			auto programHandle = memfd_create("seccomp", MFD_CLOEXEC);
+			if (programHandle < 0)
+				throw std::runtime_error("Failed to create the seccomp program file");
+
+			auto result = std::vector<sock_filter>();
+			try
+			{
+				if (seccomp_export_bpf(ctx, programHandle) < 0)
+					throw std::runtime_error("seccomp_export_bpf failed");
+
+				auto size = lseek(programHandle, 0, SEEK_END);
+				if (size < 0 || size % sizeof(sock_filter) != 0)
+					throw std::runtime_error("Invalid seccomp program size");
+
+				result.resize(static_cast<size_t>(size) / sizeof(sock_filter));
+				if (pread(programHandle, result.data(), static_cast<size_t>(size), 0) != size)
+					throw std::runtime_error("Failed to read the seccomp program");
+			}
+			catch (...)
+			{
+				close(programHandle);
+				throw;
+			}
+
+			close(programHandle);
+			return result;
+		}
+	};
+}
@@ -28,16 +28,25 @@ namespace Monitor::Linux
 	class LinuxTraceEventListener
 	{
 	private:
+		// The longest path that will be read from the traced process
+		static constexpr size_t MaxPathLength = 4096;
+
 		// Input
 		std::shared_ptr<ILinuxSystemMonitor> m_monitor;
 
+		// Runtime
+		size_t m_pageSize;
+		bool m_useProcessVmReadv;
+
 	public:
 		/// <summary>
 		/// Initializes a new instance of the <see cref='LinuxTraceEventListener'/> class.
 		/// </summary>
 		LinuxTraceEventListener(
 			std::shared_ptr<ILinuxSystemMonitor> monitor) :
-			m_monitor(std::move(monitor))
+			m_monitor(std::move(monitor)),
+			m_pageSize(static_cast<size_t>(sysconf(_SC_PAGESIZE))),
+			m_useProcessVmReadv(true)
 		{
 		}
 
@@ -227,13 +236,74 @@ namespace Monitor::Linux
 			};
 		}
 
+		/// <summary>
+		/// Read a null terminated string from the traced process.
+		/// The string is copied in page sized chunks with process_vm_readv, a chunk never crosses a page boundary
+		/// so a string near the end of a mapped region does not fault on the unmapped page after it.
+		/// Falls back to reading a word at a time with ptrace when cross process reads are not available.
+		/// </summary>
 		std::string ReadNullTerminatedStringValue(pid_t pid, long addr)
 		{
-			auto result = std::string(1024, '\0');
+			if (m_useProcessVmReadv)
+			{
+				auto result = std::string();
+				if (TryReadNullTerminatedStringValue(pid, addr, result))
+					return result;
+			}
+
+			return PeekNullTerminatedStringValue(pid, addr);
+		}
+
+		bool TryReadNullTerminatedStringValue(pid_t pid, long addr, std::string& result)
+		{
+			result.resize(MaxPathLength);
+			size_t nread = 0;
+			while (nread < MaxPathLength)
+			{
+				auto remoteAddress = static_cast<uintptr_t>(addr) + nread;
+				auto pageRemaining = m_pageSize - (remoteAddress & (m_pageSize - 1));
+				auto count = std::min(pageRemaining, MaxPathLength - nread);
+
+				iovec local = { result.data() + nread, count };
+				iovec remote = { reinterpret_cast<void*>(remoteAddress), count };
+				auto readCount = process_vm_readv(pid, &local, 1, &remote, 1, 0);
+				if (readCount <= 0)
+				{
+					switch (errno)
+					{
+						case ENOSYS:
+						case EPERM:
+							// Cross process reads are not allowed, use ptrace for the rest of the session
+							m_useProcessVmReadv = false;
+							return false;
+						case ESRCH:
+							throw std::runtime_error("Could be seen if the process is gone");
+						default:
+							// Let the word reads report the failure
+							return false;
+					}
+				}
+
+				auto terminator = memchr(result.data() + nread, '\0', readCount);
+				if (terminator != nullptr)
+				{
+					result.resize(static_cast<char*>(terminator) - result.data());
+					return true;
+				}
+
+				nread += readCount;
+			}
+
+			return true;
+		}
+
+		std::string PeekNullTerminatedStringValue(pid_t pid, long addr)
+		{
+			auto result = std::string(MaxPathLength, '\0');
 
 			char *laddr = result.data();
 
-			unsigned long len = 1024;
+			unsigned long len = MaxPathLength;
 			unsigned int nread = 0;
 			unsigned int residue = addr & (sizeof(long) - 1);
 			void *const orig_addr = laddr;
@@ -71,6 +71,7 @@ namespace Monitor
 			const Path& workingDirectory,
 			const std::map<std::string, std::string>& environmentVariables,
 			std::shared_ptr<ISystemAccessMonitor> monitor,
+			std::shared_ptr<IProcessOutputSink> outputSink,
 			bool enableAccessChecks,
 			bool partialMonitor,
 			std::vector<Path> allowedReadAccess,
@@ -97,25 +98,26 @@ namespace Monitor
 			}
 
 			// Check if there is a registered output
+			auto output = std::string();
 			auto findOutput = _executeResults.find(message.str());
 			if (findOutput != _executeResults.end())
 			{
-				return std::make_shared<Opal::System::MockProcess>(
-					id,
-					_requests,
-					0,
-					findOutput->second,
-					std::string());
+				output = findOutput->second;
 			}
-			else
+
+			// Deliver the output through the sink when one is provided
+			if (outputSink != nullptr && !output.empty())
 			{
-				return std::make_shared<Opal::System::MockProcess>(
-					id,
-					_requests,
-					0,
-					std::string(),
-					std::string());
+				outputSink->OnStandardOutput(output);
+				output.clear();
 			}
+
+			return std::make_shared<Opal::System::MockProcess>(
+				id,
+				_requests,
+				0,
+				std::move(output),
+				std::string());
 		}
 	};
 }
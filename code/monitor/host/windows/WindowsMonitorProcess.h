@@ -63,6 +63,7 @@ namespace Monitor::Windows
 		Opal::System::SmartHandle m_stdInWriteHandle;
 
 		// Result
+		std::shared_ptr<IProcessOutputSink> m_outputSink;
 		bool m_isFinished;
 		std::stringstream m_stdOut;
 		std::stringstream m_stdErr;
@@ -78,6 +79,7 @@ namespace Monitor::Windows
 			const Path& workingDirectory,
 			const std::map<std::string, std::string>& environmentVariables,
 			std::shared_ptr<ISystemAccessMonitor> monitor,
+			std::shared_ptr<IProcessOutputSink> outputSink,
 			bool enableAccessChecks,
 			bool partialMonitor,
 			std::vector<Path> allowedReadAccess,
@@ -109,6 +111,7 @@ namespace Monitor::Windows
 			m_stdErrWriteHandle(),
 			m_stdInReadHandle(),
 			m_stdInWriteHandle(),
+			m_outputSink(std::move(outputSink)),
 			m_isFinished(false),
 			m_stdOut(),
 			m_stdErr(),
@@ -346,6 +349,17 @@ namespace Monitor::Windows
 			}
 			m_exitCode = exitCode;
 
+			// Report the peak working set of the main process
+			if (m_outputSink != nullptr)
+			{
+				PROCESS_MEMORY_COUNTERS memoryCounters;
+				uint64_t peakMemoryUsage = 0;
+				if (GetProcessMemoryInfo(m_processHandle.Get(), &memoryCounters, sizeof(memoryCounters)))
+					peakMemoryUsage = memoryCounters.PeakWorkingSetSize;
+
+				m_outputSink->OnProcessExit(peakMemoryUsage);
+			}
+
 			// Close the child write handle to ensure we stop reading
 			m_stdOutWriteHandle.Close();
 			m_stdErrWriteHandle.Close();
@@ -364,7 +378,10 @@ namespace Monitor::Windows
 				if (dwRead == 0)
 					break;
 
-				m_stdOut << std::string_view(buffer, dwRead);
+				if (m_outputSink != nullptr)
+					m_outputSink->OnStandardOutput(std::string_view(buffer, dwRead));
+				else
+					m_stdOut << std::string_view(buffer, dwRead);
 			}
 
 			// Read all errors
@@ -375,8 +392,10 @@ namespace Monitor::Windows
 				if (dwRead == 0)
 					break;
 
-				// Make the string null terminated
-				m_stdErr << std::string_view(buffer, dwRead);
+				if (m_outputSink != nullptr)
+					m_outputSink->OnStandardError(std::string_view(buffer, dwRead));
+				else
+					m_stdErr << std::string_view(buffer, dwRead);
 			}
 
 			// Wait for the worker thread to exit
@@ -30,6 +30,7 @@ namespace Monitor::Windows
 			const Path& workingDirectory,
 			const std::map<std::string, std::string>& environmentVariables,
 			std::shared_ptr<ISystemAccessMonitor> monitor,
+			std::shared_ptr<IProcessOutputSink> outputSink,
 			bool enableAccessChecks,
 			bool partialMonitor,
 			std::vector<Path> allowedReadAccess,
@@ -41,6 +42,7 @@ namespace Monitor::Windows
 				workingDirectory,
 				environmentVariables,
 				std::move(monitor),
+				std::move(outputSink),
 				enableAccessChecks,
 				partialMonitor,
 				std::move(allowedReadAccess),